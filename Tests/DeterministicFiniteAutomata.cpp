@@ -114,6 +114,25 @@ TEST_F(DFA_Test, UpdateStateLabel_UpdatesStartStateLabel) {
 	EXPECT_TRUE(automaton->getStartState() == "q3");
 }
 
+TEST_F(DFA_Test, UpdateStateLabel_UpdatesTransitionsToState) {
+	automaton->addTransition("q0", "q1", "0");
+	automaton->updateStateLabel("q1", "q3");
+	EXPECT_TRUE(automaton->getState("q0").transitionExists(FATransition::generateTransitionKey("q0", "q3", "0")));
+	EXPECT_FALSE(automaton->getState("q0").transitionExists(FATransition::generateTransitionKey("q0", "q1", "0")));
+}
+
+TEST_F(DFA_Test, UpdateStateLabel_KeepsTransitionsToStateAcrossRelabels) {
+	automaton->addTransition("q0", "q1", "0");
+	automaton->addTransition("q1", "q1", "1");
+	automaton->updateStateLabel("q1", "q3");
+	automaton->updateStateLabel("q3", "q4");
+	EXPECT_TRUE(automaton->getState("q0").transitionExists(FATransition::generateTransitionKey("q0", "q4", "0")));
+	EXPECT_TRUE(automaton->getState("q4").transitionExists(FATransition::generateTransitionKey("q4", "q4", "1")));
+
+	automaton->removeState("q4", false);
+	EXPECT_TRUE(automaton->getState("q0").getTransitions().empty());
+}
+
 TEST_F(DFA_Test, GetCurrentState_GetsStartStateIfNoCurrentStateSet) {
 	EXPECT_TRUE(automaton->getCurrentState() == "q0");
 }
@@ -206,6 +225,18 @@ TEST_F(DFA_Test, RemoveState_RemovesCurrentState) {
 	EXPECT_THROW(automaton->getCurrentState(), InvalidAutomatonDefinitionException);
 }
 
+TEST_F(DFA_Test, RemoveState_AddedStateAfterRemovalIsIndependent) {
+	automaton->addTransition("q0", "q1", "0");
+	automaton->removeState("q1", false);
+	automaton->addState("q2", true);
+	automaton->addTransition("q0", "q2", "1");
+
+	EXPECT_TRUE(automaton->getStates().size() == 2);
+	EXPECT_TRUE(automaton->getState("q2").getTransitions().empty());
+	EXPECT_FALSE(automaton->simulate({"0"}));
+	EXPECT_TRUE(automaton->simulate({"1"}));
+}
+
 TEST_F(DFA_Test, RemoveState_ThrowsIfStateNotFound) {
 	EXPECT_THROW(automaton->removeState("q3"), StateNotFoundException);
 }
@@ -223,6 +254,15 @@ TEST_F(DFA_Test, RemoveState_ThrowsIfStateIsUsedInTransitionsIfStrict) {
 	EXPECT_THROW(automaton->removeState("q0", true), InvalidAutomatonDefinitionException);
 }
 
+TEST_F(DFA_Test, RemoveState_ThrowsIfStateIsUsedInUpdatedTransitionIfStrict) {
+	automaton->addState("q2");
+	automaton->addTransition("q0", "q1", "0");
+	automaton->updateTransitionToState(FATransition::generateTransitionKey("q0", "q1", "0"), "q2");
+
+	EXPECT_NO_THROW(automaton->removeState("q1"));
+	EXPECT_THROW(automaton->removeState("q2"), InvalidAutomatonDefinitionException);
+}
+
 TEST_F(DFA_Test, RemoveStates_RemovesMultipleStates) {
 	automaton->addState("q2");
 	automaton->addState("q3");
@@ -540,6 +580,22 @@ TEST_F(DFA_Test, UpdateTransitionInput_DoesNotInvalidateOtherTransitions) {
 	EXPECT_TRUE(automaton->getState("q0").transitionExists(FATransition::generateTransitionKey("q0", "q1", "2")));
 }
 
+TEST_F(DFA_Test, UpdateTransitionInput_HandlesStateLabelsContainingDelimiter) {
+	automaton->addState("a-b");
+	automaton->addTransition("a-b", "q1", "0");
+
+	std::string transitionKey = FATransition::generateTransitionKey("a-b", "q1", "0");
+	EXPECT_EQ(FATransition::getFromStateFromKey(transitionKey), "a-b");
+	EXPECT_EQ(FATransition::getToStateFromKey(transitionKey), "q1");
+
+	automaton->updateTransitionInput(transitionKey, "1");
+	transitionKey = FATransition::generateTransitionKey("a-b", "q1", "1");
+	EXPECT_TRUE(automaton->getState("a-b").transitionExists(transitionKey));
+
+	automaton->removeTransition(transitionKey);
+	EXPECT_TRUE(automaton->getState("a-b").getTransitions().empty());
+}
+
 TEST_F(DFA_Test, UpdateTransitionInput_ThrowsIfInputNotInAlphabet) {
 	automaton->addState("q2");
 	automaton->addTransition("q0", "q1", "0");
@@ -1125,4 +1181,282 @@ TEST_F(DFA_Test, Simulate_ShouldSimulateFerrymanProblem) {
 
 	// Invalid sequence: take goat -> return alone -> take wolf -> return with goat -> take cabbage -> return alone ->
 	EXPECT_FALSE(automaton->simulate({"g", "m", "w", "g", "c", "m", "g", "g"}));
-}
\ No newline at end of file
+}
+TEST_F(DFA_Test, Compile_ThrowsWithoutStartState) {
+	DeterministicFiniteAutomaton *automaton = new DeterministicFiniteAutomaton();
+	automaton->setInputAlphabet({"0", "1"});
+
+	EXPECT_THROW(automaton->compile(), InvalidStartStateException);
+}
+
+TEST_F(DFA_Test, Compile_MarksAutomatonCompiled) {
+	automaton->addTransition("q0", "q1", "0");
+
+	EXPECT_FALSE(automaton->isCompiled());
+	automaton->compile();
+	EXPECT_TRUE(automaton->isCompiled());
+}
+
+TEST_F(DFA_Test, Compile_InvalidatedByDefinitionChanges) {
+	automaton->compile();
+	automaton->addTransition("q0", "q1", "0");
+	EXPECT_FALSE(automaton->isCompiled());
+
+	automaton->compile();
+	automaton->addAcceptState("q1");
+	EXPECT_FALSE(automaton->isCompiled());
+
+	automaton->compile();
+	automaton->setStartState("q1");
+	EXPECT_FALSE(automaton->isCompiled());
+
+	automaton->compile();
+	automaton->addInputAlphabet({"2"});
+	EXPECT_FALSE(automaton->isCompiled());
+}
+
+TEST_F(DFA_Test, Compile_SimulateMatchesInterpreted) {
+	automaton->addState("q2");
+	automaton->addTransition("q0", "q1", "0");
+	automaton->addTransition("q1", "q2", "1");
+	automaton->addTransition("q2", "q0", "0");
+	automaton->addAcceptState("q2");
+
+	std::vector<std::vector<std::string>> inputs = {
+	    {}, {"0"}, {"0", "1"}, {"0", "0"}, {"1"}, {"0", "1", "0", "0", "1"}, {"0", "1", "0", "1"}, {"x"}, {"q2"}};
+
+	std::vector<bool> expected;
+	for (const auto &input : inputs) {
+		expected.push_back(automaton->simulate(input));
+	}
+
+	automaton->compile();
+	for (size_t i = 0; i < inputs.size(); i++) {
+		EXPECT_EQ(automaton->simulate(inputs[i]), expected[i]);
+	}
+	EXPECT_EQ(automaton->simulateBatch(inputs), expected);
+	EXPECT_EQ(automaton->simulateBatchParallel(inputs, 2), expected);
+}
+
+TEST_F(DFA_Test, Compile_SimulateRespectsSimulationDepth) {
+	automaton->addTransition("q0", "q1", "0");
+	automaton->addTransition("q1", "q0", "1");
+	automaton->compile();
+
+	std::vector<std::string> input = {"0", "1", "0", "1", "0", "1"};
+
+	EXPECT_FALSE(automaton->simulate(input, 3));
+}
+
+TEST_F(DFA_Test, Compile_SimulateUsesCurrentDefinitionAfterChange) {
+	automaton->addTransition("q0", "q1", "0");
+	automaton->addAcceptState("q1");
+	automaton->compile();
+	EXPECT_TRUE(automaton->simulate({"0"}));
+
+	automaton->removeAcceptState("q1");
+	EXPECT_FALSE(automaton->simulate({"0"}));
+}
+
+TEST_F(DFA_Test, Minimize_ThrowsWithoutStartState) {
+	DeterministicFiniteAutomaton *automaton = new DeterministicFiniteAutomaton();
+	automaton->setInputAlphabet({"0", "1"});
+
+	EXPECT_THROW(automaton->minimize(), InvalidStartStateException);
+}
+
+TEST_F(DFA_Test, Minimize_MergesEquivalentStates) {
+	// Accepts inputs ending in 1, q1 and q2 are equivalent
+	automaton->addState("q2");
+	automaton->addAcceptStates({"q1", "q2"});
+	automaton->addTransition("q0", "q0", "0");
+	automaton->addTransition("q0", "q1", "1");
+	automaton->addTransition("q1", "q0", "0");
+	automaton->addTransition("q1", "q2", "1");
+	automaton->addTransition("q2", "q0", "0");
+	automaton->addTransition("q2", "q1", "1");
+
+	DeterministicFiniteAutomaton minimal = automaton->minimize();
+	EXPECT_EQ(minimal.getStates().size(), 2);
+	EXPECT_EQ(minimal.getStartState(), "q0");
+
+	std::vector<std::vector<std::string>> inputs = {{}, {"1"}, {"1", "1"}, {"1", "0"}, {"0", "1", "1", "1"}};
+	for (const auto &input : inputs) {
+		EXPECT_EQ(minimal.simulate(input), automaton->simulate(input));
+	}
+}
+
+TEST_F(DFA_Test, Minimize_RemovesUnreachableAndDeadStates) {
+	automaton->addState("q2");
+	automaton->addState("q3");
+	automaton->addAcceptState("q1");
+	automaton->addTransition("q0", "q1", "0");
+	automaton->addTransition("q0", "q2", "1");
+	automaton->addTransition("q2", "q2", "0");
+	automaton->addTransition("q3", "q1", "0");
+
+	DeterministicFiniteAutomaton minimal = automaton->minimize();
+	EXPECT_EQ(minimal.getStates().size(), 2);
+	EXPECT_FALSE(minimal.stateExists("q2"));
+	EXPECT_FALSE(minimal.stateExists("q3"));
+	EXPECT_TRUE(minimal.simulate({"0"}));
+	EXPECT_FALSE(minimal.simulate({"1", "0"}));
+}
+
+TEST_F(DFA_Test, SimulateBatch_ThrowsWithoutStartState) {
+	DeterministicFiniteAutomaton *automaton = new DeterministicFiniteAutomaton();
+	automaton->setInputAlphabet({"0", "1"});
+
+	EXPECT_THROW(automaton->simulateBatch({{"0"}}), InvalidStartStateException);
+}
+
+TEST_F(DFA_Test, SimulateBatch_MatchesSimulate) {
+	automaton->addTransition("q0", "q1", "0");
+	automaton->addTransition("q1", "q0", "1");
+	automaton->addAcceptState("q1");
+
+	std::vector<std::vector<std::string>> inputs = {{}, {"0"}, {"0", "1"}, {"0", "1", "0"}, {"1"}, {"x"}};
+	std::vector<bool> expected;
+	for (const auto &input : inputs) {
+		expected.push_back(automaton->simulate(input));
+	}
+
+	EXPECT_EQ(automaton->simulateBatch(inputs), expected);
+	automaton->compile();
+	EXPECT_EQ(automaton->simulateBatch(inputs), expected);
+}
+
+TEST_F(DFA_Test, SimulateBatchParallel_MatchesSimulateBatch) {
+	automaton->addTransition("q0", "q1", "0");
+	automaton->addTransition("q1", "q0", "1");
+	automaton->addAcceptState("q1");
+
+	// Inputs of very different lengths, so workers finishing early have to steal
+	std::vector<std::vector<std::string>> inputs;
+	for (int i = 0; i < 200; i++) {
+		std::vector<std::string> input;
+		for (int j = 0; j < (i % 10 == 0 ? 200 : i % 7); j++) {
+			input.push_back(j % 2 == 0 ? "0" : "1");
+		}
+		inputs.push_back(input);
+	}
+
+	std::vector<bool> expected = automaton->simulateBatch(inputs, 500);
+	EXPECT_EQ(automaton->simulateBatchParallel(inputs, 4, 500), expected);
+	automaton->compile();
+	EXPECT_EQ(automaton->simulateBatchParallel(inputs, 4, 500), expected);
+}
+
+TEST_F(DFA_Test, Freeze_ThrowsWithoutStartState) {
+	DeterministicFiniteAutomaton *automaton = new DeterministicFiniteAutomaton();
+	automaton->setInputAlphabet({"0", "1"});
+
+	EXPECT_THROW(automaton->freeze(), InvalidStartStateException);
+}
+
+TEST_F(DFA_Test, Freeze_MatchesSimulate) {
+	automaton->addState("q2");
+	automaton->addTransition("q0", "q1", "0");
+	automaton->addTransition("q1", "q0", "1");
+	automaton->addTransition("q1", "q2", "0");
+	automaton->addAcceptState("q1");
+
+	std::vector<std::vector<std::string>> inputs = {{"0"}, {"0", "1"}, {"0", "1", "0"}, {"1"}, {}, {"0", "0"}};
+	FrozenDFA frozen = automaton->freeze();
+
+	EXPECT_EQ(frozen.getStartState(), "q0");
+	EXPECT_EQ(frozen.getStateCount(), 3);
+	for (const auto &input : inputs) {
+		EXPECT_EQ(frozen.simulate(input), automaton->simulate(input));
+	}
+	EXPECT_EQ(frozen.simulateBatch(inputs), automaton->simulateBatch(inputs));
+	EXPECT_EQ(frozen.simulateBatchParallel(inputs, 4), automaton->simulateBatch(inputs));
+}
+
+TEST_F(DFA_Test, Freeze_IsUnaffectedByLaterEdits) {
+	automaton->addTransition("q0", "q1", "0");
+	automaton->addAcceptState("q1");
+
+	FrozenDFA frozen = automaton->freeze();
+	automaton->removeAcceptState("q1");
+
+	EXPECT_TRUE(frozen.simulate({"0"}));
+	EXPECT_FALSE(automaton->simulate({"0"}));
+}
+
+TEST_F(DFA_Test, FrozenStep_AdvancesContext) {
+	automaton->addTransition("q0", "q1", "0");
+	automaton->addTransition("q1", "q0", "1");
+	automaton->addAcceptState("q1");
+
+	FrozenDFA frozen = automaton->freeze();
+	FrozenDFA::Context context = frozen.createContext({"0", "1"});
+
+	EXPECT_EQ(frozen.getCurrentState(context), "q0");
+	EXPECT_TRUE(frozen.step(context));
+	EXPECT_EQ(frozen.getCurrentState(context), "q1");
+	EXPECT_TRUE(frozen.isAccepting(context));
+	EXPECT_TRUE(frozen.step(context));
+	EXPECT_FALSE(frozen.isAccepting(context));
+	EXPECT_FALSE(frozen.step(context));
+}
+
+TEST_F(DFA_Test, GetStatesView_MatchesGetStates) {
+	automaton->addTransition("q0", "q1", "0");
+	automaton->addTransition("q1", "q0", "1");
+
+	const std::vector<FAState> &view = automaton->getStatesView();
+	EXPECT_EQ(view, automaton->getStates());
+
+	automaton->addState("q2");
+	EXPECT_EQ(automaton->getStatesView().size(), 3);
+}
+
+TEST_F(DFA_Test, GetTransitionsView_FollowsTransitionChanges) {
+	FAState state("q0");
+	state.addTransition("q1", "0");
+
+	EXPECT_EQ(state.getTransitionsView(), state.getTransitions());
+	EXPECT_EQ(state.getTransitionsView().size(), 1);
+
+	state.addTransition("q1", "1");
+	EXPECT_EQ(state.getTransitionsView().size(), 2);
+	EXPECT_EQ(state.getTransitionsView(), state.getTransitions());
+}
+
+TEST_F(DFA_Test, GetTransitionsOnInput_FollowsTransitionChanges) {
+	FAState state("q0");
+	state.addTransition("q1", "0");
+	state.addTransition("q0", "1");
+
+	SymbolId zero = SymbolTable::find("0");
+	SymbolId one = SymbolTable::find("1");
+	ASSERT_EQ(state.getTransitionsOnInput(zero).size(), 1);
+	EXPECT_EQ(state.getTransitionsOnInput(zero)[0].getToStateKey(), "q1");
+	EXPECT_TRUE(state.getTransitionsOnInput(SymbolTable::EPSILON_SYMBOL_ID).empty());
+
+	state.setTransitionInput(FATransition::generateTransitionKey("q0", "q1", "0"), "1");
+	EXPECT_FALSE(state.hasTransitionOnInput(zero));
+	EXPECT_EQ(state.getTransitionsOnInput(one).size(), 2);
+
+	state.removeTransition(FATransition::generateTransitionKey("q0", "q0", "1"));
+	ASSERT_EQ(state.getTransitionsOnInput(one).size(), 1);
+	EXPECT_EQ(state.getTransitionsOnInput(one)[0].getToStateKey(), "q1");
+
+	state.clearTransitionsTo("q1");
+	EXPECT_FALSE(state.hasTransitionOnInput(one));
+}
+
+TEST_F(DFA_Test, GetTransitionKey_MatchesParsedKey) {
+	FAState state("q0");
+	state.addTransition("q1", "0");
+
+	FATransition transition = state.getTransitions()[0];
+	EXPECT_EQ(transition.getTransitionKey(), FATransition::parseTransitionKey(transition.getKey()));
+	EXPECT_EQ(FATransition::generateTransitionKey(transition.getTransitionKey()), transition.getKey());
+	EXPECT_EQ(state.getTransition(transition.getTransitionKey()), transition);
+
+	state.removeTransition(transition.getTransitionKey());
+	EXPECT_FALSE(state.transitionExists(transition.getTransitionKey()));
+	EXPECT_THROW(state.removeTransition(transition.getTransitionKey()), TransitionNotFoundException);
+}
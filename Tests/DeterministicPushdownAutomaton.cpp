@@ -561,6 +561,16 @@ TEST_F(DPDA_Test, AddTransition_ThrowsIfNonDeterministic) {
 	EXPECT_THROW(automaton->addTransition("q0", "q2", "0", "A", "A"), InvalidAutomatonDefinitionException);
 }
 
+TEST_F(DPDA_Test, AddTransition_ThrowsIfEpsilonAndInputShareStackSymbol) {
+	automaton->addTransition("q0", "q1", "0", "A", "A");
+	EXPECT_THROW(automaton->addTransition("q0", "q1", "", "A", "A"), InvalidAutomatonDefinitionException);
+	EXPECT_NO_THROW(automaton->addTransition("q0", "q1", "", "Z", "A"));
+	EXPECT_THROW(automaton->addTransition("q0", "q0", "1", "Z", "A"), InvalidAutomatonDefinitionException);
+
+	automaton->removeTransition(PDATransition::generateTransitionKey("q0", "q1", "0", "A", "A"));
+	EXPECT_NO_THROW(automaton->addTransition("q0", "q1", "", "A", "A"));
+}
+
 TEST_F(DPDA_Test, AddTransition_AllowsDifferentInputs) {
 	automaton->addTransition("q0", "q1", "0", "A", "A");
 	automaton->addTransition("q0", "q0", "1", "A", "A");
@@ -1228,4 +1238,96 @@ TEST_F(DPDA_Test, Simulate_EmptyInputStaysAtStartState) {
 TEST_F(DPDA_Test, Simulate_RejectIfNoTransitionFound) {
 	automaton->addAcceptState("q0");
 	EXPECT_FALSE(automaton->simulate({"0"}));
-}
\ No newline at end of file
+}
+
+TEST_F(DPDA_Test, SimulateBatch_MatchesSimulate) {
+	automaton->addState("q2");
+	automaton->addState("q3");
+	automaton->addAcceptState("q3");
+	automaton->addStackAlphabet({"$", "0"});
+
+	automaton->addTransition("q0", "q1", "", "", "$");
+
+	automaton->addTransition("q1", "q1", "0", "", "0");
+	automaton->addTransition("q1", "q2", "1", "0", "");
+
+	automaton->addTransition("q2", "q2", "1", "0", "");
+	automaton->addTransition("q2", "q3", "", "$", "");
+
+	std::vector<std::vector<std::string>> inputs = {
+	    {"0", "0", "0", "1", "1", "1"}, {"0", "0", "0", "1", "1", "0"}, {"0", "1"}, {"1"}};
+	std::vector<bool> expected;
+	for (const auto &input : inputs) {
+		expected.push_back(automaton->simulate(input));
+	}
+
+	EXPECT_TRUE(expected[0]);
+	EXPECT_FALSE(expected[1]);
+	EXPECT_EQ(automaton->simulateBatch(inputs), expected);
+}
+
+TEST_F(DPDA_Test, SimulateBatchParallel_MatchesSimulateBatch) {
+	automaton->addState("q2");
+	automaton->addState("q3");
+	automaton->addAcceptState("q3");
+	automaton->addStackAlphabet({"$", "0"});
+
+	automaton->addTransition("q0", "q1", "", "", "$");
+
+	automaton->addTransition("q1", "q1", "0", "", "0");
+	automaton->addTransition("q1", "q2", "1", "0", "");
+
+	automaton->addTransition("q2", "q2", "1", "0", "");
+	automaton->addTransition("q2", "q3", "", "$", "");
+
+	std::vector<std::vector<std::string>> sample = {
+	    {"0", "0", "0", "1", "1", "1"}, {"0", "0", "0", "1", "1", "0"}, {"0", "1"}, {"1"}};
+	std::vector<std::vector<std::string>> inputs;
+	for (int i = 0; i < 50; i++) {
+		inputs.insert(inputs.end(), sample.begin(), sample.end());
+	}
+
+	EXPECT_EQ(automaton->simulateBatchParallel(inputs, 4), automaton->simulateBatch(inputs));
+}
+
+TEST_F(DPDA_Test, SimulateWithCycleDetection_ReportsHaltingRuns) {
+	automaton->addState("q2", true);
+	automaton->addTransition("q0", "q0", "0", "Z", "Z,A");
+	automaton->addTransition("q0", "q0", "0", "A", "A,A");
+	automaton->addTransition("q0", "q1", "1", "A", "");
+	automaton->addTransition("q1", "q1", "1", "A", "");
+	automaton->addTransition("q1", "q2", "", "Z", "Z");
+
+	EXPECT_EQ(automaton->simulateWithCycleDetection({"0", "0", "1", "1"}, 1000), SimulationResult::ACCEPTED);
+	EXPECT_EQ(automaton->simulateWithCycleDetection({"0", "0", "1"}, 1000), SimulationResult::REJECTED);
+	EXPECT_EQ(automaton->simulateWithCycleDetection({"1"}, 1000), SimulationResult::REJECTED);
+	EXPECT_EQ(automaton->simulateWithCycleDetection({"0", "0", "1", "1"}, 2), SimulationResult::OUT_OF_BUDGET);
+}
+
+TEST_F(DPDA_Test, SimulateWithCycleDetection_DecidesConfigurationAtBudgetEdge) {
+	automaton->addState("q2", true);
+	automaton->addTransition("q0", "q1", "0", "Z", "Z");
+	automaton->addTransition("q1", "q2", "", "Z", "Z");
+
+	// A depth of d allows d + 1 transitions, and the configuration they reach is still judged
+	EXPECT_EQ(automaton->simulateWithCycleDetection({"0"}, 0), SimulationResult::OUT_OF_BUDGET);
+	EXPECT_EQ(automaton->simulateWithCycleDetection({"0"}, 1), SimulationResult::ACCEPTED);
+	EXPECT_EQ(automaton->simulateWithCycleDetection({"1"}, 0), SimulationResult::REJECTED);
+	EXPECT_EQ(automaton->simulateWithCycleDetection({"0", "1"}, 1), SimulationResult::REJECTED);
+}
+
+TEST_F(DPDA_Test, SimulateWithCycleDetection_DetectsEpsilonCycles) {
+	// Moves between the states without reading input or changing the stack
+	automaton->addTransition("q0", "q1", "", "Z", "Z");
+	automaton->addTransition("q1", "q0", "", "Z", "Z");
+	EXPECT_EQ(automaton->simulateWithCycleDetection({"0"}, 1000000000), SimulationResult::DIVERGES);
+	EXPECT_EQ(automaton->simulateWithCycleDetection({}, 1000000000), SimulationResult::DIVERGES);
+	EXPECT_EQ(automaton->simulateWithCycleDetection({}, 0), SimulationResult::OUT_OF_BUDGET);
+}
+
+TEST_F(DPDA_Test, SimulateWithCycleDetection_DetectsGrowingEpsilonLoops) {
+	// Keeps pushing without reading input, so no configuration ever repeats
+	automaton->addTransition("q0", "q1", "", "Z", "Z,A");
+	automaton->addTransition("q1", "q1", "", "A", "A,A");
+	EXPECT_EQ(automaton->simulateWithCycleDetection({"1", "1", "0"}, 1000000000), SimulationResult::DIVERGES);
+}
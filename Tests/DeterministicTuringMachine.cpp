@@ -182,6 +182,19 @@ TEST_F(DTM_Test, GetStates_GetsStatesAfterAddStateCall) {
 	EXPECT_TRUE(foundQ3);
 }
 
+TEST_F(DTM_Test, UpdateStateLabel_UpdatesTransitionsToState) {
+	automaton->addTransition("q0", "q1", "0", "A", TMDirection::RIGHT);
+	automaton->updateStateLabel("q1", "q3");
+	EXPECT_TRUE(automaton->getState("q0").transitionExists(
+	    TMTransition::generateTransitionKey("q0", "q3", "0", "A", TMDirection::RIGHT)));
+	EXPECT_FALSE(automaton->getState("q0").transitionExists(
+	    TMTransition::generateTransitionKey("q0", "q1", "0", "A", TMDirection::RIGHT)));
+
+	EXPECT_THROW(automaton->removeState("q3"), InvalidAutomatonDefinitionException);
+	automaton->removeState("q3", false);
+	EXPECT_TRUE(automaton->getState("q0").getTransitions().empty());
+}
+
 TEST_F(DTM_Test, GetStates_GetsStatesAfterUpdateStateLabelCall) {
 	automaton->updateStateLabel("q0", "q3");
 	std::vector<TMState> states = automaton->getStates();
@@ -1234,4 +1247,366 @@ TEST_F(DTM_Test, Simulate_InvalidInputReject) {
 	automaton->addTransition("q6", "q4", "1", "_", TMDirection::LEFT);
 
 	EXPECT_FALSE(automaton->simulate({"1", "0", "1", "1", "0", "0"}));
-}
\ No newline at end of file
+}
+
+TEST_F(DTM_Test, Simulate_DoesNotInternUnknownInputSymbols) {
+	automaton->addAcceptState("q1");
+	automaton->addTransition("q0", "q1", "0", "A", TMDirection::RIGHT);
+
+	EXPECT_TRUE(automaton->simulate({"0"}));
+	EXPECT_FALSE(automaton->simulate({"dtm-unseen-symbol"}));
+	EXPECT_FALSE(automaton->simulateBatch({{"dtm-unseen-batch-symbol"}})[0]);
+	EXPECT_EQ(SymbolTable::find("dtm-unseen-symbol"), SymbolTable::UNKNOWN_SYMBOL_ID);
+	EXPECT_EQ(SymbolTable::find("dtm-unseen-batch-symbol"), SymbolTable::UNKNOWN_SYMBOL_ID);
+}
+
+TEST_F(DTM_Test, SimulateBatch_MatchesSimulate) {
+	automaton->addState("q2", false);
+	automaton->addState("q3", false);
+	automaton->addState("q4", false);
+	automaton->addState("q5", false);
+	automaton->addState("q6", false);
+	automaton->addState("q_accept", true);
+
+	automaton->addInputAlphabet({"0", "1", "_"});
+
+	automaton->addTransition("q0", "q1", "", "", TMDirection::STAY);
+
+	automaton->addTransition("q1", "q_accept", "_", "_", TMDirection::STAY);
+	automaton->addTransition("q1", "q2", "0", "_", TMDirection::RIGHT);
+	automaton->addTransition("q1", "q5", "1", "_", TMDirection::RIGHT);
+
+	automaton->addTransition("q2", "q2", "0", "0", TMDirection::RIGHT);
+	automaton->addTransition("q2", "q2", "1", "1", TMDirection::RIGHT);
+	automaton->addTransition("q2", "q3", "_", "_", TMDirection::LEFT);
+
+	automaton->addTransition("q3", "q_accept", "_", "_", TMDirection::STAY);
+	automaton->addTransition("q3", "q4", "0", "_", TMDirection::LEFT);
+
+	automaton->addTransition("q4", "q4", "0", "0", TMDirection::LEFT);
+	automaton->addTransition("q4", "q4", "1", "1", TMDirection::LEFT);
+	automaton->addTransition("q4", "q1", "_", "_", TMDirection::RIGHT);
+
+	automaton->addTransition("q5", "q5", "0", "0", TMDirection::RIGHT);
+	automaton->addTransition("q5", "q5", "1", "1", TMDirection::RIGHT);
+	automaton->addTransition("q5", "q6", "_", "_", TMDirection::LEFT);
+
+	automaton->addTransition("q6", "q_accept", "_", "_", TMDirection::STAY);
+	automaton->addTransition("q6", "q4", "1", "_", TMDirection::LEFT);
+
+	std::vector<std::vector<std::string>> inputs = {
+	    {"1", "0", "1", "1", "0", "1"}, {"1", "0", "1", "1", "0", "0"}, {"0", "0"}, {"0", "1"}};
+	std::vector<bool> expected;
+	for (const auto &input : inputs) {
+		expected.push_back(automaton->simulate(input));
+	}
+
+	EXPECT_TRUE(expected[0]);
+	EXPECT_FALSE(expected[1]);
+	EXPECT_EQ(automaton->simulateBatch(inputs), expected);
+}
+
+TEST_F(DTM_Test, SimulateBatchParallel_MatchesSimulateBatch) {
+	automaton->addState("q2", false);
+	automaton->addState("q3", false);
+	automaton->addState("q4", false);
+	automaton->addState("q5", false);
+	automaton->addState("q6", false);
+	automaton->addState("q_accept", true);
+
+	automaton->addInputAlphabet({"0", "1", "_"});
+
+	automaton->addTransition("q0", "q1", "", "", TMDirection::STAY);
+
+	automaton->addTransition("q1", "q_accept", "_", "_", TMDirection::STAY);
+	automaton->addTransition("q1", "q2", "0", "_", TMDirection::RIGHT);
+	automaton->addTransition("q1", "q5", "1", "_", TMDirection::RIGHT);
+
+	automaton->addTransition("q2", "q2", "0", "0", TMDirection::RIGHT);
+	automaton->addTransition("q2", "q2", "1", "1", TMDirection::RIGHT);
+	automaton->addTransition("q2", "q3", "_", "_", TMDirection::LEFT);
+
+	automaton->addTransition("q3", "q_accept", "_", "_", TMDirection::STAY);
+	automaton->addTransition("q3", "q4", "0", "_", TMDirection::LEFT);
+
+	automaton->addTransition("q4", "q4", "0", "0", TMDirection::LEFT);
+	automaton->addTransition("q4", "q4", "1", "1", TMDirection::LEFT);
+	automaton->addTransition("q4", "q1", "_", "_", TMDirection::RIGHT);
+
+	automaton->addTransition("q5", "q5", "0", "0", TMDirection::RIGHT);
+	automaton->addTransition("q5", "q5", "1", "1", TMDirection::RIGHT);
+	automaton->addTransition("q5", "q6", "_", "_", TMDirection::LEFT);
+
+	automaton->addTransition("q6", "q_accept", "_", "_", TMDirection::STAY);
+	automaton->addTransition("q6", "q4", "1", "_", TMDirection::LEFT);
+
+	std::vector<std::vector<std::string>> sample = {
+	    {"1", "0", "1", "1", "0", "1"}, {"1", "0", "1", "1", "0", "0"}, {"0", "0"}, {"0", "1"}};
+	std::vector<std::vector<std::string>> inputs;
+	for (int i = 0; i < 50; i++) {
+		inputs.insert(inputs.end(), sample.begin(), sample.end());
+	}
+
+	EXPECT_EQ(automaton->simulateBatchParallel(inputs, 4), automaton->simulateBatch(inputs));
+}
+
+TEST_F(DTM_Test, Freeze_MatchesSimulate) {
+	automaton->addState("q2", false);
+	automaton->addState("q_accept", true);
+
+	automaton->addInputAlphabet({"0", "1", "_"});
+
+	// Accepts inputs with an even number of 1s
+	automaton->addTransition("q0", "q0", "0", "0", TMDirection::RIGHT);
+	automaton->addTransition("q0", "q1", "1", "1", TMDirection::RIGHT);
+	automaton->addTransition("q0", "q_accept", "_", "_", TMDirection::STAY);
+	automaton->addTransition("q1", "q1", "0", "0", TMDirection::RIGHT);
+	automaton->addTransition("q1", "q0", "1", "1", TMDirection::RIGHT);
+	automaton->addTransition("q1", "q2", "_", "_", TMDirection::STAY);
+
+	std::vector<std::vector<std::string>> inputs = {{"1", "1"}, {"1", "0"}, {}, {"0", "1", "0", "1", "1"}, {"0"}};
+	FrozenDTM frozen = automaton->freeze();
+
+	EXPECT_EQ(frozen.getStartState(), "q0");
+	EXPECT_EQ(frozen.getStateCount(), 4);
+	for (const auto &input : inputs) {
+		EXPECT_EQ(frozen.simulate(input), automaton->simulate(input));
+	}
+	EXPECT_EQ(frozen.simulateBatch(inputs), automaton->simulateBatch(inputs));
+	EXPECT_EQ(frozen.simulateBatchParallel(inputs, 4), automaton->simulateBatch(inputs));
+
+	FrozenDTM::Context context = frozen.createContext({"1"});
+	EXPECT_TRUE(frozen.step(context));
+	EXPECT_EQ(frozen.getCurrentState(context), "q1");
+	EXPECT_TRUE(frozen.step(context));
+	EXPECT_EQ(frozen.getCurrentState(context), "q2");
+	EXPECT_FALSE(frozen.isAccepting(context));
+	EXPECT_FALSE(frozen.step(context));
+}
+
+TEST_F(DTM_Test, GetStatesView_MatchesGetStates) {
+	automaton->addTransition("q0", "q1", "0", "A", TMDirection::RIGHT);
+
+	EXPECT_EQ(automaton->getStatesView(), automaton->getStates());
+
+	TMState state = automaton->getState("q0");
+	EXPECT_EQ(state.getTransitionsView(), state.getTransitions());
+	EXPECT_EQ(state.getTransitionsView().size(), 1);
+}
+
+TEST_F(DTM_Test, GetTransitionKey_MatchesParsedKey) {
+	TMState state("q0");
+	state.addTransition("q1", "0", "A", TMDirection::RIGHT);
+
+	TMTransition transition = state.getTransitions()[0];
+	EXPECT_EQ(transition.getTransitionKey(), TMTransition::parseTransitionKey(transition.getKey()));
+	EXPECT_EQ(TMTransition::generateTransitionKey(transition.getTransitionKey()), transition.getKey());
+
+	state.setTransitionDirection(transition.getKey(), TMDirection::LEFT);
+	EXPECT_FALSE(state.transitionExists(transition.getTransitionKey()));
+	EXPECT_FALSE(state.transitionExists("q0-q1-0-A-SIDEWAYS"));
+	EXPECT_TRUE(state.transitionExists(TMTransition::generateTransitionKey("q0", "q1", "0", "A", TMDirection::LEFT)));
+}
+
+TEST_F(DTM_Test, MoveTapeHead_GrowsTapeOnTheRightOnly) {
+	automaton->setInput({"0", "1"});
+	automaton->moveTapeHead(TMDirection::LEFT);
+	EXPECT_EQ(automaton->getTapehead(), 0);
+
+	automaton->moveTapeHead(TMDirection::RIGHT);
+	automaton->moveTapeHead(TMDirection::RIGHT);
+	automaton->writeTape("A");
+	EXPECT_EQ(automaton->getTapehead(), 2);
+	EXPECT_EQ(automaton->getTape(), (std::list<std::string>{"0", "1", "A"}));
+
+	automaton->setTapeHead(5);
+	EXPECT_EQ(automaton->readTape(), "_");
+	EXPECT_EQ(automaton->getTape().size(), 6);
+	automaton->moveTapeHead(TMDirection::LEFT);
+	EXPECT_EQ(automaton->getTapehead(), 4);
+}
+
+TEST(TMTape_Test, SetMode_RunLengthTapeMatchesContiguousTape) {
+	TMTape contiguous;
+	TMTape runLength("_", TMTapeMode::RUN_LENGTH);
+	contiguous.loadInput(std::vector<std::string>{"A", "A", "Z"});
+	runLength.loadInput(std::vector<std::string>{"A", "A", "Z"});
+
+	// Drive both tapes through the same pseudo-random writes and moves
+	const std::vector<std::string> symbols = {"A", "Z", "_"};
+	uint32_t seed = 7;
+	for (int i = 0; i < 2000; i++) {
+		seed = seed * 1103515245 + 12345;
+		const uint32_t choice = (seed >> 16) % 7;
+		if (choice < 3) {
+			contiguous.write(symbols[choice]);
+			runLength.write(symbols[choice]);
+		} else if (choice < 5) {
+			contiguous.moveLeft();
+			runLength.moveLeft();
+		} else {
+			contiguous.moveRight();
+			runLength.moveRight();
+		}
+
+		ASSERT_EQ(runLength.read(), contiguous.read());
+		ASSERT_EQ(runLength.getHeadPosition(), contiguous.getHeadPosition());
+		ASSERT_EQ(runLength.getRunCount(), contiguous.getRunCount());
+		ASSERT_EQ(runLength.hash(), contiguous.hash());
+	}
+	EXPECT_EQ(runLength.getTape(), contiguous.getTape());
+
+	runLength.setMode(TMTapeMode::CONTIGUOUS);
+	EXPECT_EQ(runLength.toString(), contiguous.toString());
+}
+
+TEST(TMTape_Test, Sweep_RunLengthMatchesCellByCell) {
+	TMTape contiguous;
+	TMTape runLength("_", TMTapeMode::RUN_LENGTH);
+	contiguous.loadInput(std::vector<std::string>{"A", "Z", "Z", "A"});
+	runLength.loadInput(std::vector<std::string>{"A", "Z", "Z", "A"});
+
+	// A contiguous tape sweeps one cell at a time, a run-length tape rewrites its runs in bulk
+	const std::vector<SymbolId> symbols = SymbolTable::intern(std::vector<std::string>{"A", "Z", "_"});
+	const std::vector<TMDirection> directions = {TMDirection::LEFT, TMDirection::RIGHT, TMDirection::STAY};
+	uint32_t seed = 11;
+	for (int i = 0; i < 500; i++) {
+		seed = seed * 1103515245 + 12345;
+		const SymbolId symbol = symbols[(seed >> 16) % 3];
+		const TMDirection direction = directions[(seed >> 20) % 3];
+		const int count = static_cast<int>((seed >> 24) % 9);
+		contiguous.sweep(symbol, direction, count);
+		runLength.sweep(symbol, direction, count);
+
+		ASSERT_EQ(runLength.getHeadPosition(), contiguous.getHeadPosition());
+		ASSERT_EQ(runLength.getSize(), contiguous.getSize());
+		ASSERT_EQ(runLength.getRunCount(), contiguous.getRunCount());
+		ASSERT_EQ(runLength.getFingerprint(), contiguous.getFingerprint());
+	}
+	EXPECT_EQ(runLength.getTape(), contiguous.getTape());
+
+	// The fingerprint kept up by the sweeps matches the one of the same tape built from scratch
+	TMTape rebuilt("_", TMTapeMode::RUN_LENGTH);
+	rebuilt.setTape(runLength.getTape());
+	rebuilt.setHeadPosition(runLength.getHeadPosition());
+	EXPECT_EQ(rebuilt.getFingerprint(), runLength.getFingerprint());
+}
+
+TEST_F(DTM_Test, SetTapeMode_RunLengthTapeStoresLongRunsCompactly) {
+	automaton->setTapeMode(TMTapeMode::RUN_LENGTH);
+	automaton->setInput({"0", "1"});
+	automaton->setTapeHead(100000000);
+	automaton->writeTape("A");
+	automaton->moveTapeHead(TMDirection::RIGHT);
+
+	EXPECT_EQ(automaton->getTapeMode(), TMTapeMode::RUN_LENGTH);
+	EXPECT_EQ(automaton->getTapehead(), 100000001);
+	EXPECT_EQ(automaton->readTape(), "_");
+
+	TMTape tape("_", TMTapeMode::RUN_LENGTH);
+	tape.loadInput(std::vector<std::string>{"0", "1"});
+	tape.setHeadPosition(100000000);
+	tape.write("A");
+	tape.setHeadPosition(3);
+	EXPECT_EQ(tape.toString(), "[0, 1, _, (_), _*99999996, A]");
+	EXPECT_EQ(tape.getRunCount(), 4);
+	EXPECT_EQ(tape.getSize(), 100000001);
+}
+
+TEST_F(DTM_Test, SetTapeMode_RunLengthSimulateMatchesContiguous) {
+	automaton->addState("q_accept", true);
+	automaton->addInputAlphabet({"0", "1", "_"});
+
+	// Rewrites the input to As and accepts on the blank after it
+	automaton->addTransition("q0", "q0", "0", "A", TMDirection::RIGHT);
+	automaton->addTransition("q0", "q0", "1", "A", TMDirection::RIGHT);
+	automaton->addTransition("q0", "q_accept", "_", "_", TMDirection::STAY);
+
+	std::vector<std::vector<std::string>> inputs = {{"1", "1"}, {"1", "0"}, {}, {"0", "1", "0", "1", "1"}};
+	const std::vector<bool> expected = automaton->simulateBatch(inputs, 3);
+
+	automaton->setTapeMode(TMTapeMode::RUN_LENGTH);
+	EXPECT_EQ(automaton->simulateBatch(inputs, 3), expected);
+	EXPECT_EQ(automaton->freeze().simulateBatch(inputs, 3), expected);
+}
+
+TEST_F(DTM_Test, SimulateAccelerated_MatchesSimulate) {
+	automaton->addState("q_accept", true);
+	automaton->addInputAlphabet({"1", "_"});
+
+	// Turns the 1s into As on the way right and back into 1s on the way left, accepting on the 1 at the left end
+	automaton->addTransition("q0", "q0", "1", "A", TMDirection::RIGHT);
+	automaton->addTransition("q0", "q1", "_", "_", TMDirection::LEFT);
+	automaton->addTransition("q1", "q1", "A", "1", TMDirection::LEFT);
+	automaton->addTransition("q1", "q_accept", "1", "1", TMDirection::STAY);
+
+	std::vector<std::string> input(20, "1");
+	uint64_t stepCount = 0;
+	for (int depth = 0; depth < 50; depth++) {
+		EXPECT_EQ(automaton->simulateAccelerated(input, depth, stepCount), automaton->simulate(input, depth));
+	}
+
+	input.assign(1000, "1");
+	EXPECT_TRUE(automaton->simulateAccelerated(input, 100000, stepCount));
+	EXPECT_EQ(stepCount, 2002);
+	EXPECT_TRUE(automaton->simulate(input, 2001));
+	EXPECT_FALSE(automaton->simulate(input, 2000));
+	EXPECT_FALSE(automaton->simulateAccelerated(input, 2000, stepCount));
+	EXPECT_EQ(stepCount, 2001);
+}
+
+TEST_F(DTM_Test, SimulateAccelerated_CoversLongSweepsInFewSteps) {
+	automaton->addInputAlphabet({"1", "_"});
+
+	// Bounces between the marker at the left end and the blanks, adding a 1 on every pass
+	automaton->addTransition("q0", "q0", "A", "A", TMDirection::RIGHT);
+	automaton->addTransition("q0", "q0", "1", "1", TMDirection::RIGHT);
+	automaton->addTransition("q0", "q1", "_", "1", TMDirection::LEFT);
+	automaton->addTransition("q1", "q1", "1", "1", TMDirection::LEFT);
+	automaton->addTransition("q1", "q0", "A", "A", TMDirection::RIGHT);
+
+	uint64_t stepCount = 0;
+	EXPECT_FALSE(automaton->simulateAccelerated({"A", "1"}, 100000000, stepCount));
+	EXPECT_EQ(stepCount, 100000001);
+	EXPECT_FALSE(automaton->simulateAccelerated({"A", "1"}, 200, stepCount));
+	EXPECT_EQ(stepCount, 201);
+	EXPECT_FALSE(automaton->simulate({"A", "1"}, 200));
+
+	// A sweep right over blanks never ends
+	automaton->addState("q2");
+	automaton->addTransition("q2", "q2", "_", "_", TMDirection::RIGHT);
+	automaton->setStartState("q2");
+	EXPECT_FALSE(automaton->simulateAccelerated({}, 1000000000, stepCount));
+	EXPECT_EQ(stepCount, 1000000001);
+}
+
+TEST_F(DTM_Test, SimulateWithCycleDetection_ReportsEachOutcome) {
+	automaton->addState("q_accept", true);
+	automaton->addState("q2");
+	automaton->addInputAlphabet({"0", "1", "_"});
+
+	// Accepts on a 1, loops on the blank after a 0 and sweeps right over blanks forever on an empty input
+	automaton->addTransition("q0", "q_accept", "1", "1", TMDirection::STAY);
+	automaton->addTransition("q0", "q1", "0", "0", TMDirection::RIGHT);
+	automaton->addTransition("q1", "q2", "_", "_", TMDirection::LEFT);
+	automaton->addTransition("q2", "q1", "0", "0", TMDirection::RIGHT);
+	automaton->addTransition("q0", "q0", "_", "_", TMDirection::RIGHT);
+
+	EXPECT_EQ(automaton->simulateWithCycleDetection({"1"}, 1000), SimulationResult::ACCEPTED);
+	EXPECT_EQ(automaton->simulateWithCycleDetection({"Z"}, 1000), SimulationResult::REJECTED);
+	EXPECT_EQ(automaton->simulateWithCycleDetection({"0"}, 1000000000), SimulationResult::DIVERGES);
+	EXPECT_EQ(automaton->simulateWithCycleDetection({}, 1000), SimulationResult::OUT_OF_BUDGET);
+	EXPECT_FALSE(automaton->simulate({}, 1000));
+}
+
+TEST_F(DTM_Test, SimulateWithCycleDetection_DecidesConfigurationAtBudgetEdge) {
+	automaton->addState("q_accept", true);
+	automaton->addTransition("q0", "q1", "0", "0", TMDirection::RIGHT);
+	automaton->addTransition("q1", "q_accept", "0", "0", TMDirection::RIGHT);
+
+	// A depth of d allows d + 1 transitions, and the configuration they reach is still judged
+	EXPECT_EQ(automaton->simulateWithCycleDetection({"0", "0"}, 0), SimulationResult::OUT_OF_BUDGET);
+	EXPECT_EQ(automaton->simulateWithCycleDetection({"0", "0"}, 1), SimulationResult::ACCEPTED);
+	EXPECT_TRUE(automaton->simulate({"0", "0"}, 1));
+	EXPECT_EQ(automaton->simulateWithCycleDetection({"0", "1"}, 0), SimulationResult::REJECTED);
+}
@@ -1057,4 +1057,288 @@ TEST_F(NFA_Test, Simulate_RejectsIfSimulationDepthExceeded) {
 TEST_F(NFA_Test, Simulate_EmptyInputStaysAtStartState) {
 	automaton->addAcceptState("q0");
 	EXPECT_TRUE(automaton->simulate({}));
-}
\ No newline at end of file
+}
+TEST_F(NFA_Test, Simulate_FollowsEpsilonCyclesWithoutUsingDepth) {
+	automaton->addState("q2");
+	automaton->addState("q3");
+	automaton->addAcceptState("q3");
+
+	automaton->addTransition("q0", "q1", "");
+	automaton->addTransition("q1", "q0", "");
+	automaton->addTransition("q1", "q2", "");
+	automaton->addTransition("q2", "q3", "1");
+
+	EXPECT_TRUE(automaton->simulate({"1"}, 1));
+	EXPECT_FALSE(automaton->simulate({"1", "1"}, 1));
+}
+
+TEST_F(NFA_Test, Simulate_UsesCurrentEpsilonTransitionsAfterChange) {
+	automaton->addAcceptState("q1");
+	EXPECT_FALSE(automaton->simulate({}));
+
+	automaton->addTransition("q0", "q1", "");
+	EXPECT_TRUE(automaton->simulate({}));
+
+	automaton->removeTransition(FATransition::generateTransitionKey("q0", "q1", ""));
+	EXPECT_FALSE(automaton->simulate({}));
+}
+
+TEST_F(NFA_Test, Compile_ThrowsWithoutStartState) {
+	NonDeterministicFiniteAutomaton *automaton = new NonDeterministicFiniteAutomaton();
+	automaton->setInputAlphabet({"0", "1"});
+
+	EXPECT_THROW(automaton->compile(), InvalidStartStateException);
+}
+
+TEST_F(NFA_Test, Compile_MarksAutomatonCompiled) {
+	automaton->addTransition("q0", "q1", "0");
+
+	EXPECT_FALSE(automaton->isCompiled());
+	automaton->compile();
+	EXPECT_TRUE(automaton->isCompiled());
+}
+
+TEST_F(NFA_Test, Compile_InvalidatedByDefinitionChanges) {
+	automaton->compile();
+	automaton->addTransition("q0", "q1", "");
+	EXPECT_FALSE(automaton->isCompiled());
+
+	automaton->compile();
+	automaton->addAcceptState("q1");
+	EXPECT_FALSE(automaton->isCompiled());
+
+	automaton->compile();
+	automaton->setStartState("q1");
+	EXPECT_FALSE(automaton->isCompiled());
+}
+
+TEST_F(NFA_Test, Compile_SimulateMatchesInterpreted) {
+	automaton->addState("q2");
+	automaton->addState("q3");
+	automaton->addAcceptState("q3");
+
+	automaton->addTransition("q0", "q0", "0");
+	automaton->addTransition("q0", "q0", "1");
+	automaton->addTransition("q0", "q1", "1");
+	automaton->addTransition("q1", "q2", "0");
+	automaton->addTransition("q1", "q2", "");
+	automaton->addTransition("q2", "q1", "");
+	automaton->addTransition("q2", "q3", "1");
+	automaton->addTransition("q3", "q3", "0");
+
+	std::vector<std::vector<std::string>> inputs = {{},         {"1"},      {"1", "1"}, {"1", "0", "1"},
+	                                                {"0", "0"}, {"1", "", "1"}, {"1", "1", "0"}, {"x"}};
+
+	std::vector<bool> expected;
+	for (const auto &input : inputs) {
+		expected.push_back(automaton->simulate(input));
+	}
+
+	automaton->compile();
+	for (size_t i = 0; i < inputs.size(); i++) {
+		EXPECT_EQ(automaton->simulate(inputs[i]), expected[i]);
+	}
+}
+
+TEST_F(NFA_Test, Compile_SimulateAcceptsInputLongerThanSimulationDepth) {
+	automaton->addTransition("q0", "q1", "0");
+	automaton->addTransition("q1", "q0", "");
+	automaton->addAcceptState("q1");
+	automaton->compile();
+
+	std::vector<std::string> input(200, "0");
+
+	EXPECT_TRUE(automaton->simulate(input, 10));
+}
+
+TEST_F(NFA_Test, Compile_SimulateUsesCurrentDefinitionAfterChange) {
+	automaton->addTransition("q0", "q1", "0");
+	automaton->addAcceptState("q1");
+	automaton->compile();
+	EXPECT_TRUE(automaton->simulate({"0"}));
+
+	automaton->removeAcceptState("q1");
+	EXPECT_FALSE(automaton->simulate({"0"}));
+}
+
+TEST_F(NFA_Test, ToDFA_ThrowsWithoutStartState) {
+	NonDeterministicFiniteAutomaton *automaton = new NonDeterministicFiniteAutomaton();
+	automaton->setInputAlphabet({"0", "1"});
+
+	EXPECT_THROW(automaton->toDFA(), InvalidStartStateException);
+}
+
+TEST_F(NFA_Test, ToDFA_AcceptsSameInputs) {
+	automaton->addState("q2");
+	automaton->addState("q3");
+	automaton->addAcceptState("q3");
+
+	automaton->addTransition("q0", "q0", "0");
+	automaton->addTransition("q0", "q0", "1");
+	automaton->addTransition("q0", "q1", "1");
+	automaton->addTransition("q1", "q2", "0");
+	automaton->addTransition("q1", "q2", "");
+	automaton->addTransition("q2", "q3", "1");
+	automaton->addTransition("q3", "q3", "0");
+
+	DeterministicFiniteAutomaton dfa = automaton->toDFA();
+	EXPECT_EQ(dfa.getStartState(), "{q0}");
+
+	std::vector<std::vector<std::string>> inputs = {{},         {"1"},           {"1", "1"},      {"1", "0", "1"},
+	                                                {"0", "0"}, {"0", "1", "1"}, {"1", "1", "0"}, {"1", "0", "0"}};
+	for (const auto &input : inputs) {
+		EXPECT_EQ(dfa.simulate(input), automaton->simulate(input));
+	}
+}
+
+TEST_F(NFA_Test, ToDFA_ThrowsIfStateCapExceeded) {
+	// Accepts inputs whose third symbol from the end is 1, which needs 8 DFA states
+	automaton->addState("q2");
+	automaton->addState("q3");
+	automaton->addAcceptState("q3");
+
+	automaton->addTransition("q0", "q0", "0");
+	automaton->addTransition("q0", "q0", "1");
+	automaton->addTransition("q0", "q1", "1");
+	automaton->addTransition("q1", "q2", "0");
+	automaton->addTransition("q1", "q2", "1");
+	automaton->addTransition("q2", "q3", "0");
+	automaton->addTransition("q2", "q3", "1");
+
+	EXPECT_THROW(automaton->toDFA(7), InvalidAutomatonDefinitionException);
+	EXPECT_EQ(automaton->toDFA(8).getStates().size(), 8);
+}
+
+TEST_F(NFA_Test, LazyDFA_SimulateMatchesInterpreted) {
+	automaton->addState("q2");
+	automaton->addState("q3");
+	automaton->addAcceptState("q3");
+
+	automaton->addTransition("q0", "q0", "0");
+	automaton->addTransition("q0", "q0", "1");
+	automaton->addTransition("q0", "q1", "1");
+	automaton->addTransition("q1", "q2", "0");
+	automaton->addTransition("q1", "q2", "");
+	automaton->addTransition("q2", "q1", "");
+	automaton->addTransition("q2", "q3", "1");
+	automaton->addTransition("q3", "q3", "0");
+
+	std::vector<std::vector<std::string>> inputs = {{},         {"1"},      {"1", "1"}, {"1", "0", "1"},
+	                                                {"0", "0"}, {"1", "1", "0"}, {"x"}};
+
+	std::vector<bool> expected;
+	for (const auto &input : inputs) {
+		expected.push_back(automaton->simulate(input));
+	}
+
+	automaton->enableLazyDFA();
+	EXPECT_TRUE(automaton->isLazyDFAEnabled());
+	// The second pass runs over the states cached by the first
+	for (int pass = 0; pass < 2; pass++) {
+		for (size_t i = 0; i < inputs.size(); i++) {
+			EXPECT_EQ(automaton->simulate(inputs[i]), expected[i]);
+		}
+	}
+	EXPECT_GT(automaton->getLazyDFAStateCount(), 0);
+}
+
+TEST_F(NFA_Test, LazyDFA_FlushesWhenBudgetExceeded) {
+	// Accepts inputs whose third symbol from the end is 1, which needs 8 DFA states
+	automaton->addState("q2");
+	automaton->addState("q3");
+	automaton->addAcceptState("q3");
+
+	automaton->addTransition("q0", "q0", "0");
+	automaton->addTransition("q0", "q0", "1");
+	automaton->addTransition("q0", "q1", "1");
+	automaton->addTransition("q1", "q2", "0");
+	automaton->addTransition("q1", "q2", "1");
+	automaton->addTransition("q2", "q3", "0");
+	automaton->addTransition("q2", "q3", "1");
+
+	automaton->enableLazyDFA(0);
+
+	EXPECT_TRUE(automaton->simulate({"0", "1", "1", "0", "1", "0", "0"}));
+	EXPECT_FALSE(automaton->simulate({"1", "1", "0", "1", "0", "0", "0"}));
+	EXPECT_GT(automaton->getLazyDFAFlushCount(), 0);
+	EXPECT_LE(automaton->getLazyDFAStateCount(), 3);
+}
+
+TEST_F(NFA_Test, LazyDFA_UsesCurrentDefinitionAfterChange) {
+	automaton->addTransition("q0", "q1", "0");
+	automaton->addAcceptState("q1");
+	automaton->enableLazyDFA();
+	EXPECT_TRUE(automaton->simulate({"0"}));
+
+	automaton->removeAcceptState("q1");
+	EXPECT_FALSE(automaton->simulate({"0"}));
+
+	automaton->disableLazyDFA();
+	EXPECT_FALSE(automaton->isLazyDFAEnabled());
+	EXPECT_EQ(automaton->getLazyDFAStateCount(), 0);
+}
+
+TEST_F(NFA_Test, SimulateBatch_MatchesSimulate) {
+	automaton->addState("q2");
+	automaton->addAcceptState("q2");
+
+	automaton->addTransition("q0", "q0", "0");
+	automaton->addTransition("q0", "q0", "1");
+	automaton->addTransition("q0", "q1", "1");
+	automaton->addTransition("q1", "q2", "");
+
+	std::vector<std::vector<std::string>> inputs = {{}, {"1"}, {"0", "1"}, {"1", "0"}, {"x"}};
+	std::vector<bool> expected;
+	for (const auto &input : inputs) {
+		expected.push_back(automaton->simulate(input));
+	}
+
+	EXPECT_EQ(automaton->simulateBatch(inputs), expected);
+	automaton->compile();
+	EXPECT_EQ(automaton->simulateBatch(inputs), expected);
+	automaton->enableLazyDFA();
+	EXPECT_EQ(automaton->simulateBatch(inputs), expected);
+}
+
+TEST_F(NFA_Test, SimulateBatchParallel_MatchesSimulateBatch) {
+	automaton->addState("q2");
+	automaton->addAcceptState("q2");
+
+	automaton->addTransition("q0", "q0", "0");
+	automaton->addTransition("q0", "q0", "1");
+	automaton->addTransition("q0", "q1", "1");
+	automaton->addTransition("q1", "q2", "");
+
+	// Inputs of very different lengths, so workers finishing early have to steal
+	std::vector<std::vector<std::string>> inputs;
+	for (int i = 0; i < 200; i++) {
+		std::vector<std::string> input;
+		for (int j = 0; j < (i % 10 == 0 ? 200 : i % 7); j++) {
+			input.push_back(j % 2 == 0 ? "0" : "1");
+		}
+		inputs.push_back(input);
+	}
+
+	std::vector<bool> expected = automaton->simulateBatch(inputs, 500);
+	EXPECT_EQ(automaton->simulateBatchParallel(inputs, 4, 500), expected);
+	automaton->compile();
+	EXPECT_EQ(automaton->simulateBatchParallel(inputs, 4, 500), expected);
+	automaton->enableLazyDFA();
+	EXPECT_EQ(automaton->simulateBatchParallel(inputs, 4, 500), expected);
+}
+
+TEST_F(NFA_Test, GetTransitionsOnInput_KeepsEpsilonTransitionsApart) {
+	automaton->addTransition("q0", "q1", "");
+	automaton->addTransition("q0", "q1", "0");
+	automaton->addTransition("q0", "q0", "0");
+
+	FAState state = automaton->getState("q0");
+	EXPECT_EQ(state.getTransitionsOnInput(SymbolTable::EPSILON_SYMBOL_ID).size(), 1);
+	EXPECT_EQ(state.getTransitionsOnInput(SymbolTable::find("0")).size(), 2);
+	EXPECT_FALSE(state.hasTransitionOnInput(SymbolTable::find("1")));
+
+	automaton->updateStateLabel("q0", "q2");
+	state = automaton->getState("q2");
+	EXPECT_EQ(state.getTransitionsOnInput(SymbolTable::EPSILON_SYMBOL_ID)[0].getFromStateKey(), "q2");
+	EXPECT_EQ(state.getTransitionsOnInput(SymbolTable::find("0")).size(), 2);
+}
@@ -115,6 +115,21 @@ TEST_F(NPDA_Test, UpdateStateLabel_UpdatesStartStateLabel) {
 	EXPECT_TRUE(automaton->getStartState() == "q3");
 }
 
+TEST_F(NPDA_Test, UpdateStateLabel_KeepsOutgoingTransitions) {
+	automaton->addState("q2");
+	automaton->addAcceptState("q0");
+	automaton->addTransition("q2", "q0", "0", "", "");
+
+	automaton->updateStateLabel("q2", "q3");
+	automaton->setStartState("q3");
+	EXPECT_EQ(automaton->getState("q3").getTransitions().size(), 1);
+	EXPECT_TRUE(automaton->simulate({"0"}));
+
+	EXPECT_THROW(automaton->removeState("q0"), InvalidAutomatonDefinitionException);
+	automaton->removeState("q3");
+	EXPECT_NO_THROW(automaton->removeState("q0"));
+}
+
 TEST_F(NPDA_Test, GetCurrentState_GetsStartStateIfNoCurrentStateSet) {
 	EXPECT_TRUE(automaton->getCurrentState() == "q0");
 }
@@ -172,6 +187,19 @@ TEST_F(NPDA_Test, GetStates_GetsStatesAfterAddStateCall) {
 	EXPECT_TRUE(foundQ3);
 }
 
+TEST_F(NPDA_Test, UpdateStateLabel_UpdatesTransitionsToState) {
+	automaton->addTransition("q0", "q1", "0", "Z", "A");
+	automaton->updateStateLabel("q1", "q3");
+	EXPECT_TRUE(automaton->getState("q0").transitionExists(
+	    PDATransition::generateTransitionKey("q0", "q3", "0", "Z", "A")));
+	EXPECT_FALSE(automaton->getState("q0").transitionExists(
+	    PDATransition::generateTransitionKey("q0", "q1", "0", "Z", "A")));
+
+	EXPECT_THROW(automaton->removeState("q3"), InvalidAutomatonDefinitionException);
+	automaton->removeState("q3", false);
+	EXPECT_TRUE(automaton->getState("q0").getTransitions().empty());
+}
+
 TEST_F(NPDA_Test, GetStates_GetsStatesAfterUpdateStateLabelCall) {
 	automaton->updateStateLabel("q0", "q3");
 	std::vector<PDAState> states = automaton->getStates();
@@ -1133,4 +1161,277 @@ TEST_F(NPDA_Test, Simulate_ShouldThrowExceptionForSimulationWithoutStartState) {
 	automaton->setInputAlphabet({"0", "1"});
 
 	EXPECT_THROW(automaton->simulate({""}), InvalidStartStateException);
-}
\ No newline at end of file
+}
+TEST_F(NPDA_Test, Simulate_FollowsStackNeutralEpsilonCyclesWithoutUsingDepth) {
+	automaton->addState("q2");
+	automaton->addState("q3");
+	automaton->addAcceptState("q3");
+
+	automaton->addTransition("q0", "q1", "", "", "");
+	automaton->addTransition("q1", "q0", "", "", "");
+	automaton->addTransition("q1", "q2", "", "", "");
+	automaton->addTransition("q2", "q3", "1", "Z", "A");
+
+	EXPECT_TRUE(automaton->simulate({"1"}, 1));
+	EXPECT_FALSE(automaton->simulate({"1", "1"}, 1));
+}
+
+TEST_F(NPDA_Test, Simulate_UsesCurrentEpsilonTransitionsAfterChange) {
+	automaton->addAcceptState("q1");
+	EXPECT_FALSE(automaton->simulate({}));
+
+	automaton->addTransition("q0", "q1", "", "", "");
+	EXPECT_TRUE(automaton->simulate({}));
+
+	automaton->removeTransition(PDATransition::generateTransitionKey("q0", "q1", "", "", ""));
+	EXPECT_FALSE(automaton->simulate({}));
+}
+
+TEST_F(NPDA_Test, SimulateBatch_MatchesSimulate) {
+	automaton->addState("q2");
+	automaton->addState("q3");
+	automaton->addAcceptState("q3");
+	automaton->addStackAlphabet({"0", "1"});
+
+	automaton->addTransition("q0", "q1", "", "", "Z");
+
+	automaton->addTransition("q1", "q1", "0", "", "0");
+	automaton->addTransition("q1", "q1", "1", "", "1");
+	automaton->addTransition("q1", "q2", "", "", "");
+
+	automaton->addTransition("q2", "q2", "0", "0", "");
+	automaton->addTransition("q2", "q2", "1", "1", "");
+	automaton->addTransition("q2", "q3", "", "Z", "");
+
+	std::vector<std::vector<std::string>> inputs = {{"0", "1", "1", "0"}, {"0", "1", "0", "0"}, {}, {"1", "1"}};
+	std::vector<bool> expected;
+	for (const auto &input : inputs) {
+		expected.push_back(automaton->simulate(input));
+	}
+
+	EXPECT_TRUE(expected[0]);
+	EXPECT_FALSE(expected[1]);
+	EXPECT_EQ(automaton->simulateBatch(inputs), expected);
+}
+
+TEST_F(NPDA_Test, SimulateBatchParallel_MatchesSimulateBatch) {
+	automaton->addState("q2");
+	automaton->addState("q3");
+	automaton->addAcceptState("q3");
+	automaton->addStackAlphabet({"0", "1"});
+
+	automaton->addTransition("q0", "q1", "", "", "Z");
+
+	automaton->addTransition("q1", "q1", "0", "", "0");
+	automaton->addTransition("q1", "q1", "1", "", "1");
+	automaton->addTransition("q1", "q2", "", "", "");
+
+	automaton->addTransition("q2", "q2", "0", "0", "");
+	automaton->addTransition("q2", "q2", "1", "1", "");
+	automaton->addTransition("q2", "q3", "", "Z", "");
+
+	std::vector<std::vector<std::string>> sample = {{"0", "1", "1", "0"}, {"0", "1", "0", "0"}, {}, {"1", "1"}};
+	std::vector<std::vector<std::string>> inputs;
+	for (int i = 0; i < 50; i++) {
+		inputs.insert(inputs.end(), sample.begin(), sample.end());
+	}
+
+	EXPECT_EQ(automaton->simulateBatchParallel(inputs, 4), automaton->simulateBatch(inputs));
+}
+
+TEST_F(NPDA_Test, Freeze_MatchesSimulate) {
+	automaton->addState("q2");
+	automaton->addState("q3");
+	automaton->addAcceptState("q3");
+	automaton->addStackAlphabet({"0", "1"});
+
+	automaton->addTransition("q0", "q1", "", "", "Z");
+
+	automaton->addTransition("q1", "q1", "0", "", "0");
+	automaton->addTransition("q1", "q1", "1", "", "1");
+	automaton->addTransition("q1", "q2", "", "", "");
+
+	automaton->addTransition("q2", "q2", "0", "0", "");
+	automaton->addTransition("q2", "q2", "1", "1", "");
+	automaton->addTransition("q2", "q3", "", "Z", "");
+
+	std::vector<std::vector<std::string>> inputs = {
+	    {"0", "1", "1", "0"}, {"0", "1", "0", "0"}, {}, {"1", "1"}, {"1", "0", "0", "1", "1", "0"}, {"1"}};
+	FrozenNPDA frozen = automaton->freeze();
+
+	EXPECT_EQ(frozen.getStartState(), "q0");
+	EXPECT_EQ(frozen.getStateCount(), 4);
+	for (const auto &input : inputs) {
+		EXPECT_EQ(frozen.simulate(input), automaton->simulate(input));
+	}
+	EXPECT_EQ(frozen.simulateBatch(inputs), automaton->simulateBatch(inputs));
+	EXPECT_EQ(frozen.simulateBatchParallel(inputs, 4), automaton->simulateBatch(inputs));
+}
+
+TEST_F(NPDA_Test, GetStatesView_MatchesGetStates) {
+	automaton->addTransition("q0", "q1", "0", "Z", "A");
+
+	EXPECT_EQ(automaton->getStatesView(), automaton->getStates());
+
+	PDAState state = automaton->getState("q0");
+	EXPECT_EQ(state.getTransitionsView(), state.getTransitions());
+	EXPECT_EQ(state.getTransitionsView().size(), 1);
+}
+
+TEST_F(NPDA_Test, GetTransitionKey_MatchesParsedKey) {
+	PDAState state("q0");
+	state.addTransition("q1", "0", "Z", "A");
+
+	PDATransition transition = state.getTransitions()[0];
+	EXPECT_EQ(transition.getTransitionKey(), PDATransition::parseTransitionKey(transition.getKey()));
+	EXPECT_EQ(PDATransition::generateTransitionKey(transition.getTransitionKey()), transition.getKey());
+
+	state.setTransitionPushSymbol(transition.getKey(), "B");
+	EXPECT_FALSE(state.transitionExists(transition.getTransitionKey()));
+	EXPECT_TRUE(state.transitionExists(PDATransition::generateTransitionKey("q0", "q1", "0", "Z", "B")));
+}
+
+TEST_F(NPDA_Test, GetCandidateTransitions_GroupsEpsilonVariantsOnce) {
+	automaton->addTransition("q0", "q1", "0", "Z", "A");
+	automaton->addTransition("q0", "q1", "0", "", "A");
+	automaton->addTransition("q0", "q0", "", "Z", "");
+	automaton->addTransition("q0", "q0", "", "", "A");
+
+	PDAState state = automaton->getState("q0");
+	const auto candidates = state.getCandidateTransitions(SymbolTable::find("0"), SymbolTable::find("Z"));
+	for (const auto *transitions : candidates) {
+		EXPECT_EQ(transitions->size(), 1);
+	}
+	EXPECT_EQ(candidates[0]->front().getStackSymbol(), "Z");
+	EXPECT_EQ(candidates[3]->front().getPushSymbol(), "A");
+
+	// Once the input is consumed only the epsilon input groups remain, each returned once
+	std::size_t count = 0;
+	const SymbolId stackTop = SymbolTable::find("Z");
+	for (const auto *transitions : state.getCandidateTransitions(SymbolTable::EPSILON_SYMBOL_ID, stackTop)) {
+		count += transitions->size();
+	}
+	EXPECT_EQ(count, 2);
+
+	automaton->removeTransition(PDATransition::generateTransitionKey("q0", "q1", "0", "Z", "A"));
+	EXPECT_TRUE(automaton->getState("q0").getTransitionsOn(SymbolTable::find("0"), SymbolTable::find("Z")).empty());
+}
+
+TEST_F(NPDA_Test, GetPushSymbolIds_FollowsPushSymbol) {
+	PDATransition transition("q0", "q1", "0", "Z", "A,,Z");
+	EXPECT_EQ(transition.getPushSymbolIds(), SymbolTable::intern(std::vector<std::string>{"A", "Z"}));
+
+	transition.setPushSymbol("");
+	EXPECT_TRUE(transition.getPushSymbolIds().empty());
+
+	PDATransition copy = PDATransition("q0", "q1", "0", "Z", "Z");
+	copy = transition;
+	EXPECT_TRUE(copy.getPushSymbolIds().empty());
+}
+
+TEST_F(NPDA_Test, StackPool_SharesEqualStacks) {
+	StackPool stacks;
+	const SymbolId a = SymbolTable::intern("A");
+	const SymbolId z = SymbolTable::intern("Z");
+
+	StackPool::StackId bottom = stacks.push(StackPool::EMPTY_STACK, z);
+	StackPool::StackId first = stacks.push(bottom, std::vector<SymbolId>{a, a});
+	StackPool::StackId second = stacks.push(stacks.push(bottom, a), a);
+
+	EXPECT_EQ(first, second);
+	EXPECT_EQ(stacks.getNodeCount(), 4);
+	EXPECT_EQ(stacks.size(first), 3);
+	EXPECT_EQ(stacks.top(first), a);
+	EXPECT_EQ(stacks.pop(stacks.pop(first)), bottom);
+	EXPECT_EQ(stacks.toVector(first), (std::vector<SymbolId>{z, a, a}));
+	EXPECT_EQ(stacks.top(StackPool::EMPTY_STACK), SymbolTable::EPSILON_SYMBOL_ID);
+	EXPECT_TRUE(stacks.empty(stacks.pop(bottom)));
+}
+
+TEST_F(NPDA_Test, Simulate_AcceptsDeeplyNestedInput) {
+	automaton->addState("q2", true);
+	automaton->addTransition("q0", "q0", "0", "", "A");
+	automaton->addTransition("q0", "q1", "", "", "");
+	automaton->addTransition("q1", "q1", "1", "A", "");
+	automaton->addTransition("q1", "q2", "", "Z", "");
+
+	const std::size_t depth = 10000;
+	std::vector<std::string> input(depth, "0");
+	input.insert(input.end(), depth, "1");
+	EXPECT_TRUE(automaton->simulate(input, 3 * depth));
+	EXPECT_TRUE(automaton->freeze().simulate(input, 3 * depth));
+
+	input.pop_back();
+	EXPECT_FALSE(automaton->simulate(input, 3 * depth));
+}
+
+TEST_F(NPDA_Test, SimulateGSS_MatchesSimulate) {
+	automaton->addState("q2");
+	automaton->addState("q3");
+	automaton->addAcceptState("q3");
+	automaton->addStackAlphabet({"0", "1"});
+
+	automaton->addTransition("q0", "q1", "", "", "Z");
+
+	automaton->addTransition("q1", "q1", "0", "", "0");
+	automaton->addTransition("q1", "q1", "1", "", "1");
+	automaton->addTransition("q1", "q2", "", "", "");
+
+	automaton->addTransition("q2", "q2", "0", "0", "");
+	automaton->addTransition("q2", "q2", "1", "1", "");
+	automaton->addTransition("q2", "q3", "", "Z", "");
+
+	for (int length = 0; length <= 8; length++) {
+		for (int bits = 0; bits < (1 << length); bits++) {
+			std::vector<std::string> input;
+			for (int i = 0; i < length; i++) {
+				input.push_back((bits >> i) & 1 ? "1" : "0");
+			}
+			EXPECT_EQ(automaton->simulateGSS(input), automaton->simulate(input));
+		}
+	}
+}
+
+TEST_F(NPDA_Test, SimulateGSS_DecidesLongAmbiguousInput) {
+	automaton->addState("q2");
+	automaton->addState("q3");
+	automaton->addAcceptState("q3");
+	automaton->addStackAlphabet({"0", "1"});
+
+	// Even palindromes, guessing the middle at every position
+	automaton->addTransition("q0", "q1", "", "", "Z");
+	automaton->addTransition("q1", "q1", "0", "", "0");
+	automaton->addTransition("q1", "q1", "1", "", "1");
+	automaton->addTransition("q1", "q2", "", "", "");
+	automaton->addTransition("q2", "q2", "0", "0", "");
+	automaton->addTransition("q2", "q2", "1", "1", "");
+	automaton->addTransition("q2", "q3", "", "Z", "");
+
+	std::vector<std::string> input;
+	uint32_t seed = 12345;
+	for (int i = 0; i < 2000; i++) {
+		seed = seed * 1103515245 + 12345;
+		input.push_back((seed >> 16) & 1 ? "1" : "0");
+	}
+	const std::vector<std::string> reversed(input.rbegin(), input.rend());
+	input.insert(input.end(), reversed.begin(), reversed.end());
+	EXPECT_TRUE(automaton->simulateGSS(input));
+
+	input[1000] = input[1000] == "0" ? "1" : "0";
+	EXPECT_FALSE(automaton->simulateGSS(input));
+}
+
+TEST_F(NPDA_Test, SimulateGSS_PushesSymbolsInOrder) {
+	automaton->addState("q2", true);
+
+	// 0^n 1^2n, each 0 pushes two symbols
+	automaton->addTransition("q0", "q0", "0", "", "A,A");
+	automaton->addTransition("q0", "q1", "", "", "");
+	automaton->addTransition("q1", "q1", "1", "A", "");
+	automaton->addTransition("q1", "q2", "", "Z", "");
+
+	EXPECT_TRUE(automaton->simulateGSS({"0", "0", "1", "1", "1", "1"}));
+	EXPECT_TRUE(automaton->simulateGSS({}));
+	EXPECT_FALSE(automaton->simulateGSS({"0", "0", "1", "1", "1"}));
+	EXPECT_FALSE(automaton->simulateGSS({"0", "1", "1", "1"}));
+}
@@ -115,6 +115,21 @@ TEST_F(NTM_Test, UpdateStateLabel_UpdatesStartStateLabel) {
 	EXPECT_TRUE(automaton->getStartState() == "q3");
 }
 
+TEST_F(NTM_Test, UpdateStateLabel_KeepsOutgoingTransitions) {
+	automaton->addState("q2");
+	automaton->addAcceptState("q0");
+	automaton->addTransition("q2", "q0", "0", "A", TMDirection::RIGHT);
+
+	automaton->updateStateLabel("q2", "q3");
+	automaton->setStartState("q3");
+	EXPECT_EQ(automaton->getState("q3").getTransitions().size(), 1);
+	EXPECT_TRUE(automaton->simulate({"0"}));
+
+	EXPECT_THROW(automaton->removeState("q0"), InvalidAutomatonDefinitionException);
+	automaton->removeState("q3");
+	EXPECT_NO_THROW(automaton->removeState("q0"));
+}
+
 TEST_F(NTM_Test, GetCurrentState_GetsStartStateIfNoCurrentStateSet) {
 	EXPECT_TRUE(automaton->getCurrentState() == "q0");
 }
@@ -898,6 +913,19 @@ TEST_F(NTM_Test, RemoveTransition_RemovesValidTransition) {
 	EXPECT_FALSE(automaton->getState("q0").transitionExists(transitionKey));
 }
 
+TEST_F(NTM_Test, RemoveTransition_HandlesStateLabelsContainingDelimiter) {
+	automaton->addState("a-b");
+	automaton->addTransition("q0", "a-b", "0", "A", TMDirection::RIGHT);
+
+	std::string transitionKey = TMTransition::generateTransitionKey("q0", "a-b", "0", "A", TMDirection::RIGHT);
+	EXPECT_EQ(TMTransition::getToStateFromKey(transitionKey), "a-b");
+	EXPECT_EQ(TMTransition::getDirectionFromKey(transitionKey), TMDirection::RIGHT);
+
+	automaton->removeTransition(transitionKey);
+	EXPECT_FALSE(automaton->getState("q0").transitionExists(transitionKey));
+	EXPECT_NO_THROW(automaton->removeState("a-b"));
+}
+
 TEST_F(NTM_Test, RemoveTransition_ThrowsIfTransitionNotFound) {
 	std::string invalidTransitionKey = TMTransition::generateTransitionKey("q0", "q1", "0", "A", TMDirection::STAY);
 
@@ -1194,4 +1222,216 @@ TEST_F(NTM_Test, Simulate_InvalidInputReject) {
 	automaton->addTransition("q3", "q0", "", "", TMDirection::RIGHT);
 
 	EXPECT_FALSE(automaton->simulate({}));
-}
\ No newline at end of file
+}
+
+TEST_F(NTM_Test, SimulateBatch_MatchesSimulate) {
+	automaton->addState("q2", false);
+	automaton->addState("q3", false);
+	automaton->addState("q4", false);
+	automaton->addState("q_reject", false);
+	automaton->addState("q_accept", true);
+
+	automaton->addInputAlphabet({"0", "X", "_"});
+
+	automaton->addTransition("q0", "q_reject", "", "", TMDirection::RIGHT);
+	automaton->addTransition("q0", "q_reject", "X", "", TMDirection::RIGHT);
+	automaton->addTransition("q0", "q1", "0", "", TMDirection::RIGHT);
+
+	automaton->addTransition("q1", "q1", "X", "", TMDirection::RIGHT);
+	automaton->addTransition("q1", "q2", "0", "X", TMDirection::RIGHT);
+	automaton->addTransition("q1", "q_accept", "", "", TMDirection::RIGHT);
+
+	automaton->addTransition("q4", "q4", "0", "", TMDirection::LEFT);
+	automaton->addTransition("q4", "q4", "X", "", TMDirection::LEFT);
+	automaton->addTransition("q4", "q1", "", "", TMDirection::RIGHT);
+
+	automaton->addTransition("q2", "q4", "", "", TMDirection::LEFT);
+	automaton->addTransition("q2", "q2", "X", "", TMDirection::RIGHT);
+	automaton->addTransition("q2", "q3", "0", "", TMDirection::RIGHT);
+
+	automaton->addTransition("q3", "q2", "0", "X", TMDirection::RIGHT);
+	automaton->addTransition("q3", "q3", "X", "", TMDirection::RIGHT);
+	automaton->addTransition("q3", "q0", "", "", TMDirection::RIGHT);
+
+	std::vector<std::vector<std::string>> inputs = {{"0", "0", "0", "0"}, {}, {"0"}, {"X", "0"}};
+	std::vector<bool> expected;
+	for (const auto &input : inputs) {
+		expected.push_back(automaton->simulate(input));
+	}
+
+	EXPECT_TRUE(expected[0]);
+	EXPECT_FALSE(expected[1]);
+	EXPECT_EQ(automaton->simulateBatch(inputs), expected);
+}
+
+TEST_F(NTM_Test, SimulateBatchParallel_MatchesSimulateBatch) {
+	automaton->addState("q2", false);
+	automaton->addState("q3", false);
+	automaton->addState("q4", false);
+	automaton->addState("q_reject", false);
+	automaton->addState("q_accept", true);
+
+	automaton->addInputAlphabet({"0", "X", "_"});
+
+	automaton->addTransition("q0", "q_reject", "", "", TMDirection::RIGHT);
+	automaton->addTransition("q0", "q_reject", "X", "", TMDirection::RIGHT);
+	automaton->addTransition("q0", "q1", "0", "", TMDirection::RIGHT);
+
+	automaton->addTransition("q1", "q1", "X", "", TMDirection::RIGHT);
+	automaton->addTransition("q1", "q2", "0", "X", TMDirection::RIGHT);
+	automaton->addTransition("q1", "q_accept", "", "", TMDirection::RIGHT);
+
+	automaton->addTransition("q4", "q4", "0", "", TMDirection::LEFT);
+	automaton->addTransition("q4", "q4", "X", "", TMDirection::LEFT);
+	automaton->addTransition("q4", "q1", "", "", TMDirection::RIGHT);
+
+	automaton->addTransition("q2", "q4", "", "", TMDirection::LEFT);
+	automaton->addTransition("q2", "q2", "X", "", TMDirection::RIGHT);
+	automaton->addTransition("q2", "q3", "0", "", TMDirection::RIGHT);
+
+	automaton->addTransition("q3", "q2", "0", "X", TMDirection::RIGHT);
+	automaton->addTransition("q3", "q3", "X", "", TMDirection::RIGHT);
+	automaton->addTransition("q3", "q0", "", "", TMDirection::RIGHT);
+
+	std::vector<std::vector<std::string>> sample = {{"0", "0", "0", "0"}, {}, {"0"}, {"X", "0"}};
+	std::vector<std::vector<std::string>> inputs;
+	for (int i = 0; i < 50; i++) {
+		inputs.insert(inputs.end(), sample.begin(), sample.end());
+	}
+
+	EXPECT_EQ(automaton->simulateBatchParallel(inputs, 4), automaton->simulateBatch(inputs));
+}
+
+TEST(TMTape_Test, GetFingerprint_FollowsWritesAndMoves) {
+	TMTape contiguous;
+	TMTape runLength("_", TMTapeMode::RUN_LENGTH);
+	contiguous.loadInput(std::vector<std::string>{"A", "Z"});
+	runLength.loadInput(std::vector<std::string>{"A", "Z"});
+
+	const std::vector<std::string> symbols = {"A", "Z", "_"};
+	uint32_t seed = 11;
+	for (int i = 0; i < 500; i++) {
+		seed = seed * 1103515245 + 12345;
+		const uint32_t choice = (seed >> 16) % 7;
+		if (choice < 3) {
+			contiguous.write(symbols[choice]);
+			runLength.write(symbols[choice]);
+		} else if (choice < 5) {
+			contiguous.moveLeft();
+			runLength.moveLeft();
+		} else {
+			contiguous.moveRight();
+			runLength.moveRight();
+		}
+
+		// A tape built from scratch with the same cells has the same fingerprint
+		TMTape rebuilt;
+		rebuilt.setTape(contiguous.getTape());
+		rebuilt.setHeadPosition(contiguous.getHeadPosition());
+		ASSERT_EQ(contiguous.getFingerprint(), rebuilt.getFingerprint());
+		ASSERT_EQ(runLength.getFingerprint(), contiguous.getFingerprint());
+	}
+
+	const uint64_t fingerprint = contiguous.getFingerprint();
+	contiguous.setHeadPosition(contiguous.getHeadPosition() + 1);
+	EXPECT_NE(contiguous.getFingerprint(), fingerprint);
+}
+
+TEST(TMConfigurationSet_Test, Insert_InsertsEachConfigurationOnce) {
+	TMConfigurationSet configurations;
+	const SymbolId q0 = SymbolTable::intern("q0");
+	const SymbolId q1 = SymbolTable::intern("q1");
+
+	TMTape tape;
+	tape.loadInput(std::vector<std::string>{"A", "Z"});
+	EXPECT_TRUE(configurations.insert(q0, tape));
+	EXPECT_FALSE(configurations.insert(q0, tape));
+	EXPECT_TRUE(configurations.insert(q1, tape));
+
+	tape.moveRight();
+	const TMTape moved = tape;
+	EXPECT_FALSE(configurations.contains(q0, moved));
+	EXPECT_TRUE(configurations.insert(q0, moved));
+
+	// Enough tapes to make the table grow several times
+	for (int i = 0; i < 1000; i++) {
+		tape.setHeadPosition(i);
+		configurations.insert(q1, tape);
+	}
+	EXPECT_EQ(configurations.size(), 1002);
+	EXPECT_TRUE(configurations.contains(q0, moved));
+
+	configurations.clear();
+	EXPECT_EQ(configurations.size(), 0);
+	EXPECT_FALSE(configurations.contains(q0, moved));
+}
+
+TEST(TMTape_Test, SetMode_ChunkedTapeMatchesContiguousTape) {
+	TMTape contiguous;
+	TMTape chunked("_", TMTapeMode::CHUNKED);
+	contiguous.loadInput(std::vector<std::string>{"A", "Z", "A"});
+	chunked.loadInput(std::vector<std::string>{"A", "Z", "A"});
+
+	// Jumps of the head cross chunk boundaries, so the tape spans several chunks
+	const std::vector<std::string> symbols = {"A", "Z", "_"};
+	uint32_t seed = 5;
+	for (int i = 0; i < 2000; i++) {
+		seed = seed * 1103515245 + 12345;
+		const uint32_t choice = (seed >> 16) % 9;
+		if (choice < 3) {
+			contiguous.write(symbols[choice]);
+			chunked.write(symbols[choice]);
+		} else if (choice < 5) {
+			contiguous.moveLeft();
+			chunked.moveLeft();
+		} else if (choice < 8) {
+			contiguous.moveRight();
+			chunked.moveRight();
+		} else {
+			const int position = static_cast<int>((seed >> 8) % 300);
+			contiguous.setHeadPosition(position);
+			chunked.setHeadPosition(position);
+		}
+
+		ASSERT_EQ(chunked.read(), contiguous.read());
+		ASSERT_EQ(chunked.getSize(), contiguous.getSize());
+		ASSERT_EQ(chunked.getFingerprint(), contiguous.getFingerprint());
+	}
+
+	EXPECT_EQ(chunked.getTape(), contiguous.getTape());
+	EXPECT_EQ(chunked.toString(), contiguous.toString());
+	EXPECT_EQ(chunked.hash(), contiguous.hash());
+	EXPECT_EQ(chunked.getRunCount(), contiguous.getRunCount());
+	EXPECT_TRUE(chunked == contiguous);
+
+	chunked.setMode(TMTapeMode::CONTIGUOUS);
+	EXPECT_EQ(chunked.getTape(), contiguous.getTape());
+	EXPECT_EQ(chunked.getHeadPosition(), contiguous.getHeadPosition());
+}
+
+TEST(TMTape_Test, Copy_ChunkedCopiesWriteIndependently) {
+	TMTape original("_", TMTapeMode::CHUNKED);
+	original.loadInput(std::vector<std::string>(200, "A"));
+
+	TMTape copy = original;
+	EXPECT_TRUE(copy == original);
+
+	copy.setHeadPosition(130);
+	copy.write("Z");
+	original.setHeadPosition(130);
+	EXPECT_EQ(original.read(), "A");
+	EXPECT_EQ(copy.read(), "Z");
+	original.setHeadPosition(0);
+	EXPECT_FALSE(copy == original);
+
+	// Writing the same cell back makes the tapes equal again, though they no longer share that chunk
+	copy.write("A");
+	copy.setHeadPosition(0);
+	EXPECT_TRUE(copy == original);
+	EXPECT_EQ(copy.getFingerprint(), original.getFingerprint());
+
+	copy.setBlankSymbol("B");
+	copy.setHeadPosition(250);
+	EXPECT_EQ(copy.read(), "B");
+	EXPECT_EQ(original.getSize(), 200);
+}
@@ -14,6 +14,7 @@
 
 #include "AutomataSimulator/DeterministicTuringMachine.h"
 #include "AutomataSimulator/NonDeterministicTuringMachine.h"
+#include "AutomataSimulator/TMConfigurationSet.h"
 #include "AutomataSimulator/TMDirection.h"
 #include "AutomataSimulator/TMState.h"
 #include "AutomataSimulator/TMTransition.h"
@@ -0,0 +1,46 @@
+#pragma once
+#include "config.h"
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+/**
+ * @brief Runs independent tasks over a range of indices on a pool of worker threads.
+ * Each worker starts with an even share of the range and takes indices from the front of it in small chunks. A worker
+ * that runs out of indices steals the back half of the largest remaining share, so batches with skewed input lengths
+ * still keep every worker busy until the end.
+ */
+class AUTOMATASIMULATOR_API BatchExecutor {
+  public:
+	/**
+	 * @brief Resolves the number of workers to run a batch with.
+	 * @param threadCount The requested number of workers, 0 to use the hardware concurrency.
+	 * @param taskCount The number of tasks in the batch.
+	 * @return The number of workers, at least 1 and at most the number of tasks.
+	 */
+	static std::size_t resolveThreadCount(const std::size_t &threadCount, const std::size_t &taskCount);
+
+	/**
+	 * @brief Runs a task for every index in [0, taskCount).
+	 * @brief The calling thread acts as worker 0, so a single worker runs the batch without spawning any thread.
+	 * @param taskCount The number of tasks in the batch.
+	 * @param threadCount The number of workers, 0 to use the hardware concurrency.
+	 * @param task Called once per index with the index and the worker running it, so tasks can keep per-worker
+	 * scratch buffers.
+	 * @throws The first exception thrown by a task, after every worker has stopped.
+	 */
+	static void run(const std::size_t &taskCount, const std::size_t &threadCount,
+	                const std::function<void(const std::size_t &, const std::size_t &)> &task);
+
+	/**
+	 * @brief Runs a predicate for every index in [0, taskCount) and collects its results.
+	 * @param taskCount The number of tasks in the batch.
+	 * @param threadCount The number of workers, 0 to use the hardware concurrency.
+	 * @param predicate Called once per index with the index and the worker running it.
+	 * @return The result of the predicate for each index.
+	 * @throws The first exception thrown by the predicate, after every worker has stopped.
+	 */
+	static std::vector<bool>
+	runPredicate(const std::size_t &taskCount, const std::size_t &threadCount,
+	             const std::function<bool(const std::size_t &, const std::size_t &)> &predicate);
+};
@@ -0,0 +1,29 @@
+#pragma once
+#include <mutex>
+
+/**
+ * @brief Mutex owned by one automaton that guards building its simulation caches.
+ * @brief Copying or assigning an automaton does not copy the lock: each copy gets its own unlocked mutex, so automata
+ * that hold one stay copyable and movable.
+ */
+class CacheMutex {
+  public:
+	CacheMutex() = default;
+
+	CacheMutex(const CacheMutex &) {}
+
+	CacheMutex &operator=(const CacheMutex &) {
+		return *this;
+	}
+
+	void lock() {
+		mutex.lock();
+	}
+
+	void unlock() {
+		mutex.unlock();
+	}
+
+  private:
+	std::mutex mutex;
+};
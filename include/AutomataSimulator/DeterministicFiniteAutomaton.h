@@ -1,6 +1,8 @@
 #pragma once
 #include "FiniteAutomaton.h"
+#include "FrozenDFA.h"
 #include "config.h"
+#include <cstdint>
 #include <set>
 #include <vector>
 
@@ -25,7 +27,70 @@ class AUTOMATASIMULATOR_API DeterministicFiniteAutomaton : public FiniteAutomato
 	 */
 	bool checkTransitionDeterminisim(const std::string &fromStateKey, const std::string &input);
 
+	/**
+	 * @brief Dense transition table built by compile(), indexed by state id * alphabet size + symbol id.
+	 */
+	std::vector<uint32_t> compiledTransitions;
+
+	/**
+	 * @brief Accept flag of each compiled state, indexed by state id.
+	 */
+	std::vector<bool> compiledAcceptStates;
+
+	/**
+	 * @brief Column of each symbol id in the compiled table, UINT32_MAX for symbols outside the input alphabet.
+	 * @brief Indexed by symbol id up to the largest id in the alphabet, so a step is one load here and one in the table.
+	 */
+	std::vector<uint32_t> compiledSymbolColumns;
+
+	/**
+	 * @brief Number of columns in the compiled table, one per input alphabet symbol.
+	 */
+	std::size_t compiledColumnCount;
+
+	/**
+	 * @brief Id of the start state in the compiled table.
+	 */
+	uint32_t compiledStartState;
+
+	/**
+	 * @brief Definition version the compiled table was built from.
+	 */
+	std::size_t compiledVersion;
+
+	/**
+	 * @brief Builds a dense transition table with one row per numbered state and one column per numbered symbol.
+	 * @brief Shared by compile() and freeze(), which number the states and symbols differently.
+	 * @param stateRows Row of each state id, UINT32_MAX for states left out of the table.
+	 * @param rowCount The number of rows.
+	 * @param symbolColumns Column of each symbol, transitions on symbols without one are left out.
+	 * @return The table, indexed by row * column count + column, holding the row of the to state or UINT32_MAX.
+	 */
+	std::vector<uint32_t> buildTransitionTable(const std::vector<uint32_t> &stateRows, const std::size_t &rowCount,
+	                                           const std::unordered_map<SymbolId, uint32_t> &symbolColumns);
+
+	/**
+	 * @brief Simulates the automaton over the compiled table.
+	 * @param inputIds The ids of the input symbols to process.
+	 * @param simulationDepth The maximum number of transitions to simulate.
+	 * @return True if the input is accepted, false otherwise.
+	 */
+	const bool simulateCompiled(const std::vector<SymbolId> &inputIds, const int &simulationDepth) const;
+
+	/**
+	 * @brief Simulates the automaton over the state transitions, assuming the start state is set.
+	 * @param inputIds The ids of the input symbols to process.
+	 * @param simulationDepth The maximum number of transitions to simulate.
+	 * @return True if the input is accepted, false otherwise.
+	 */
+	const bool simulateInterpreted(const std::vector<SymbolId> &inputIds, const int &simulationDepth);
+
   public:
+	/**
+	 * @brief Constructs a new Deterministic Finite Automaton object.
+	 */
+	DeterministicFiniteAutomaton();
+
 	virtual ~DeterministicFiniteAutomaton() override;
 
 	/**
@@ -108,4 +173,59 @@ class AUTOMATASIMULATOR_API DeterministicFiniteAutomaton : public FiniteAutomato
 	 * @throws InvalidStartStateException If the start state is not set.
 	 */
 	const bool simulate(const std::vector<std::string> &input, const int &simulationDepth = 50) override;
+
+	/**
+	 * @brief Simulates the automaton on many inputs, checking the start state and choosing between the compiled table
+	 * and the state transitions once for the whole batch.
+	 * @param inputs The input strings to process.
+	 * @param simulationDepth The maximum number of transitions to simulate per input. Default is 50.
+	 * @return Whether each input is accepted, in order.
+	 * @throws InvalidStartStateException If the start state is not set.
+	 */
+	const std::vector<bool> simulateBatch(const std::vector<std::vector<std::string>> &inputs,
+	                                      const int &simulationDepth = 50) override;
+
+	/**
+	 * @brief Simulates the automaton on many inputs on a pool of worker threads, running over the compiled table when
+	 * it is current and over the state transitions otherwise.
+	 * @param inputs The input strings to process.
+	 * @param threadCount The number of worker threads, 0 to use the hardware concurrency. Default is 0.
+	 * @param simulationDepth The maximum number of transitions to simulate per input. Default is 50.
+	 * @return Whether each input is accepted, in order.
+	 * @throws InvalidStartStateException If the start state is not set.
+	 */
+	const std::vector<bool> simulateBatchParallel(const std::vector<std::vector<std::string>> &inputs,
+	                                              const std::size_t &threadCount = 0,
+	                                              const int &simulationDepth = 50) override;
+
+	/**
+	 * @brief Compiles the automaton into a dense transition table with integer state and symbol ids.
+	 * @brief While the compiled table is current, simulate runs over it instead of the state map.
+	 * @brief Any change to the states, transitions, start state or alphabet invalidates the table.
+	 * @throws InvalidStartStateException If the start state is not set.
+	 */
+	void compile();
+
+	/**
+	 * @brief Checks if the compiled table is built and matches the current definition.
+	 * @return True if simulate will use the compiled table.
+	 */
+	const bool isCompiled() const;
+
+	/**
+	 * @brief Builds the equivalent DFA with the minimum number of states using Hopcroft's partition refinement.
+	 * @brief Unreachable states and states that can never reach an accept state are removed, and equivalent states
+	 * are merged. Each merged state keeps the label of one of its members.
+	 * @return The minimal DFA.
+	 * @throws InvalidStartStateException If the start state is not set.
+	 */
+	DeterministicFiniteAutomaton minimize();
+
+	/**
+	 * @brief Builds an immutable snapshot of the automaton that any number of threads can simulate without locking.
+	 * @brief Later changes to the automaton do not affect the snapshot.
+	 * @return The snapshot.
+	 * @throws InvalidStartStateException If the start state is not set.
+	 */
+	FrozenDFA freeze();
 };
@@ -1,5 +1,6 @@
 #pragma once
 #include "PushdownAutomaton.h"
+#include "SimulationResult.h"
 #include "config.h"
 #include <set>
 #include <vector>
@@ -17,6 +18,16 @@ class AUTOMATASIMULATOR_API DeterministicPushdownAutomaton : public PushdownAuto
 	bool checkTransitionDeterminisim(const std::string &fromStateKey, const std::string &input,
 	                                 const std::string &stackSymbol);
 
+	/**
+	 * @brief Simulates the automaton on one input, assuming the start state is set.
+	 * @param inputIds The ids of the input symbols to process.
+	 * @param simulationDepth The maximum number of transitions to simulate.
+	 * @param initialStackSymbol The id of the symbol the stack starts with.
+	 * @return True if the input is accepted, false otherwise.
+	 */
+	bool simulateInput(const std::vector<SymbolId> &inputIds, const int &simulationDepth,
+	                   const SymbolId &initialStackSymbol);
+
   public:
 	virtual ~DeterministicPushdownAutomaton() override;
 
@@ -83,4 +94,44 @@ class AUTOMATASIMULATOR_API DeterministicPushdownAutomaton : public PushdownAuto
 	 * @throws InvalidStartStateException If the start state is not set.
 	 */
 	bool simulate(const std::vector<std::string> &input, const int &simulationDepth = 50) override;
+
+	/**
+	 * @brief Simulates the automaton on many inputs, checking the start state and translating the inputs once for
+	 * the whole batch.
+	 * @param inputs The input strings to process.
+	 * @param simulationDepth The maximum number of transitions to simulate per input. Default is 50.
+	 * @return Whether each input is accepted, in order.
+	 * @throws InvalidStartStateException If the start state is not set.
+	 */
+	std::vector<bool> simulateBatch(const std::vector<std::vector<std::string>> &inputs,
+	                                const int &simulationDepth = 50) override;
+
+	/**
+	 * @brief Simulates the automaton on many inputs on a pool of worker threads sharing the automaton.
+	 * @param inputs The input strings to process.
+	 * @param threadCount The number of worker threads, 0 to use the hardware concurrency. Default is 0.
+	 * @param simulationDepth The maximum number of transitions to simulate per input. Default is 50.
+	 * @return Whether each input is accepted, in order.
+	 * @throws InvalidStartStateException If the start state is not set.
+	 */
+	std::vector<bool> simulateBatchParallel(const std::vector<std::vector<std::string>> &inputs,
+	                                        const std::size_t &threadCount = 0,
+	                                        const int &simulationDepth = 50) override;
+
+	/**
+	 * @brief Simulates the automaton like simulate, stopping early once it halts or is found to loop.
+	 * @brief Only epsilon moves can loop, since every other move reads input. While no input is read, each move is
+	 * recorded by its state and stack top for as long as no move leaves the stack lower than it was then. Meeting a
+	 * recorded pair again means the moves in between never looked below that stack top, so they repeat forever. This
+	 * catches epsilon cycles that leave the stack unchanged as well as ones that keep pushing.
+	 * @param input The input strings to process.
+	 * @param simulationDepth The maximum number of transitions to simulate. Default is 50.
+	 * @return ACCEPTED or REJECTED once no move is left with the whole input read, depending on the state reached.
+	 * REJECTED if no move reads the next input symbol, DIVERGES if an epsilon loop is found and OUT_OF_BUDGET if the
+	 * depth runs out first. The configuration reached by the last transition the depth allows is still judged, so a
+	 * run halting exactly there is not reported out of budget.
+	 * @throws InvalidStartStateException If the start state is not set.
+	 */
+	SimulationResult simulateWithCycleDetection(const std::vector<std::string> &input,
+	                                            const int &simulationDepth = 50);
 };
@@ -1,6 +1,9 @@
 #pragma once
+#include "FrozenDTM.h"
+#include "SimulationResult.h"
 #include "TuringMachine.h"
 #include "config.h"
+#include <cstdint>
 #include <set>
 #include <vector>
 
@@ -18,6 +21,22 @@ class AUTOMATASIMULATOR_API DeterministicTuringMachine : public TuringMachine {
 	 */
 	bool checkTransitionDeterminisim(const std::string &fromStateKey, const std::string &readSymbol);
 
+	/**
+	 * @brief Simulates the machine on one input, assuming the start state is set.
+	 * @param inputIds The ids of the input symbols to load into the tape.
+	 * @param simulationDepth The maximum number of transitions to simulate.
+	 * @return True if the input is accepted, false otherwise.
+	 */
+	bool simulateInput(const std::vector<SymbolId> &inputIds, const int &simulationDepth);
+
+	/**
+	 * @brief Finds the transition the machine takes from a state on a tape symbol.
+	 * @param state The state the machine is in.
+	 * @param tapeValue The id of the symbol under the head.
+	 * @return The first transition reading the symbol or any symbol, nullptr if there is none.
+	 */
+	const TMTransition *findTransition(TMState *state, const SymbolId &tapeValue);
+
   public:
 	virtual ~DeterministicTuringMachine() override;
 
@@ -72,4 +91,64 @@ class AUTOMATASIMULATOR_API DeterministicTuringMachine : public TuringMachine {
 	 * @throws InvalidStartStateException If the start state is not set.
 	 */
 	bool simulate(const std::vector<std::string> &input, const int &simulationDepth = 50) override;
+
+	/**
+	 * @brief Simulates the machine on many inputs, checking the start state and interning the inputs once for the
+	 * whole batch.
+	 * @param inputs The input strings to process.
+	 * @param simulationDepth The maximum number of transitions to simulate per input. Default is 50.
+	 * @return Whether each input is accepted, in order.
+	 * @throws InvalidStartStateException If the start state is not set.
+	 */
+	std::vector<bool> simulateBatch(const std::vector<std::vector<std::string>> &inputs,
+	                                const int &simulationDepth = 50) override;
+
+	/**
+	 * @brief Simulates the automaton on many inputs on a pool of worker threads sharing the automaton.
+	 * @param inputs The input strings to process.
+	 * @param threadCount The number of worker threads, 0 to use the hardware concurrency. Default is 0.
+	 * @param simulationDepth The maximum number of transitions to simulate per input. Default is 50.
+	 * @return Whether each input is accepted, in order.
+	 * @throws InvalidStartStateException If the start state is not set.
+	 */
+	std::vector<bool> simulateBatchParallel(const std::vector<std::vector<std::string>> &inputs,
+	                                        const std::size_t &threadCount = 0,
+	                                        const int &simulationDepth = 50) override;
+
+	/**
+	 * @brief Simulates the automaton like simulate, stopping early once the machine is found to loop.
+	 * @brief Uses Brent's algorithm over the configurations of the run, the state, tape and head position, so a
+	 * repeated configuration is found within a few times the length of the loop, keeping only one saved configuration.
+	 * Loops that grow the tape, such as a sweep right over blanks, never repeat a configuration and run out of budget.
+	 * @param input The input strings to process.
+	 * @param simulationDepth The maximum number of transitions to simulate. Default is 50.
+	 * @return ACCEPTED if an accept state is reached, REJECTED if the machine halts elsewhere, DIVERGES if a
+	 * configuration repeats and OUT_OF_BUDGET if the depth runs out first. The configuration reached by the last
+	 * transition the depth allows is still judged, so a run halting exactly there is not reported out of budget.
+	 * @throws InvalidStartStateException If the start state is not set.
+	 */
+	SimulationResult simulateWithCycleDetection(const std::vector<std::string> &input,
+	                                            const int &simulationDepth = 50);
+
+	/**
+	 * @brief Simulates the automaton like simulate, taking each sweep of a state over a run of equal symbols as one
+	 * macro step.
+	 * @brief A transition that loops on its state and moves the head repeats on every cell of the run under the head,
+	 * so the run is rewritten and passed over at once on a run-length tape. Long repetitive runs then cost one step per
+	 * run instead of one per cell.
+	 * @param input The input strings to process.
+	 * @param simulationDepth The maximum number of transitions to simulate, as for simulate.
+	 * @param stepCount Set to the number of single transitions the simulation covered.
+	 * @return True if the input is accepted, false otherwise.
+	 * @throws InvalidStartStateException If the start state is not set.
+	 */
+	bool simulateAccelerated(const std::vector<std::string> &input, const int &simulationDepth, uint64_t &stepCount);
+
+	/**
+	 * @brief Builds an immutable snapshot of the machine that any number of threads can simulate without locking.
+	 * @brief Later changes to the machine do not affect the snapshot.
+	 * @return The snapshot.
+	 * @throws InvalidStartStateException If the start state is not set.
+	 */
+	FrozenDTM freeze();
 };
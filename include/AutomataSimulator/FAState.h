@@ -13,19 +13,14 @@
 class AUTOMATASIMULATOR_API FAState {
   private:
 	/**
-	 * @brief Unique identifier for the transition, formatted as "label".
-	 */
-	std::string key;
-
-	/**
-	 * @brief Label for the state.
+	 * @brief Label for the state, also used as its unique key.
 	 */
 	std::string label;
 
 	/**
 	 * @brief Transitions the start from the state.
 	 */
-	std::unordered_map<std::string, FATransition> transitions;
+	std::unordered_map<TransitionKey, FATransition> transitions;
 
 	/**
 	 * @brief Boolean indicating whether it is an accept state.
@@ -42,6 +37,16 @@ class AUTOMATASIMULATOR_API FAState {
 	 */
 	bool transitionsCacheInvalidated;
 
+	/**
+	 * @brief Non-epsilon transitions grouped by input symbol id, kept current on every change to the transitions.
+	 */
+	std::unordered_map<SymbolId, std::vector<FATransition>> transitionsByInput;
+
+	/**
+	 * @brief Epsilon transitions, kept apart from the other inputs so closures read them without a lookup.
+	 */
+	std::vector<FATransition> epsilonTransitions;
+
 	/**
 	 * @brief Gets the transition with the key provided.
 	 * @param key The key of the transition to get.
@@ -49,6 +54,25 @@ class AUTOMATASIMULATOR_API FAState {
 	 */
 	FATransition *getTransitionInternal(const std::string &key);
 
+	/**
+	 * @brief Gets the transition with the structured key provided.
+	 * @param key The structured key of the transition to get.
+	 * @return The transition with the specified key.
+	 */
+	FATransition *getTransitionInternal(const TransitionKey &key);
+
+	/**
+	 * @brief Adds a transition to the bucket of its input.
+	 * @param transition The transition to add.
+	 */
+	void addToInputIndex(const FATransition &transition);
+
+	/**
+	 * @brief Removes a transition from the bucket of its input, dropping the bucket once it is empty.
+	 * @param transition The transition to remove.
+	 */
+	void removeFromInputIndex(const FATransition &transition);
+
   public:
 	FAState();
 
@@ -129,13 +153,22 @@ class AUTOMATASIMULATOR_API FAState {
 	 */
 	bool transitionExists(const std::string &key) const;
 
+	/**
+	 * @brief Checks if a transition exists.
+	 * @param key The structured key of the transition.
+	 * @return Bool indicating whether the transition exists or not.
+	 */
+	bool transitionExists(const TransitionKey &key) const;
+
 	/**
 	 * @brief Adds a transition to the state's transitions vector.
 	 * @param toStateKey The to state key of the transition.
 	 * @param input The input of the transition.
+	 * @param toStateId The id of the to state in the owning automaton.
 	 * @throws InvalidTransitionException If the transition already exists.
 	 */
-	void addTransition(const std::string &toStateKey, const std::string &input);
+	void addTransition(const std::string &toStateKey, const std::string &input,
+	                   const StateId &toStateId = INVALID_STATE_ID);
 
 	/**
 	 * @brief Gets the transition with the key provided.
@@ -145,6 +178,14 @@ class AUTOMATASIMULATOR_API FAState {
 	 */
 	FATransition getTransition(const std::string &key);
 
+	/**
+	 * @brief Gets the transition with the structured key provided.
+	 * @param key The structured key of the transition to get.
+	 * @return The transition with the specified key.
+	 * @throw TransitionNotFoundException If transition is not found.
+	 */
+	FATransition getTransition(const TransitionKey &key);
+
 	/**
 	 * @brief Gets a transition input.
 	 * @param transitionKey The key of the transition.
@@ -161,6 +202,15 @@ class AUTOMATASIMULATOR_API FAState {
 	 */
 	void setTransitionInput(const std::string &transitionKey, const std::string &input);
 
+	/**
+	 * @brief Sets a transition input.
+	 * @param transitionKey The structured key of the transition.
+	 * @param input The input to set.
+	 * @throw TransitionNotFoundException If transition is not found.
+	 * @throw InvalidTransitionException If the transition already exists.
+	 */
+	void setTransitionInput(const TransitionKey &transitionKey, const std::string &input);
+
 	/**
 	 * @brief Gets a transition to state.
 	 * @param transitionKey The key of the transition.
@@ -173,10 +223,23 @@ class AUTOMATASIMULATOR_API FAState {
 	 * @brief Sets a transition to state.
 	 * @param transitionKey The key of the transition.
 	 * @param toState The key of the to state.
+	 * @param toStateId The id of the to state in the owning automaton.
+	 * @throw TransitionNotFoundException If transition is not found.
+	 * @throw InvalidTransitionException If the transition already exists.
+	 */
+	void setTransitionToState(const std::string &transitionKey, const std::string &toState,
+	                          const StateId &toStateId = INVALID_STATE_ID);
+
+	/**
+	 * @brief Sets a transition to state.
+	 * @param transitionKey The structured key of the transition.
+	 * @param toState The key of the to state.
+	 * @param toStateId The id of the to state in the owning automaton.
 	 * @throw TransitionNotFoundException If transition is not found.
 	 * @throw InvalidTransitionException If the transition already exists.
 	 */
-	void setTransitionToState(const std::string &transitionKey, const std::string &toState);
+	void setTransitionToState(const TransitionKey &transitionKey, const std::string &toState,
+	                          const StateId &toStateId = INVALID_STATE_ID);
 
 	/**
 	 * @brief Removes a transition from the state's transitions vector.
@@ -185,6 +248,13 @@ class AUTOMATASIMULATOR_API FAState {
 	 */
 	void removeTransition(const std::string &transitionKey);
 
+	/**
+	 * @brief Removes a transition from the state's transitions vector.
+	 * @param transitionKey The structured key of the transition.
+	 * @throws TransitionNotFoundException If transition is not found.
+	 */
+	void removeTransition(const TransitionKey &transitionKey);
+
 	/**
 	 * @brief Clears transitions to the to state from the state's transitions vector.
 	 * @param toStateKey The to state key of the transition.
@@ -197,6 +267,26 @@ class AUTOMATASIMULATOR_API FAState {
 	 */
 	std::vector<FATransition> getTransitions();
 
+	/**
+	 * @brief Gets transitions from the state without copying them.
+	 * @return A reference to the cached transitions, valid until the transitions of the state change.
+	 */
+	const std::vector<FATransition> &getTransitionsView();
+
+	/**
+	 * @brief Gets the transitions reading an input symbol, without scanning the other transitions of the state.
+	 * @param input The id of the input symbol, epsilon for the epsilon transitions.
+	 * @return A reference to the transitions on the input, valid until the transitions of the state change.
+	 */
+	const std::vector<FATransition> &getTransitionsOnInput(const SymbolId &input) const;
+
+	/**
+	 * @brief Checks if the state has a transition reading an input symbol.
+	 * @param input The id of the input symbol, epsilon for the epsilon transitions.
+	 * @return Bool indicating whether such a transition exists or not.
+	 */
+	bool hasTransitionOnInput(const SymbolId &input) const;
+
 	/**
 	 * @brief Clears all transitions from the state's transitions vector.
 	 */
@@ -1,7 +1,21 @@
 #pragma once
 #include "AutomatonException.h"
+#include "SymbolTable.h"
+#include "TransitionKey.h"
 #include "config.h"
+#include <cstdint>
 #include <string>
+#include <vector>
+
+/**
+ * @brief Dense integer id of a state within its finite automaton.
+ */
+typedef uint32_t StateId;
+
+/**
+ * @brief Id used for a state that is not set or not resolved.
+ */
+constexpr StateId INVALID_STATE_ID = UINT32_MAX;
 
 /**
  * @brief Represents a transition between two states in an automaton.
@@ -10,9 +24,9 @@
 class AUTOMATASIMULATOR_API FATransition {
   private:
 	/**
-	 * @brief Unique identifier for the transition, formatted as "fromState-toState-Input".
+	 * @brief Structured unique identifier for the transition, kept in sync with its states and input.
 	 */
-	std::string key;
+	TransitionKey key;
 
 	/**
 	 * @brief The key of the state from which the transition starts.
@@ -25,14 +39,25 @@ class AUTOMATASIMULATOR_API FATransition {
 	std::string toStateKey;
 
 	/**
-	 * @brief The input value that triggers the transition.
+	 * @brief Id of the "to" state in the owning automaton, set by the automaton when the transition is added.
+	 */
+	StateId toStateId;
+
+	/**
+	 * @brief Interned id of the input value that triggers the transition.
+	 */
+	SymbolId input;
+
+	/**
+	 * @brief Splits a transition key into its parts, validating its format
+	 * @throws InvalidTransitionException If the key does not have the expected number of parts.
 	 */
-	std::string input;
+	static std::vector<std::string> splitTransitionKey(const std::string &key);
 
 	/**
-	 * @brief Validates the format of a transition key
+	 * @brief Rebuilds the structured key from the states and input.
 	 */
-	static void validateTransitionKeyFormat(const std::string &key);
+	void updateKey();
 
   public:
 	FATransition();
@@ -88,6 +113,21 @@ class AUTOMATASIMULATOR_API FATransition {
 	static std::string generateTransitionKey(const std::string &fromStateKey, const std::string &toStateKey,
 	                                         const std::string &input);
 
+	/**
+	 * @brief Generate a unique transition key from a structured key.
+	 * @param key The structured key.
+	 * @return A unique transition key string.
+	 */
+	static std::string generateTransitionKey(const TransitionKey &key);
+
+	/**
+	 * @brief Parses a transition key string into a structured key, looking up its parts without interning them.
+	 * @param key The transition key.
+	 * @return The structured key, which matches no transition if a part was never interned.
+	 * @throws InvalidTransitionException if the transition key format is invalid.
+	 */
+	static TransitionKey parseTransitionKey(const std::string &key);
+
 	/**
 	 * @brief Gets the to state key of a transition from its key.
 	 * @param key The transition key.
@@ -118,6 +158,12 @@ class AUTOMATASIMULATOR_API FATransition {
 	 */
 	std::string getKey() const;
 
+	/**
+	 * @brief Gets the structured unique key for this transition.
+	 * @return The structured key.
+	 */
+	const TransitionKey &getTransitionKey() const;
+
 	/**
 	 * @brief Sets the "from" state of this transition.
 	 * @param key The new "from" state key.
@@ -142,6 +188,18 @@ class AUTOMATASIMULATOR_API FATransition {
 	 */
 	std::string getToStateKey() const;
 
+	/**
+	 * @brief Sets the id of the "to" state in the owning automaton.
+	 * @param toStateId The id of the "to" state.
+	 */
+	void setToStateId(const StateId &toStateId);
+
+	/**
+	 * @brief Gets the id of the "to" state in the owning automaton.
+	 * @return Id of the "to" state, INVALID_STATE_ID if the transition is not owned by an automaton.
+	 */
+	StateId getToStateId() const;
+
 	/**
 	 * @brief Sets the input value for this transition.
 	 * @param input The new input value.
@@ -154,6 +212,12 @@ class AUTOMATASIMULATOR_API FATransition {
 	 */
 	std::string getInput() const;
 
+	/**
+	 * @brief Gets the interned id of the input value for this transition.
+	 * @return The input symbol id.
+	 */
+	SymbolId getInputId() const;
+
 	/**
 	 * @brief Gets a string representation of this transition.
 	 * @return A string representation of the transition.
@@ -165,7 +229,7 @@ namespace std {
 template <> struct hash<FATransition> {
 	size_t operator()(const FATransition &t) const {
 		size_t hashValue = hash<std::string>()(t.getFromStateKey()) ^ (hash<std::string>()(t.getToStateKey()) << 1) ^
-		                   (hash<std::string>()(t.getInput()) << 2);
+		                   (hash<SymbolId>()(t.getInputId()) << 2);
 		return hashValue;
 	}
 };
@@ -1,4 +1,5 @@
 #pragma once
+#include "CacheMutex.h"
 #include "FAState.h"
 #include <set>
 #include <unordered_map>
@@ -11,9 +12,9 @@
 class AUTOMATASIMULATOR_API FiniteAutomaton {
   protected:
 	/**
-	 * @brief The input of the automaton.
+	 * @brief The input of the automaton, as interned symbol ids.
 	 */
-	std::vector<std::string> input;
+	std::vector<SymbolId> input;
 
 	/**
 	 * @brief The head of the input tape.
@@ -21,24 +22,47 @@ class AUTOMATASIMULATOR_API FiniteAutomaton {
 	int inputHead;
 
 	/**
-	 * @brief The current state of the automaton.
+	 * @brief Id of the current state of the automaton.
 	 */
-	std::string currentState;
+	StateId currentState;
 
 	/**
-	 * @brief States of the automaton.
+	 * @brief States of the automaton, stored contiguously and indexed by state id.
+	 * @brief Slots of removed states are kept until reused so ids stay stable.
 	 */
-	std::unordered_map<std::string, FAState> states;
+	std::vector<FAState> states;
 
 	/**
-	 * @brief Input alphabet of the automaton.
+	 * @brief Flags marking which slots of the states vector hold a live state.
 	 */
-	std::unordered_set<std::string> inputAlphabet;
+	std::vector<bool> stateSlotsInUse;
 
 	/**
-	 * @brief Start state key.
+	 * @brief Maps state labels to their ids, only used at the API boundary.
 	 */
-	std::string startState;
+	std::unordered_map<std::string, StateId> stateIds;
+
+	/**
+	 * @brief Ids of removed states whose slots can be reused.
+	 */
+	std::vector<StateId> freeStateIds;
+
+	/**
+	 * @brief Transitions leading into each state, indexed by state id like the states vector.
+	 * @brief Maps the key of every incoming transition to the id of its from state, so editing a state only visits its
+	 * own edges.
+	 */
+	std::vector<std::unordered_map<TransitionKey, StateId>> incomingTransitions;
+
+	/**
+	 * @brief Input alphabet of the automaton, as interned symbol ids.
+	 */
+	std::unordered_set<SymbolId> inputAlphabet;
+
+	/**
+	 * @brief Id of the start state.
+	 */
+	StateId startState;
 
 	/**
 	 * @brief Cached convertion of the states from unordered map to vector.
@@ -60,6 +84,18 @@ class AUTOMATASIMULATOR_API FiniteAutomaton {
 	 */
 	bool inputAlphabetCacheInvalidated;
 
+	/**
+	 * @brief Counter incremented on every change to the states, transitions, start state or alphabet.
+	 * @brief Derived structures built from the definition compare against it to detect staleness.
+	 */
+	std::size_t definitionVersion;
+
+	/**
+	 * @brief Guards prepareConcurrentSimulation, so concurrent batches over this automaton never build a cache while
+	 * another reads it. Other automata have their own lock.
+	 */
+	CacheMutex simulationCachesMutex;
+
 	/**
 	 * @brief Gets the state with the key provided.
 	 * @param key The key of the state to get.
@@ -67,6 +103,64 @@ class AUTOMATASIMULATOR_API FiniteAutomaton {
 	 */
 	FAState *getStateInternal(const std::string &key);
 
+	/**
+	 * @brief Gets the state with the id provided.
+	 * @param id The id of the state to get.
+	 * @return The state with the specified id.
+	 * @throws StateNotFoundException If no state has the id.
+	 */
+	FAState *getStateInternal(const StateId &id);
+
+	/**
+	 * @brief Gets the id of the state with the key provided.
+	 * @param key The key of the state.
+	 * @return The id of the state.
+	 * @throws StateNotFoundException If the state is not found.
+	 */
+	StateId getStateId(const std::string &key) const;
+
+	/**
+	 * @brief Gets the label of the state with the id provided.
+	 * @param id The id of the state.
+	 * @return The label of the state, or an empty string if the id is not set.
+	 */
+	std::string getStateLabel(const StateId &id) const;
+
+	/**
+	 * @brief Checks if a state id refers to a live state.
+	 * @param id The id to check.
+	 * @return Bool indicating whether the id is in use.
+	 */
+	bool stateIdInUse(const StateId &id) const;
+
+	/**
+	 * @brief Releases the slot of a state so its id can be reused.
+	 * @param id The id of the state to release.
+	 */
+	void releaseState(const StateId &id);
+
+	/**
+	 * @brief Records a transition in the incoming index of its to state.
+	 * @param fromId The id of the from state.
+	 * @param toId The id of the to state.
+	 * @param key The key of the transition.
+	 */
+	void indexTransition(const StateId &fromId, const StateId &toId, const TransitionKey &key);
+
+	/**
+	 * @brief Removes a transition from the incoming index of its to state.
+	 * @param toId The id of the to state.
+	 * @param key The key of the transition.
+	 */
+	void unindexTransition(const StateId &toId, const TransitionKey &key);
+
+	/**
+	 * @brief Removes a transition from its from state and from the incoming index.
+	 * @param state The from state of the transition.
+	 * @param transition The transition to remove.
+	 */
+	void removeTransitionInternal(FAState &state, const FATransition &transition);
+
 	/**
 	 * @brief Checks if the transition states exist.
 	 * @param fromKey The key of the state to transition from.
@@ -76,6 +170,20 @@ class AUTOMATASIMULATOR_API FiniteAutomaton {
 	 */
 	void validateTransition(const std::string &fromStateKey, const std::string &toStateKey, const std::string &input);
 
+	/**
+	 * @brief Builds every lazily computed structure that simulation reads, so that simulating afterwards only reads
+	 * the automaton.
+	 * @brief Runs under the automaton's own lock, so a batch never builds a cache while a concurrent batch over the
+	 * same unchanged automaton reads it.
+	 */
+	void prepareConcurrentSimulation();
+
+	/**
+	 * @brief Builds the structures read by simulation, called by prepareConcurrentSimulation under its lock.
+	 * @brief Overrides that build their own structures must call the base version.
+	 */
+	virtual void buildSimulationCaches();
+
   public:
 	/**
 	 * @brief Constructs a new Finite Automaton object.
@@ -178,6 +286,12 @@ class AUTOMATASIMULATOR_API FiniteAutomaton {
 	 */
 	const std::vector<FAState> getStates();
 
+	/**
+	 * @brief Gets the states of the automaton without copying them.
+	 * @return A reference to the cached states, valid until the automaton is modified.
+	 */
+	const std::vector<FAState> &getStatesView();
+
 	/**
 	 * @brief Removes a state from the automaton.
 	 * @param key The key of the state to remove.
@@ -391,6 +505,8 @@ class AUTOMATASIMULATOR_API FiniteAutomaton {
 
 	/**
 	 * @brief Simulates the automaton on a given input string and depth.
+	 * @brief Builds caches lazily, so concurrent calls on the same automaton are not safe. Use simulateBatchParallel,
+	 * or a frozen snapshot where one exists, to simulate from several threads.
 	 * @param input The input strings to process.
 	 * @param simulationDepth The maximum number of transitions to simulate. Default is 50.
 	 * @return True if the input is accepted, false otherwise.
@@ -398,6 +514,32 @@ class AUTOMATASIMULATOR_API FiniteAutomaton {
 	 */
 	virtual const bool simulate(const std::vector<std::string> &input, const int &simulationDepth = 50) = 0;
 
+	/**
+	 * @brief Simulates the automaton on many inputs, checking the definition and preparing shared state once.
+	 * @brief Each result is the same as simulate would return for that input.
+	 * @param inputs The input strings to process.
+	 * @param simulationDepth The maximum number of transitions to simulate per input. Default is 50.
+	 * @return Whether each input is accepted, in order.
+	 * @throws InvalidStartStateException If the start state is not set.
+	 */
+	virtual const std::vector<bool> simulateBatch(const std::vector<std::vector<std::string>> &inputs,
+	                                              const int &simulationDepth = 50) = 0;
+
+	/**
+	 * @brief Simulates the automaton on many inputs on a pool of worker threads sharing the automaton.
+	 * @brief The caches read by simulation are built once before the workers start and the workers only read the
+	 * automaton, so concurrent calls on the same automaton are safe as long as it is not modified meanwhile.
+	 * @brief Each result is the same as simulateBatch would return for that input.
+	 * @param inputs The input strings to process.
+	 * @param threadCount The number of worker threads, 0 to use the hardware concurrency. Default is 0.
+	 * @param simulationDepth The maximum number of transitions to simulate per input. Default is 50.
+	 * @return Whether each input is accepted, in order.
+	 * @throws InvalidStartStateException If the start state is not set.
+	 */
+	virtual const std::vector<bool> simulateBatchParallel(const std::vector<std::vector<std::string>> &inputs,
+	                                                      const std::size_t &threadCount = 0,
+	                                                      const int &simulationDepth = 50) = 0;
+
 	/**
 	 * @brief Checks if the provided state is valid as the next state the automaton could transition to.
 	 * @param key The key of the state.
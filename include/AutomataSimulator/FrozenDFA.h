@@ -0,0 +1,150 @@
+#pragma once
+#include "SymbolTable.h"
+#include "config.h"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Immutable snapshot of a deterministic finite automaton, built by DeterministicFiniteAutomaton::freeze().
+ * States are numbered densely and their transitions stored in a single table. Nothing in a snapshot changes after it
+ * is built and the run state of a simulation lives in a Context owned by the caller, so any number of threads can
+ * simulate against one snapshot without locking.
+ */
+class AUTOMATASIMULATOR_API FrozenDFA {
+  public:
+	/**
+	 * @brief Index of the dead state, reached when a symbol has no transition.
+	 */
+	static constexpr uint32_t DEAD_STATE = UINT32_MAX;
+
+	/**
+	 * @brief Run state of one simulation over a snapshot.
+	 */
+	struct Context {
+		/**
+		 * @brief The input, as interned symbol ids.
+		 */
+		std::vector<SymbolId> input;
+
+		/**
+		 * @brief The head of the input.
+		 */
+		std::size_t inputHead;
+
+		/**
+		 * @brief Index of the current state, DEAD_STATE once a symbol had no transition.
+		 */
+		uint32_t currentState;
+	};
+
+  private:
+	friend class DeterministicFiniteAutomaton;
+
+	/**
+	 * @brief Label of each state, indexed by state index.
+	 */
+	std::vector<std::string> stateLabels;
+
+	/**
+	 * @brief Accept flag of each state, indexed by state index.
+	 */
+	std::vector<bool> acceptStates;
+
+	/**
+	 * @brief Maps each symbol read by a transition to its column in the transition table.
+	 */
+	std::unordered_map<SymbolId, uint32_t> symbolColumns;
+
+	/**
+	 * @brief Transition table indexed by state index * column count + column, DEAD_STATE where there is none.
+	 */
+	std::vector<uint32_t> transitions;
+
+	/**
+	 * @brief Index of the start state.
+	 */
+	uint32_t startState;
+
+	/**
+	 * @brief Constructs an empty snapshot, filled in by DeterministicFiniteAutomaton::freeze().
+	 */
+	FrozenDFA();
+
+	/**
+	 * @brief Simulates the snapshot on an input of symbol ids.
+	 * @param inputIds The ids of the input symbols to process.
+	 * @param simulationDepth The maximum number of transitions to simulate.
+	 * @return True if the input is accepted, false otherwise.
+	 */
+	bool simulateInput(const std::vector<SymbolId> &inputIds, const int &simulationDepth) const;
+
+  public:
+	/**
+	 * @brief Creates the run state for simulating an input step by step, starting at the start state.
+	 * @param input The input strings to process.
+	 * @return The run state.
+	 */
+	Context createContext(const std::vector<std::string> &input) const;
+
+	/**
+	 * @brief Reads the symbol under the input head and moves to the next state.
+	 * @param context The run state to advance.
+	 * @return False if the input is exhausted or the current state is dead, true otherwise.
+	 */
+	bool step(Context &context) const;
+
+	/**
+	 * @brief Checks if a run is in an accept state.
+	 * @param context The run state.
+	 * @return True if the current state is an accept state.
+	 */
+	bool isAccepting(const Context &context) const;
+
+	/**
+	 * @brief Gets the label of the current state of a run.
+	 * @param context The run state.
+	 * @return The label of the current state, or an empty string if the run is in the dead state.
+	 */
+	std::string getCurrentState(const Context &context) const;
+
+	/**
+	 * @brief Gets the label of the start state.
+	 * @return The label of the start state.
+	 */
+	std::string getStartState() const;
+
+	/**
+	 * @brief Gets the number of states in the snapshot.
+	 * @return The number of states.
+	 */
+	std::size_t getStateCount() const;
+
+	/**
+	 * @brief Simulates the snapshot on an input, accepting the same inputs as the automaton it was frozen from.
+	 * @param input The input strings to process.
+	 * @param simulationDepth The maximum number of transitions to simulate. Default is 50.
+	 * @return True if the input is accepted, false otherwise.
+	 */
+	bool simulate(const std::vector<std::string> &input, const int &simulationDepth = 50) const;
+
+	/**
+	 * @brief Simulates the snapshot on many inputs.
+	 * @param inputs The input strings to process.
+	 * @param simulationDepth The maximum number of transitions to simulate per input. Default is 50.
+	 * @return Whether each input is accepted, in order.
+	 */
+	std::vector<bool> simulateBatch(const std::vector<std::vector<std::string>> &inputs,
+	                                const int &simulationDepth = 50) const;
+
+	/**
+	 * @brief Simulates the snapshot on many inputs on a pool of worker threads.
+	 * @param inputs The input strings to process.
+	 * @param threadCount The number of worker threads, 0 to use the hardware concurrency. Default is 0.
+	 * @param simulationDepth The maximum number of transitions to simulate per input. Default is 50.
+	 * @return Whether each input is accepted, in order.
+	 */
+	std::vector<bool> simulateBatchParallel(const std::vector<std::vector<std::string>> &inputs,
+	                                        const std::size_t &threadCount = 0, const int &simulationDepth = 50) const;
+};
@@ -0,0 +1,158 @@
+#pragma once
+#include "SymbolTable.h"
+#include "TMDirection.h"
+#include "TMTape.h"
+#include "config.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Immutable snapshot of a deterministic Turing machine, built by DeterministicTuringMachine::freeze().
+ * States are numbered densely and the transitions of all states stored in one array with their symbols interned.
+ * Nothing in a snapshot changes after it is built and the tape and current state of a run live in a Context owned by
+ * the caller, so any number of threads can simulate against one snapshot without locking.
+ */
+class AUTOMATASIMULATOR_API FrozenDTM {
+  public:
+	/**
+	 * @brief Run state of one simulation over a snapshot.
+	 */
+	struct Context {
+		/**
+		 * @brief Index of the current state.
+		 */
+		uint32_t currentState;
+
+		/**
+		 * @brief The tape of the run.
+		 */
+		TMTape tape;
+	};
+
+  private:
+	friend class DeterministicTuringMachine;
+
+	/**
+	 * @brief A transition with its states replaced by indices and its symbols interned.
+	 */
+	struct Transition {
+		SymbolId readSymbol;
+		SymbolId writeSymbol;
+		TMDirection direction;
+		uint32_t toState;
+	};
+
+	/**
+	 * @brief Label of each state, indexed by state index.
+	 */
+	std::vector<std::string> stateLabels;
+
+	/**
+	 * @brief Accept flag of each state, indexed by state index.
+	 */
+	std::vector<bool> acceptStates;
+
+	/**
+	 * @brief Transitions of all states, those of state i in [transitionOffsets[i], transitionOffsets[i + 1]), in the
+	 * order the machine tries them.
+	 */
+	std::vector<Transition> transitions;
+
+	/**
+	 * @brief Offset of the first transition of each state, with one extra entry for the end.
+	 */
+	std::vector<uint32_t> transitionOffsets;
+
+	/**
+	 * @brief Index of the start state.
+	 */
+	uint32_t startState;
+
+	/**
+	 * @brief Storage mode of the tapes of runs, taken from the machine.
+	 */
+	TMTapeMode tapeMode;
+
+	/**
+	 * @brief Constructs an empty snapshot, filled in by DeterministicTuringMachine::freeze().
+	 */
+	FrozenDTM();
+
+	/**
+	 * @brief Simulates the snapshot on an input of symbol ids.
+	 * @param inputIds The ids of the input symbols to load into the tape.
+	 * @param simulationDepth The maximum number of transitions to simulate.
+	 * @return True if the input is accepted, false otherwise.
+	 */
+	bool simulateInput(const std::vector<SymbolId> &inputIds, const int &simulationDepth) const;
+
+  public:
+	/**
+	 * @brief Creates the run state for simulating an input step by step, starting at the start state with the input
+	 * loaded into the tape.
+	 * @param input The input strings to load into the tape.
+	 * @return The run state.
+	 */
+	Context createContext(const std::vector<std::string> &input) const;
+
+	/**
+	 * @brief Takes the transition matching the symbol under the head, writing, moving and changing state.
+	 * @param context The run state to advance.
+	 * @return False if no transition matches and the machine halts, true otherwise.
+	 */
+	bool step(Context &context) const;
+
+	/**
+	 * @brief Checks if a run is in an accept state.
+	 * @param context The run state.
+	 * @return True if the current state is an accept state.
+	 */
+	bool isAccepting(const Context &context) const;
+
+	/**
+	 * @brief Gets the label of the current state of a run.
+	 * @param context The run state.
+	 * @return The label of the current state.
+	 */
+	std::string getCurrentState(const Context &context) const;
+
+	/**
+	 * @brief Gets the label of the start state.
+	 * @return The label of the start state.
+	 */
+	std::string getStartState() const;
+
+	/**
+	 * @brief Gets the number of states in the snapshot.
+	 * @return The number of states.
+	 */
+	std::size_t getStateCount() const;
+
+	/**
+	 * @brief Simulates the snapshot on an input, accepting the same inputs as the machine it was frozen from.
+	 * @param input The input strings to process.
+	 * @param simulationDepth The maximum number of transitions to simulate. Default is 50.
+	 * @return True if the input is accepted, false otherwise.
+	 */
+	bool simulate(const std::vector<std::string> &input, const int &simulationDepth = 50) const;
+
+	/**
+	 * @brief Simulates the snapshot on many inputs.
+	 * @param inputs The input strings to process.
+	 * @param simulationDepth The maximum number of transitions to simulate per input. Default is 50.
+	 * @return Whether each input is accepted, in order.
+	 */
+	std::vector<bool> simulateBatch(const std::vector<std::vector<std::string>> &inputs,
+	                                const int &simulationDepth = 50) const;
+
+	/**
+	 * @brief Simulates the snapshot on many inputs on a pool of worker threads.
+	 * @param inputs The input strings to process.
+	 * @param threadCount The number of worker threads, 0 to use the hardware concurrency. Default is 0.
+	 * @param simulationDepth The maximum number of transitions to simulate per input. Default is 50.
+	 * @return Whether each input is accepted, in order.
+	 */
+	std::vector<bool> simulateBatchParallel(const std::vector<std::vector<std::string>> &inputs,
+	                                        const std::size_t &threadCount = 0, const int &simulationDepth = 50) const;
+};
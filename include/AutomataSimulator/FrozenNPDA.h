@@ -0,0 +1,218 @@
+#pragma once
+#include "StackPool.h"
+#include "SymbolTable.h"
+#include "config.h"
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * @brief Immutable snapshot of a non-deterministic pushdown automaton, built by
+ * NonDeterministicPushdownAutomaton::freeze().
+ * States are numbered densely, the transitions of all states are stored in one array with their push symbols already
+ * interned, and the epsilon closures are computed up front. Nothing in a snapshot changes after it is built and the
+ * branches of a simulation live in a Context owned by the caller, so any number of threads can simulate against one
+ * snapshot without locking.
+ */
+class AUTOMATASIMULATOR_API FrozenNPDA {
+  public:
+	/**
+	 * @brief One branch of a simulation: a state, the stack below it and the position reached in the input.
+	 */
+	struct Branch {
+		/**
+		 * @brief Index of the state of the branch.
+		 */
+		uint32_t state;
+
+		/**
+		 * @brief The stack of the branch, in the stack pool of the context it belongs to.
+		 */
+		StackPool::StackId stack;
+
+		/**
+		 * @brief The head of the input.
+		 */
+		std::size_t head;
+
+		/**
+		 * @brief Number of transitions taken to reach the branch.
+		 */
+		int depth;
+
+		bool operator==(const Branch &other) const;
+	};
+
+	/**
+	 * @brief Hashes a branch by its state, stack and head, ignoring its depth.
+	 */
+	struct BranchHash {
+		std::size_t operator()(const Branch &branch) const;
+	};
+
+	/**
+	 * @brief Run state of a simulation over a snapshot.
+	 * @brief A context can be reused across simulations on the same thread, keeping the capacity of its buffers.
+	 */
+	struct Context {
+		/**
+		 * @brief Branches waiting to be expanded, in breadth first order.
+		 */
+		std::deque<Branch> branches;
+
+		/**
+		 * @brief Configurations already expanded, compared by state, stack and head.
+		 */
+		std::unordered_set<Branch, BranchHash> visited;
+
+		/**
+		 * @brief Stacks of the branches, shared between them so a branch is copied and hashed in O(1).
+		 */
+		StackPool stacks;
+	};
+
+  private:
+	friend class NonDeterministicPushdownAutomaton;
+
+	/**
+	 * @brief A transition with its states replaced by indices and its symbols interned.
+	 */
+	struct Transition {
+		SymbolId input;
+		SymbolId stackSymbol;
+
+		/**
+		 * @brief Symbols pushed by the transition, in the order they are pushed.
+		 */
+		std::vector<SymbolId> pushSymbols;
+
+		uint32_t toState;
+
+		/**
+		 * @brief Whether the transition reads no input, pops nothing and pushes nothing, so it is folded into the
+		 * epsilon closures.
+		 */
+		bool stackNeutral;
+	};
+
+	/**
+	 * @brief Label of each state, indexed by state index.
+	 */
+	std::vector<std::string> stateLabels;
+
+	/**
+	 * @brief Accept flag of each state, indexed by state index.
+	 */
+	std::vector<bool> acceptStates;
+
+	/**
+	 * @brief Transitions of all states, those of state i in [transitionOffsets[i], transitionOffsets[i + 1]).
+	 */
+	std::vector<Transition> transitions;
+
+	/**
+	 * @brief Offset of the first transition of each state, with one extra entry for the end.
+	 */
+	std::vector<uint32_t> transitionOffsets;
+
+	/**
+	 * @brief Epsilon closures of all states, that of state i in [closureOffsets[i], closureOffsets[i + 1]).
+	 */
+	std::vector<uint32_t> closures;
+
+	/**
+	 * @brief Offset of the epsilon closure of each state, with one extra entry for the end.
+	 */
+	std::vector<uint32_t> closureOffsets;
+
+	/**
+	 * @brief Index of the start state.
+	 */
+	uint32_t startState;
+
+	/**
+	 * @brief Id of the symbol the stack starts with.
+	 */
+	SymbolId initialStackSymbol;
+
+	/**
+	 * @brief Constructs an empty snapshot, filled in by NonDeterministicPushdownAutomaton::freeze().
+	 */
+	FrozenNPDA();
+
+	/**
+	 * @brief Simulates the snapshot on an input of symbol ids.
+	 * @param inputIds The ids of the input symbols to process.
+	 * @param context The run state to search the branches in.
+	 * @param simulationDepth The maximum number of transitions to simulate on a branch.
+	 * @return True if the input is accepted, false otherwise.
+	 */
+	bool simulateInput(const std::vector<SymbolId> &inputIds, Context &context, const int &simulationDepth) const;
+
+	/**
+	 * @brief Run state of the graph-structured stack engine, defined next to simulateGSS.
+	 */
+	struct GraphStructuredStack;
+
+  public:
+	/**
+	 * @brief Gets the label of the start state.
+	 * @return The label of the start state.
+	 */
+	std::string getStartState() const;
+
+	/**
+	 * @brief Gets the number of states in the snapshot.
+	 * @return The number of states.
+	 */
+	std::size_t getStateCount() const;
+
+	/**
+	 * @brief Simulates the snapshot on an input, accepting the same inputs as the automaton it was frozen from.
+	 * @param input The input strings to process.
+	 * @param simulationDepth The maximum number of transitions to simulate on a branch. Default is 50.
+	 * @return True if the input is accepted, false otherwise.
+	 */
+	bool simulate(const std::vector<std::string> &input, const int &simulationDepth = 50) const;
+
+	/**
+	 * @brief Simulates the snapshot on an input, searching the branches in a caller owned context.
+	 * @param input The input strings to process.
+	 * @param context The run state, cleared before the search.
+	 * @param simulationDepth The maximum number of transitions to simulate on a branch. Default is 50.
+	 * @return True if the input is accepted, false otherwise.
+	 */
+	bool simulate(const std::vector<std::string> &input, Context &context, const int &simulationDepth = 50) const;
+
+	/**
+	 * @brief Simulates the snapshot on many inputs, reusing one context for all of them.
+	 * @param inputs The input strings to process.
+	 * @param simulationDepth The maximum number of transitions to simulate on a branch. Default is 50.
+	 * @return Whether each input is accepted, in order.
+	 */
+	std::vector<bool> simulateBatch(const std::vector<std::vector<std::string>> &inputs,
+	                                const int &simulationDepth = 50) const;
+
+	/**
+	 * @brief Simulates the snapshot on many inputs on a pool of worker threads, each with its own context.
+	 * @param inputs The input strings to process.
+	 * @param threadCount The number of worker threads, 0 to use the hardware concurrency. Default is 0.
+	 * @param simulationDepth The maximum number of transitions to simulate on a branch. Default is 50.
+	 * @return Whether each input is accepted, in order.
+	 */
+	std::vector<bool> simulateBatchParallel(const std::vector<std::vector<std::string>> &inputs,
+	                                        const std::size_t &threadCount = 0, const int &simulationDepth = 50) const;
+
+	/**
+	 * @brief Decides whether the snapshot accepts an input by merging its branches into a graph-structured stack, as
+	 * GLR parsers do, in one left-to-right pass over the input.
+	 * @brief Branches pushing the same symbol into the same state at the same input position share one stack cell,
+	 * and a pop is replayed onto every stack below the popped cell, so the run takes polynomial time in the length of
+	 * the input instead of enumerating branches, and needs no simulation depth.
+	 * @param input The input strings to process.
+	 * @return True if the input is accepted, false otherwise.
+	 */
+	bool simulateGSS(const std::vector<std::string> &input) const;
+};
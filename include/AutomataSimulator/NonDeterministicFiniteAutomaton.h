@@ -1,20 +1,30 @@
 #pragma once
+#include "DeterministicFiniteAutomaton.h"
 #include "FiniteAutomaton.h"
 #include "config.h"
+#include <cstdint>
 #include <queue>
 #include <set>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
+/**
+ * @brief Hashes a set of states stored as a bitset mask.
+ */
+struct AUTOMATASIMULATOR_API StateSetHash {
+	std::size_t operator()(const std::vector<uint64_t> &stateSet) const;
+};
+
 /**
  * @brief Represents a non-deterministic finite automaton.
  */
 class AUTOMATASIMULATOR_API NonDeterministicFiniteAutomaton : public FiniteAutomaton {
   private:
 	/**
-	 * @brief The possible current states of the automaton.
+	 * @brief Ids of the possible current states of the automaton.
 	 */
-	std::unordered_set<std::string> possibleCurrentStates;
+	std::unordered_set<StateId> possibleCurrentStates;
 
 	/**
 	 * @brief Cached convertion of the  possible current states from unordered map to vector.
@@ -33,7 +43,170 @@ class AUTOMATASIMULATOR_API NonDeterministicFiniteAutomaton : public FiniteAutom
 	 */
 	FATransition decideRandomTransition(const std::unordered_set<FATransition> &transitions);
 
+	/**
+	 * @brief Number of 64 bit words in each compiled state set mask.
+	 */
+	std::size_t compiledMaskWords;
+
+	/**
+	 * @brief Pool of epsilon-closed state set masks built by compile(), each compiledMaskWords long.
+	 * @brief Identical sets share one mask, and mask 0 is the empty set.
+	 */
+	std::vector<uint64_t> compiledMasks;
+
+	/**
+	 * @brief Index into the mask pool of the successors of each state, indexed by state id * symbol count + column.
+	 */
+	std::vector<uint32_t> compiledSuccessors;
+
+	/**
+	 * @brief Maps each transition input symbol, including epsilon, to its column in the successor table.
+	 */
+	std::unordered_map<SymbolId, uint32_t> compiledSymbolColumns;
+
+	/**
+	 * @brief Epsilon closure of the start state.
+	 */
+	std::vector<uint64_t> compiledStartMask;
+
+	/**
+	 * @brief Set of accept states.
+	 */
+	std::vector<uint64_t> compiledAcceptMask;
+
+	/**
+	 * @brief Definition version the compiled masks were built from.
+	 */
+	std::size_t compiledVersion;
+
+	/**
+	 * @brief Boolean indicating whether simulate runs over the lazy DFA cache.
+	 */
+	bool lazyDFAEnabled;
+
+	/**
+	 * @brief Maximum number of bytes the lazy DFA cache may use before it is flushed.
+	 */
+	std::size_t lazyDFAMemoryBudget;
+
+	/**
+	 * @brief Pool of the NFA state sets of the cached DFA states, each compiledMaskWords long.
+	 */
+	std::vector<uint64_t> lazyDFAStateSets;
+
+	/**
+	 * @brief Maps an NFA state set to the cached DFA state built for it.
+	 */
+	std::unordered_map<std::vector<uint64_t>, uint32_t, StateSetHash> lazyDFAStateIndex;
+
+	/**
+	 * @brief Successor of each cached DFA state, indexed by DFA state * symbol count + column.
+	 * @brief Successors that were not computed yet hold UINT32_MAX.
+	 */
+	std::vector<uint32_t> lazyDFATransitions;
+
+	/**
+	 * @brief Whether each cached DFA state contains an accept state.
+	 */
+	std::vector<bool> lazyDFAAccepting;
+
+	/**
+	 * @brief The cached DFA state of the empty set, UINT32_MAX if it is not cached.
+	 */
+	uint32_t lazyDFADeadState;
+
+	/**
+	 * @brief Definition version the lazy DFA cache was built from.
+	 */
+	std::size_t lazyDFAVersion;
+
+	/**
+	 * @brief Number of times the lazy DFA cache was flushed for exceeding its memory budget.
+	 */
+	std::size_t lazyDFAFlushCount;
+
+	/**
+	 * @brief Cached epsilon closure of every state, indexed by state id.
+	 */
+	std::vector<std::vector<StateId>> epsilonClosures;
+
+	/**
+	 * @brief Definition version the cached epsilon closures were computed from.
+	 */
+	std::size_t epsilonClosuresVersion;
+
+	/**
+	 * @brief Gets the epsilon closure of every state, computing it only if the definition changed since the last call.
+	 * @brief States on an epsilon cycle share one closure, so each strongly connected component of the epsilon
+	 * transitions is resolved once.
+	 * @return The ids of the states reachable through epsilon transitions from each state, including itself.
+	 */
+	const std::vector<std::vector<StateId>> &getEpsilonClosures();
+
+	/**
+	 * @brief Computes the set of states reached from a set of states on one column of the compiled masks.
+	 * @param active The set of states to advance, compiledMaskWords long.
+	 * @param column The column of the input symbol.
+	 * @param next The set to write the reached states into, compiledMaskWords long.
+	 */
+	void stepCompiled(const uint64_t *active, const uint32_t &column, std::vector<uint64_t> &next) const;
+
+	/**
+	 * @brief Empties the lazy DFA cache.
+	 */
+	void clearLazyDFA();
+
+	/**
+	 * @brief Gets the cached DFA state of a set of NFA states, caching a new one if it is not found.
+	 * @param stateSet The set of NFA states, compiledMaskWords long.
+	 * @return The cached DFA state.
+	 */
+	uint32_t addLazyDFAState(const std::vector<uint64_t> &stateSet);
+
+	/**
+	 * @brief Simulates the automaton over the lazy DFA cache, building the DFA states the input reaches on demand.
+	 * @param inputIds The ids of the input symbols to process.
+	 * @return True if the input is accepted, false otherwise.
+	 */
+	const bool simulateLazyDFA(const std::vector<SymbolId> &inputIds);
+
+	/**
+	 * @brief Simulates the automaton by advancing the active state set over the compiled masks.
+	 * @param inputIds The ids of the input symbols to process.
+	 * @return True if the input is accepted, false otherwise.
+	 */
+	const bool simulateCompiled(const std::vector<SymbolId> &inputIds) const;
+
+	/**
+	 * @brief Simulates the compiled masks on an input, stepping through caller owned state set buffers.
+	 * @param inputIds The ids of the input symbols.
+	 * @param active Buffer for the current state set, resized as needed.
+	 * @param next Buffer for the successor state set, resized as needed.
+	 * @return True if the input is accepted, false otherwise.
+	 */
+	const bool simulateCompiled(const std::vector<SymbolId> &inputIds, std::vector<uint64_t> &active,
+	                            std::vector<uint64_t> &next) const;
+
+	/**
+	 * @brief Builds the state transition caches and the epsilon closures, and the compiled masks in lazy DFA mode.
+	 */
+	void buildSimulationCaches() override;
+
+	/**
+	 * @brief Simulates the automaton by searching the branches over the state transitions and epsilon closures,
+	 * assuming the start state is set.
+	 * @param inputIds The ids of the input symbols to process.
+	 * @param simulationDepth The maximum number of input symbols to read on a branch.
+	 * @return True if the input is accepted, false otherwise.
+	 */
+	const bool simulateInterpreted(const std::vector<SymbolId> &inputIds, const int &simulationDepth);
+
   public:
+	/**
+	 * @brief Constructs a new Non Deterministic Finite Automaton object.
+	 */
+	NonDeterministicFiniteAutomaton();
+
 	virtual ~NonDeterministicFiniteAutomaton() override;
 
 	/**
@@ -131,6 +304,7 @@ class AUTOMATASIMULATOR_API NonDeterministicFiniteAutomaton : public FiniteAutom
 	/**
 	 * @brief Moves the automaton to the next state based on the current input head.
 	 * @brief If an epsilon transition is taken, the input head is not incremented.
+	 * @brief An input symbol can also be read from any state in the epsilon closure of the current state.
 	 * @brief Returns false if the simulation depth is exceeded and no accept state is reached.
 	 * @return True if the current state is accept.
 	 * @throws InvalidStartStateException If the start state is not set.
@@ -141,9 +315,99 @@ class AUTOMATASIMULATOR_API NonDeterministicFiniteAutomaton : public FiniteAutom
 
 	/**
 	 * @brief Simulates the NFA on a given input string.
+	 * @brief Epsilon transitions are followed through the cached epsilon closures, so only reading a symbol counts
+	 * towards the simulation depth.
 	 * @param input The input string to process.
+	 * @param simulationDepth The maximum number of input symbols to read on a branch. Default is 50.
 	 * @return True if the input is accepted, false otherwise.
 	 * @throws InvalidStartStateException If the start state is not set.
 	 */
 	const bool simulate(const std::vector<std::string> &input, const int &simulationDepth = 50) override;
+
+	/**
+	 * @brief Simulates the automaton on many inputs, checking the start state, translating the inputs and choosing
+	 * between the lazy DFA, the compiled masks and the branch search once for the whole batch.
+	 * @param inputs The input strings to process.
+	 * @param simulationDepth The maximum number of input symbols to read on a branch. Default is 50.
+	 * @return Whether each input is accepted, in order.
+	 * @throws InvalidStartStateException If the start state is not set.
+	 */
+	const std::vector<bool> simulateBatch(const std::vector<std::vector<std::string>> &inputs,
+	                                      const int &simulationDepth = 50) override;
+
+	/**
+	 * @brief Simulates the automaton on many inputs on a pool of worker threads, each with its own state set buffers.
+	 * @brief The lazy DFA cache grows while it is read, so in lazy DFA mode the workers step the compiled masks
+	 * directly instead, which accepts the same inputs.
+	 * @param inputs The input strings to process.
+	 * @param threadCount The number of worker threads, 0 to use the hardware concurrency. Default is 0.
+	 * @param simulationDepth The maximum number of transitions to simulate per input. Default is 50.
+	 * @return Whether each input is accepted, in order.
+	 * @throws InvalidStartStateException If the start state is not set.
+	 */
+	const std::vector<bool> simulateBatchParallel(const std::vector<std::vector<std::string>> &inputs,
+	                                              const std::size_t &threadCount = 0,
+	                                              const int &simulationDepth = 50) override;
+
+	/**
+	 * @brief Compiles the automaton into epsilon-closed successor masks per state and input symbol.
+	 * @brief While the masks are current, simulate tracks the set of active states as a bitset and advances it one
+	 * input symbol at a time. The whole input is consumed and simulationDepth is not used, as epsilon cycles are
+	 * folded into the masks and cannot loop.
+	 * @brief Any change to the states, transitions, start state or alphabet invalidates the masks.
+	 * @throws InvalidStartStateException If the start state is not set.
+	 */
+	void compile();
+
+	/**
+	 * @brief Checks if the compiled masks are built and match the current definition.
+	 * @return True if simulate will use the compiled masks.
+	 */
+	const bool isCompiled() const;
+
+	/**
+	 * @brief Enables the lazy DFA mode of simulate.
+	 * @brief Simulate then runs over a cache of DFA states, each a set of NFA states, built on demand as inputs reach
+	 * them. Repeated or similar inputs reuse the cached states and transitions, so they run at DFA speed without
+	 * building the full DFA upfront. The masks are compiled on the first simulate if they are not current.
+	 * @brief When caching a new state would exceed the memory budget, the cache is flushed and rebuilt from the
+	 * start and current states. The cache always holds at least three states, whatever the budget.
+	 * @brief Any change to the definition empties the cache. simulationDepth is not used, as with compile.
+	 * @param memoryBudget The maximum number of bytes the cache may use.
+	 */
+	void enableLazyDFA(const std::size_t &memoryBudget = 1 << 20);
+
+	/**
+	 * @brief Disables the lazy DFA mode of simulate and frees its cache.
+	 */
+	void disableLazyDFA();
+
+	/**
+	 * @brief Checks if simulate runs over the lazy DFA cache.
+	 * @return True if the lazy DFA mode is enabled.
+	 */
+	const bool isLazyDFAEnabled() const;
+
+	/**
+	 * @brief Gets the number of DFA states in the lazy DFA cache.
+	 * @return The number of cached DFA states.
+	 */
+	const std::size_t getLazyDFAStateCount() const;
+
+	/**
+	 * @brief Gets the number of times the lazy DFA cache was flushed for exceeding its memory budget.
+	 * @return The number of flushes since the lazy DFA mode was enabled.
+	 */
+	const std::size_t getLazyDFAFlushCount() const;
+
+	/**
+	 * @brief Converts the automaton into an equivalent DFA using the powerset construction with epsilon closures.
+	 * @brief Each DFA state is a set of NFA states, labelled like "{q0,q1}". Only sets reachable from the start state
+	 * are built, and the empty set is left out so inputs with no run are rejected by a missing transition.
+	 * @param maxStates The maximum number of DFA states to build.
+	 * @return The equivalent DFA.
+	 * @throws InvalidStartStateException If the start state is not set.
+	 * @throws InvalidAutomatonDefinitionException If the DFA would need more than maxStates states.
+	 */
+	DeterministicFiniteAutomaton toDFA(const std::size_t &maxStates = 10000);
 };
@@ -1,7 +1,10 @@
 #pragma once
+#include "FrozenNPDA.h"
 #include "PushdownAutomaton.h"
+#include "StackPool.h"
 #include "config.h"
 #include <set>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -33,13 +36,52 @@ class AUTOMATASIMULATOR_API NonDeterministicPushdownAutomaton : public PushdownA
 	PDATransition decideRandomTransition(const std::unordered_set<PDATransition> &transitions);
 
 	/**
-	 * @brief Serializes the stack to a string.
-	 * @param stack The stack to serialize.
-	 * @return The serialized stack.
+	 * @brief Cached epsilon closure of every state, keyed by state key.
 	 */
-	std::string serializeStack(const std::stack<std::string> &stack);
+	std::unordered_map<std::string, std::vector<std::string>> epsilonClosures;
+
+	/**
+	 * @brief Definition version the cached epsilon closures were computed from.
+	 */
+	std::size_t epsilonClosuresVersion;
+
+	/**
+	 * @brief Checks if a transition moves between states without reading input or touching the stack.
+	 * @param transition The transition to check.
+	 * @return True if the transition reads no input, pops nothing and pushes nothing.
+	 */
+	bool isStackNeutralEpsilon(const PDATransition &transition);
+
+	/**
+	 * @brief Gets the epsilon closure of every state, computing it only if the definition changed since the last call.
+	 * @brief Only stack neutral epsilon transitions are followed, as they apply whatever the stack holds. States on
+	 * a cycle of them share one closure, so each strongly connected component is resolved once.
+	 * @return The keys of the states reachable through stack neutral epsilon transitions from each state, including
+	 * itself.
+	 */
+	const std::unordered_map<std::string, std::vector<std::string>> &getEpsilonClosures();
+
+	/**
+	 * @brief Simulates the automaton on one input, assuming the start state is set.
+	 * @param inputIds The ids of the input symbols to process.
+	 * @param simulationDepth The maximum number of transitions to simulate.
+	 * @param initialStackSymbol The id of the symbol the stack starts with.
+	 * @return True if the input is accepted, false otherwise.
+	 */
+	bool simulateInput(const std::vector<SymbolId> &inputIds, const int &simulationDepth,
+	                   const SymbolId &initialStackSymbol);
+
+	/**
+	 * @brief Builds the state transition caches and the epsilon closures.
+	 */
+	void buildSimulationCaches() override;
 
   public:
+	/**
+	 * @brief Constructs a new Non Deterministic Pushdown Automaton object.
+	 */
+	NonDeterministicPushdownAutomaton();
+
 	virtual ~NonDeterministicPushdownAutomaton() override;
 
 	/**
@@ -58,6 +100,7 @@ class AUTOMATASIMULATOR_API NonDeterministicPushdownAutomaton : public PushdownA
 	/**
 	 * @brief Moves the automaton to the next state based on the current input head.
 	 * @brief If an epsilon transition is taken, the input head is not incremented.
+	 * @brief An input symbol can also be read from any state in the epsilon closure of the current state.
 	 * @return True if the current state is accept.
 	 * @throws InvalidStartStateException If the start state is not set.
 	 * @throws InvalidAlphabetException If the alphabet is not set.
@@ -68,10 +111,53 @@ class AUTOMATASIMULATOR_API NonDeterministicPushdownAutomaton : public PushdownA
 	/**
 	 * @brief Simulates the automaton on a given input string and depth.
 	 * @brief Returns false if the simulation depth is exceeded and no accept state is reached.
+	 * @brief Stack neutral epsilon transitions are followed through the cached epsilon closures and do not count
+	 * towards the simulation depth.
 	 * @param input The input strings to process.
 	 * @param simulationDepth The maximum number of transitions to simulate. Default is 50.
 	 * @return True if the input is accepted, false otherwise.
 	 * @throws InvalidStartStateException If the start state is not set.
 	 */
 	bool simulate(const std::vector<std::string> &input, const int &simulationDepth = 50) override;
+
+	/**
+	 * @brief Simulates the automaton on many inputs, checking the start state, translating the inputs and computing
+	 * the epsilon closures once for the whole batch.
+	 * @param inputs The input strings to process.
+	 * @param simulationDepth The maximum number of transitions to simulate per input. Default is 50.
+	 * @return Whether each input is accepted, in order.
+	 * @throws InvalidStartStateException If the start state is not set.
+	 */
+	std::vector<bool> simulateBatch(const std::vector<std::vector<std::string>> &inputs,
+	                                const int &simulationDepth = 50) override;
+
+	/**
+	 * @brief Simulates the automaton on many inputs on a pool of worker threads, computing the epsilon closures once
+	 * before the workers start.
+	 * @param inputs The input strings to process.
+	 * @param threadCount The number of worker threads, 0 to use the hardware concurrency. Default is 0.
+	 * @param simulationDepth The maximum number of transitions to simulate per input. Default is 50.
+	 * @return Whether each input is accepted, in order.
+	 * @throws InvalidStartStateException If the start state is not set.
+	 */
+	std::vector<bool> simulateBatchParallel(const std::vector<std::vector<std::string>> &inputs,
+	                                        const std::size_t &threadCount = 0,
+	                                        const int &simulationDepth = 50) override;
+
+	/**
+	 * @brief Builds an immutable snapshot of the automaton that any number of threads can simulate without locking.
+	 * @brief Later changes to the automaton do not affect the snapshot.
+	 * @return The snapshot.
+	 * @throws InvalidStartStateException If the start state is not set.
+	 */
+	FrozenNPDA freeze();
+
+	/**
+	 * @brief Decides whether the automaton accepts an input with the graph-structured stack engine of a snapshot of
+	 * it, which runs in polynomial time on ambiguous automata and has no simulation depth.
+	 * @param input The input strings to process.
+	 * @return True if the input is accepted, false otherwise.
+	 * @throws InvalidStartStateException If the start state is not set.
+	 */
+	bool simulateGSS(const std::vector<std::string> &input);
 };
@@ -33,6 +33,14 @@ class AUTOMATASIMULATOR_API NonDeterministicTuringMachine : public TuringMachine
 	 */
 	TMTransition decideRandomTransition(const std::unordered_set<TMTransition> &transitions);
 
+	/**
+	 * @brief Simulates the machine on one input, assuming the start state is set.
+	 * @param inputIds The ids of the input symbols to load into the tape.
+	 * @param simulationDepth The maximum number of transitions to simulate.
+	 * @return True if the input is accepted, false otherwise.
+	 */
+	bool simulateInput(const std::vector<SymbolId> &inputIds, const int &simulationDepth);
+
   public:
 	virtual ~NonDeterministicTuringMachine() override;
 
@@ -67,4 +75,27 @@ class AUTOMATASIMULATOR_API NonDeterministicTuringMachine : public TuringMachine
 	 * @throws InvalidStartStateException If the start state is not set.
 	 */
 	bool simulate(const std::vector<std::string> &input, const int &simulationDepth = 50) override;
+
+	/**
+	 * @brief Simulates the machine on many inputs, checking the start state and interning the inputs once for the
+	 * whole batch.
+	 * @param inputs The input strings to process.
+	 * @param simulationDepth The maximum number of transitions to simulate per input. Default is 50.
+	 * @return Whether each input is accepted, in order.
+	 * @throws InvalidStartStateException If the start state is not set.
+	 */
+	std::vector<bool> simulateBatch(const std::vector<std::vector<std::string>> &inputs,
+	                                const int &simulationDepth = 50) override;
+
+	/**
+	 * @brief Simulates the automaton on many inputs on a pool of worker threads sharing the automaton.
+	 * @param inputs The input strings to process.
+	 * @param threadCount The number of worker threads, 0 to use the hardware concurrency. Default is 0.
+	 * @param simulationDepth The maximum number of transitions to simulate per input. Default is 50.
+	 * @return Whether each input is accepted, in order.
+	 * @throws InvalidStartStateException If the start state is not set.
+	 */
+	std::vector<bool> simulateBatchParallel(const std::vector<std::vector<std::string>> &inputs,
+	                                        const std::size_t &threadCount = 0,
+	                                        const int &simulationDepth = 50) override;
 };
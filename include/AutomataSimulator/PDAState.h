@@ -1,6 +1,7 @@
 #pragma once
 #include "PDATransition.h"
 #include "config.h"
+#include <array>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -25,7 +26,7 @@ class AUTOMATASIMULATOR_API PDAState {
 	/**
 	 * @brief Transitions the start from the state.
 	 */
-	std::unordered_map<std::string, PDATransition> transitions;
+	std::unordered_map<TransitionKey, PDATransition> transitions;
 
 	/**
 	 * @brief Boolean indicating whether it is an accept state.
@@ -42,6 +43,17 @@ class AUTOMATASIMULATOR_API PDAState {
 	 */
 	bool transitionsCacheInvalidated;
 
+	/**
+	 * @brief Transitions grouped by their input and stack symbol ids, packed into one key, kept current on every change
+	 * to the transitions.
+	 */
+	std::unordered_map<uint64_t, std::vector<PDATransition>> transitionsByInputAndStack;
+
+	/**
+	 * @brief Number of transitions reading a non-epsilon input, by stack symbol id.
+	 */
+	std::unordered_map<SymbolId, std::size_t> inputTransitionCounts;
+
 	/**
 	 * @brief Gets the transition with the key provided.
 	 * @param key The key of the transition to get.
@@ -49,6 +61,25 @@ class AUTOMATASIMULATOR_API PDAState {
 	 */
 	PDATransition *getTransitionInternal(const std::string &key);
 
+	/**
+	 * @brief Replaces a transition with an updated copy stored under its new key.
+	 * @param transitionKey The key of the transition to replace.
+	 * @param transition The updated transition.
+	 */
+	void replaceTransition(const TransitionKey &transitionKey, const PDATransition &transition);
+
+	/**
+	 * @brief Adds a transition to the bucket of its input and stack symbol.
+	 * @param transition The transition to add.
+	 */
+	void addToInputIndex(const PDATransition &transition);
+
+	/**
+	 * @brief Removes a transition from the bucket of its input and stack symbol, dropping the bucket once it is empty.
+	 * @param transition The transition to remove.
+	 */
+	void removeFromInputIndex(const PDATransition &transition);
+
   public:
 	PDAState();
 
@@ -129,6 +160,13 @@ class AUTOMATASIMULATOR_API PDAState {
 	 */
 	bool transitionExists(const std::string &key) const;
 
+	/**
+	 * @brief Checks if a transition exists.
+	 * @param key The structured key of the transition.
+	 * @return Bool indicating whether the transition exists or not.
+	 */
+	bool transitionExists(const TransitionKey &key) const;
+
 	/**
 	 * @brief Adds a transition to the state's transitions vector.
 	 * @param toStateKey The to state key of the transition.
@@ -153,6 +191,14 @@ class AUTOMATASIMULATOR_API PDAState {
 	 */
 	PDATransition getTransition(const std::string &key);
 
+	/**
+	 * @brief Gets the transition with the structured key provided.
+	 * @param key The structured key of the transition to get.
+	 * @return The transition with the specified key.
+	 * @throw TransitionNotFoundException If transition is not found.
+	 */
+	PDATransition getTransition(const TransitionKey &key);
+
 	/**
 	 * @brief Sets a transition input.
 	 * @param transitionKey The key of the transition.
@@ -179,6 +225,15 @@ class AUTOMATASIMULATOR_API PDAState {
 	 */
 	void setTransitionToState(const std::string &transitionKey, const std::string &toState);
 
+	/**
+	 * @brief Sets a transition to state.
+	 * @param transitionKey The structured key of the transition.
+	 * @param toState The key of the to state.
+	 * @throw TransitionNotFoundException If transition is not found.
+	 * @throw InvalidTransitionException If the transition already exists.
+	 */
+	void setTransitionToState(const TransitionKey &transitionKey, const std::string &toState);
+
 	/**
 	 * @brief Gets a transition stack symbol.
 	 * @param transitionKey The key of the transition.
@@ -220,6 +275,13 @@ class AUTOMATASIMULATOR_API PDAState {
 	 */
 	void removeTransition(const std::string &transitionKey);
 
+	/**
+	 * @brief Removes a transition from the state's transitions vector.
+	 * @param transitionKey The structured key of the transition.
+	 * @throws TransitionNotFoundException If transition is not found.
+	 */
+	void removeTransition(const TransitionKey &transitionKey);
+
 	/**
 	 * @brief Clears transitions to the to state from the state's transitions vector.
 	 * @param toStateKey The to state key of the transition.
@@ -232,6 +294,38 @@ class AUTOMATASIMULATOR_API PDAState {
 	 */
 	std::vector<PDATransition> getTransitions();
 
+	/**
+	 * @brief Gets transitions from the state without copying them.
+	 * @return A reference to the cached transitions, valid until the transitions of the state change.
+	 */
+	const std::vector<PDATransition> &getTransitionsView();
+
+	/**
+	 * @brief Gets the transitions reading an input and stack symbol, without scanning the other transitions of the
+	 * state.
+	 * @param input The id of the input symbol, epsilon for transitions that read no input.
+	 * @param stackSymbol The id of the stack symbol, epsilon for transitions that pop nothing.
+	 * @return A reference to the transitions, valid until the transitions of the state change.
+	 */
+	const std::vector<PDATransition> &getTransitionsOn(const SymbolId &input, const SymbolId &stackSymbol) const;
+
+	/**
+	 * @brief Gets the transitions that can fire in a configuration, from the most to the least specific.
+	 * @param input The id of the next input symbol, epsilon once the input is consumed.
+	 * @param stackTop The id of the symbol on top of the stack, epsilon if the stack is empty.
+	 * @return The transitions on (input, stackTop), (input, epsilon), (epsilon, stackTop) and (epsilon, epsilon), a
+	 * group repeating an earlier one is left empty.
+	 */
+	std::array<const std::vector<PDATransition> *, 4> getCandidateTransitions(const SymbolId &input,
+	                                                                          const SymbolId &stackTop) const;
+
+	/**
+	 * @brief Checks if the state has a transition reading a non-epsilon input with a stack symbol.
+	 * @param stackSymbol The id of the stack symbol.
+	 * @return Bool indicating whether such a transition exists or not.
+	 */
+	bool hasInputTransitionOnStack(const SymbolId &stackSymbol) const;
+
 	/**
 	 * @brief Clears all transitions from the state's transitions vector.
 	 */
@@ -1,7 +1,10 @@
 #pragma once
 #include "AutomatonException.h"
+#include "SymbolTable.h"
+#include "TransitionKey.h"
 #include "config.h"
 #include <string>
+#include <vector>
 
 /**
  * @brief Represents a transition between two states in an automaton.
@@ -10,9 +13,9 @@
 class AUTOMATASIMULATOR_API PDATransition {
   private:
 	/**
-	 * @brief Unique identifier for the transition, formatted as "fromState-toState-Input".
+	 * @brief Structured unique identifier for the transition, kept in sync with its states and symbols.
 	 */
-	std::string key;
+	TransitionKey key;
 
 	/**
 	 * @brief The key of the state from which the transition starts.
@@ -25,14 +28,14 @@ class AUTOMATASIMULATOR_API PDATransition {
 	std::string toStateKey;
 
 	/**
-	 * @brief The input value that triggers the transition.
+	 * @brief Interned id of the input value that triggers the transition.
 	 */
-	std::string input;
+	SymbolId input;
 
 	/**
-	 * @brief The top of the stack symbol,
+	 * @brief Interned id of the top of the stack symbol,
 	 */
-	std::string stackSymbol;
+	SymbolId stackSymbol;
 
 	/**
 	 * @brief The Symbol to be pushed onto the stack.
@@ -40,9 +43,20 @@ class AUTOMATASIMULATOR_API PDATransition {
 	std::string pushSymbol;
 
 	/**
-	 * @brief Validates the format of a transition key
+	 * @brief Interned ids of the push symbols, split once whenever the push symbol is set.
 	 */
-	static void validateTransitionKeyFormat(const std::string &key);
+	std::vector<SymbolId> pushSymbolIds;
+
+	/**
+	 * @brief Splits a transition key into its parts, validating its format
+	 * @throws TransitionNotFoundException If the key does not have the expected number of parts.
+	 */
+	static std::vector<std::string> splitTransitionKey(const std::string &key);
+
+	/**
+	 * @brief Rebuilds the structured key from the states and symbols.
+	 */
+	void updateKey();
 
   public:
 	PDATransition();
@@ -104,6 +118,28 @@ class AUTOMATASIMULATOR_API PDATransition {
 	                                         const std::string &input, const std::string &stackSymbol,
 	                                         const std::string &pushSymbol);
 
+	/**
+	 * @brief Generate a unique transition key from a structured key.
+	 * @param key The structured key.
+	 * @return A unique transition key string.
+	 */
+	static std::string generateTransitionKey(const TransitionKey &key);
+
+	/**
+	 * @brief Parses a transition key string into a structured key, looking up its parts without interning them.
+	 * @param key The transition key.
+	 * @return The structured key, which matches no transition if a part was never interned.
+	 * @throws TransitionNotFoundException if the transition key format is invalid.
+	 */
+	static TransitionKey parseTransitionKey(const std::string &key);
+
+	/**
+	 * @brief Splits a comma separated push symbols string, dropping empty symbols.
+	 * @param pushSymbols Push symbols string.
+	 * @return Separated symbols.
+	 */
+	static std::vector<std::string> parsePushSymbols(const std::string &pushSymbols);
+
 	/**
 	 * @brief Gets the to state key of a transition from its key.
 	 * @param key The transition key.
@@ -145,6 +181,12 @@ class AUTOMATASIMULATOR_API PDATransition {
 	 */
 	std::string getKey() const;
 
+	/**
+	 * @brief Gets the structured unique key for this transition.
+	 * @return The structured key.
+	 */
+	const TransitionKey &getTransitionKey() const;
+
 	/**
 	 * @brief Sets the "from" state of this transition.
 	 * @param key The new "from" state key.
@@ -181,6 +223,12 @@ class AUTOMATASIMULATOR_API PDATransition {
 	 */
 	std::string getInput() const;
 
+	/**
+	 * @brief Gets the interned id of the input value for this transition.
+	 * @return The input symbol id.
+	 */
+	SymbolId getInputId() const;
+
 	/**
 	 * @brief Sets the top of the stack symbol for this transition.
 	 * @param stackSymbol The new stack symbol.
@@ -193,6 +241,12 @@ class AUTOMATASIMULATOR_API PDATransition {
 	 */
 	std::string getStackSymbol() const;
 
+	/**
+	 * @brief Gets the interned id of the top of the stack symbol for this transition.
+	 * @return The stack symbol id.
+	 */
+	SymbolId getStackSymbolId() const;
+
 	/**
 	 * @brief Sets the symbol to be pushed onto the stack for this transition.
 	 * @param pushSymbol The new push symbol.
@@ -205,6 +259,12 @@ class AUTOMATASIMULATOR_API PDATransition {
 	 */
 	std::string getPushSymbol() const;
 
+	/**
+	 * @brief Gets the interned ids of the symbols to be pushed onto the stack, in the order they are listed.
+	 * @return A reference to the push symbol ids, empty if the transition pushes nothing.
+	 */
+	const std::vector<SymbolId> &getPushSymbolIds() const;
+
 	/**
 	 * @brief Gets a string representation of this transition.
 	 * @return A string representation of the transition.
@@ -216,7 +276,7 @@ namespace std {
 template <> struct hash<PDATransition> {
 	size_t operator()(const PDATransition &t) const {
 		size_t hashValue = hash<std::string>()(t.getFromStateKey()) ^ (hash<std::string>()(t.getToStateKey()) << 1) ^
-		                   (hash<std::string>()(t.getInput()) << 2) ^ (hash<std::string>()(t.getStackSymbol()) << 3) ^
+		                   (hash<SymbolId>()(t.getInputId()) << 2) ^ (hash<SymbolId>()(t.getStackSymbolId()) << 3) ^
 		                   (hash<std::string>()(t.getPushSymbol()) << 4);
 		return hashValue;
 	}
@@ -1,4 +1,5 @@
 #pragma once
+#include "CacheMutex.h"
 #include "PDAState.h"
 #include <queue>
 #include <set>
@@ -19,9 +20,9 @@ extern const std::string INITIAL_STACK_SYMBOL;
 class AUTOMATASIMULATOR_API PushdownAutomaton {
   protected:
 	/**
-	 * @brief The input of the automaton.
+	 * @brief The input of the automaton, as interned symbol ids.
 	 */
-	std::vector<std::string> input;
+	std::vector<SymbolId> input;
 
 	/**
 	 * @brief The head of the input tape.
@@ -39,14 +40,20 @@ class AUTOMATASIMULATOR_API PushdownAutomaton {
 	std::unordered_map<std::string, PDAState> states;
 
 	/**
-	 * @brief Finite set of input symbols. Formally defined as Sigma.
+	 * @brief Keys of the transitions leading into each state, by the key of the state.
+	 * @brief Each key names its from state, so editing a state only visits its own edges.
 	 */
-	std::unordered_set<std::string> inputAlphabet;
+	std::unordered_map<std::string, std::unordered_set<TransitionKey>> incomingTransitions;
 
 	/**
-	 * @brief Finite set of stack symbols. Formally defined as Gamma.
+	 * @brief Finite set of input symbol ids. Formally defined as Sigma.
 	 */
-	std::unordered_set<std::string> stackAlphabet;
+	std::unordered_set<SymbolId> inputAlphabet;
+
+	/**
+	 * @brief Finite set of stack symbol ids. Formally defined as Gamma.
+	 */
+	std::unordered_set<SymbolId> stackAlphabet;
 
 	/**
 	 * @brief Start state key. Formally defined as q0.
@@ -54,9 +61,9 @@ class AUTOMATASIMULATOR_API PushdownAutomaton {
 	std::string startState;
 
 	/**
-	 * @brief Stack for the pushdown automaton.
+	 * @brief Stack for the pushdown automaton, as interned symbol ids.
 	 */
-	std::stack<std::string> stack;
+	std::stack<SymbolId> stack;
 
 	/**
 	 * @brief Cached convertion of the states from unordered map to vector.
@@ -88,6 +95,18 @@ class AUTOMATASIMULATOR_API PushdownAutomaton {
 	 */
 	bool stackAlphabetCacheInvalidated;
 
+	/**
+	 * @brief Counter incremented on every change to the states, transitions, start state or alphabets.
+	 * @brief Derived structures built from the definition compare against it to detect staleness.
+	 */
+	std::size_t definitionVersion;
+
+	/**
+	 * @brief Guards prepareConcurrentSimulation, so concurrent batches over this automaton never build a cache while
+	 * another reads it. Other automata have their own lock.
+	 */
+	CacheMutex simulationCachesMutex;
+
 	/**
 	 * @brief Splits the push symbols string
 	 * @param pushSymbols Push symbols string
@@ -102,6 +121,32 @@ class AUTOMATASIMULATOR_API PushdownAutomaton {
 	 */
 	PDAState *getStateInternal(const std::string &key);
 
+	/**
+	 * @brief Records a transition in the incoming index of its to state.
+	 * @param transition The transition to record.
+	 */
+	void indexTransition(const PDATransition &transition);
+
+	/**
+	 * @brief Removes a transition from the incoming index of its to state.
+	 * @param transition The transition to remove.
+	 */
+	void unindexTransition(const PDATransition &transition);
+
+	/**
+	 * @brief Removes a transition from its from state and from the incoming index.
+	 * @param state The from state of the transition.
+	 * @param transition The transition to remove.
+	 */
+	void removeTransitionInternal(PDAState &state, const PDATransition &transition);
+
+	/**
+	 * @brief Removes the incoming and outgoing transitions of a state from the incoming index, before the state is
+	 * erased.
+	 * @param key The key of the state.
+	 */
+	void unindexState(const std::string &key);
+
 	/**
 	 * @brief Checks if the transition is valid and throws an exception if it is not.
 	 * @param fromStateKey The key of the state to transition from.
@@ -112,6 +157,20 @@ class AUTOMATASIMULATOR_API PushdownAutomaton {
 	void validateTransition(const std::string &fromStateKey, const std::string &toStateKey, const std::string &input,
 	                        const std::string &stackSymol, const std::string &pushSymbol);
 
+	/**
+	 * @brief Builds every lazily computed structure that simulation reads, so that simulating afterwards only reads
+	 * the automaton.
+	 * @brief Runs under the automaton's own lock, so a batch never builds a cache while a concurrent batch over the
+	 * same unchanged automaton reads it.
+	 */
+	void prepareConcurrentSimulation();
+
+	/**
+	 * @brief Builds the structures read by simulation, called by prepareConcurrentSimulation under its lock.
+	 * @brief Overrides that build their own structures must call the base version.
+	 */
+	virtual void buildSimulationCaches();
+
   public:
 	/**
 	 * @brief Constructs a new Pushdown Automaton object.
@@ -253,6 +312,12 @@ class AUTOMATASIMULATOR_API PushdownAutomaton {
 	 */
 	std::vector<PDAState> getStates();
 
+	/**
+	 * @brief Gets the states of the automaton without copying them.
+	 * @return A reference to the cached states, valid until the automaton is modified.
+	 */
+	const std::vector<PDAState> &getStatesView();
+
 	/**
 	 * @brief Removes a state from the automaton.
 	 * @param key The key of the state to remove.
@@ -530,6 +595,8 @@ class AUTOMATASIMULATOR_API PushdownAutomaton {
 
 	/**
 	 * @brief Simulates the automaton on a given input string and depth.
+	 * @brief Builds caches lazily, so concurrent calls on the same automaton are not safe. Use simulateBatchParallel,
+	 * or a frozen snapshot where one exists, to simulate from several threads.
 	 * @param input The input strings to process.
 	 * @param simulationDepth The maximum number of transitions to simulate. Default is 50.
 	 * @return True if the input is accepted, false otherwise.
@@ -538,6 +605,32 @@ class AUTOMATASIMULATOR_API PushdownAutomaton {
 	 */
 	virtual bool simulate(const std::vector<std::string> &input, const int &simulationDepth = 50) = 0;
 
+	/**
+	 * @brief Simulates the automaton on many inputs, checking the definition and preparing shared state once.
+	 * @brief Each result is the same as simulate would return for that input.
+	 * @param inputs The input strings to process.
+	 * @param simulationDepth The maximum number of transitions to simulate per input. Default is 50.
+	 * @return Whether each input is accepted, in order.
+	 * @throws InvalidStartStateException If the start state is not set.
+	 */
+	virtual std::vector<bool> simulateBatch(const std::vector<std::vector<std::string>> &inputs,
+	                                        const int &simulationDepth = 50) = 0;
+
+	/**
+	 * @brief Simulates the automaton on many inputs on a pool of worker threads sharing the automaton.
+	 * @brief The caches read by simulation are built once before the workers start and the workers only read the
+	 * automaton, so concurrent calls on the same automaton are safe as long as it is not modified meanwhile.
+	 * @brief Each result is the same as simulateBatch would return for that input.
+	 * @param inputs The input strings to process.
+	 * @param threadCount The number of worker threads, 0 to use the hardware concurrency. Default is 0.
+	 * @param simulationDepth The maximum number of transitions to simulate per input. Default is 50.
+	 * @return Whether each input is accepted, in order.
+	 * @throws InvalidStartStateException If the start state is not set.
+	 */
+	virtual std::vector<bool> simulateBatchParallel(const std::vector<std::vector<std::string>> &inputs,
+	                                                const std::size_t &threadCount = 0,
+	                                                const int &simulationDepth = 50) = 0;
+
 	/**
 	 * @brief Checks if the provided state is valid as the next state the automaton could transition to.
 	 * @param key The key of the state.
@@ -0,0 +1,9 @@
+#pragma once
+#include "config.h"
+
+/**
+ * @brief Outcome of a simulation that watches for the automaton looping.
+ * @brief ACCEPTED and REJECTED are decided outcomes, DIVERGES means the automaton was found to run forever and
+ * OUT_OF_BUDGET that the simulation depth ran out before either could be told.
+ */
+enum class AUTOMATASIMULATOR_API SimulationResult { ACCEPTED, REJECTED, DIVERGES, OUT_OF_BUDGET };
@@ -0,0 +1,119 @@
+#pragma once
+#include "SymbolTable.h"
+#include "config.h"
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Pool of persistent, immutable stacks of symbol ids, stored as linked nodes that point to the node below them.
+ * Nodes are hash-consed: pushing a symbol onto a stack returns the existing node if that push was made before, so two
+ * stacks with the same contents always have the same id. Branches of a simulation share the common bottom of their
+ * stacks, and stacks are copied, compared and hashed in O(1) by their id. A pool is not thread safe, each simulation
+ * owns its own.
+ */
+class AUTOMATASIMULATOR_API StackPool {
+  public:
+	/**
+	 * @brief Identifier of a stack in the pool, the id of its top node.
+	 */
+	typedef uint32_t StackId;
+
+	/**
+	 * @brief Id of the empty stack, valid in every pool.
+	 */
+	static constexpr StackId EMPTY_STACK = 0;
+
+  private:
+	/**
+	 * @brief A symbol on a stack and the stack below it.
+	 */
+	struct Node {
+		SymbolId symbol;
+		StackId below;
+
+		/**
+		 * @brief Number of symbols in the stack this node is the top of.
+		 */
+		uint32_t size;
+	};
+
+	/**
+	 * @brief Nodes of all the stacks, indexed by stack id. The first node stands for the empty stack.
+	 */
+	std::vector<Node> nodes;
+
+	/**
+	 * @brief Id of the node for each push made so far, keyed by the stack below and the symbol packed together.
+	 */
+	std::unordered_map<uint64_t, StackId> nodeIds;
+
+  public:
+	/**
+	 * @brief Constructs a pool holding only the empty stack.
+	 */
+	StackPool();
+
+	/**
+	 * @brief Pushes a symbol onto a stack, leaving the stack itself unchanged.
+	 * @param stack The stack to push onto.
+	 * @param symbol The id of the symbol to push.
+	 * @return The stack with the symbol on top.
+	 */
+	StackId push(const StackId &stack, const SymbolId &symbol);
+
+	/**
+	 * @brief Pushes symbols onto a stack one after the other, leaving the stack itself unchanged.
+	 * @param stack The stack to push onto.
+	 * @param symbols The ids of the symbols to push, the last one ends on top.
+	 * @return The stack with the symbols on top.
+	 */
+	StackId push(const StackId &stack, const std::vector<SymbolId> &symbols);
+
+	/**
+	 * @brief Gets the stack below the top symbol of a stack.
+	 * @param stack The stack to pop from.
+	 * @return The stack without its top symbol, the empty stack stays empty.
+	 */
+	StackId pop(const StackId &stack) const;
+
+	/**
+	 * @brief Gets the top symbol of a stack.
+	 * @param stack The stack.
+	 * @return The id of the top symbol, epsilon if the stack is empty.
+	 */
+	SymbolId top(const StackId &stack) const;
+
+	/**
+	 * @brief Checks if a stack is empty.
+	 * @param stack The stack.
+	 * @return True if the stack holds no symbols, false otherwise.
+	 */
+	bool empty(const StackId &stack) const;
+
+	/**
+	 * @brief Gets the number of symbols on a stack.
+	 * @param stack The stack.
+	 * @return The number of symbols.
+	 */
+	std::size_t size(const StackId &stack) const;
+
+	/**
+	 * @brief Copies the symbols of a stack out of the pool.
+	 * @param stack The stack.
+	 * @return The ids of the symbols, with the top at the back.
+	 */
+	std::vector<SymbolId> toVector(const StackId &stack) const;
+
+	/**
+	 * @brief Gets the number of nodes in the pool, counting the empty stack.
+	 * @return The number of nodes.
+	 */
+	std::size_t getNodeCount() const;
+
+	/**
+	 * @brief Removes every stack but the empty one, keeping the capacity of the pool for reuse.
+	 */
+	void clear();
+};
@@ -0,0 +1,92 @@
+#pragma once
+#include "config.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Dense integer id of an interned symbol.
+ */
+typedef uint32_t SymbolId;
+
+/**
+ * @brief Process-wide table interning symbols to dense integer ids.
+ * Shared by the input, stack and tape alphabets of every automaton so that symbols compare by integer equality.
+ * Symbols are never removed, so an id stays valid for the lifetime of the process.
+ */
+class AUTOMATASIMULATOR_API SymbolTable {
+  public:
+	/**
+	 * @brief Id of the empty symbol (epsilon), always interned first.
+	 */
+	static constexpr SymbolId EPSILON_SYMBOL_ID = 0;
+
+	/**
+	 * @brief Id returned for symbols that were never interned, it never matches a real symbol.
+	 */
+	static constexpr SymbolId UNKNOWN_SYMBOL_ID = UINT32_MAX;
+
+	/**
+	 * @brief Interns a symbol, assigning it the next free id if it is new.
+	 * @param symbol The symbol to intern.
+	 * @return The id of the symbol.
+	 */
+	static SymbolId intern(const std::string &symbol);
+
+	/**
+	 * @brief Interns a sequence of symbols.
+	 * @param symbols The symbols to intern.
+	 * @return The ids of the symbols, in order.
+	 */
+	static std::vector<SymbolId> intern(const std::vector<std::string> &symbols);
+
+	/**
+	 * @brief Interns many sequences of symbols, taking the table lock once for all of them.
+	 * @param sequences The sequences of symbols to intern.
+	 * @return The ids of the symbols of each sequence, in order.
+	 */
+	static std::vector<std::vector<SymbolId>> intern(const std::vector<std::vector<std::string>> &sequences);
+
+	/**
+	 * @brief Looks up the id of a symbol without interning it.
+	 * @param symbol The symbol to look up.
+	 * @return The id of the symbol, or UNKNOWN_SYMBOL_ID if it was never interned.
+	 */
+	static SymbolId find(const std::string &symbol);
+
+	/**
+	 * @brief Looks up the ids of a sequence of symbols without interning them.
+	 * @param symbols The symbols to look up.
+	 * @return The ids of the symbols in order, UNKNOWN_SYMBOL_ID for symbols that were never interned.
+	 */
+	static std::vector<SymbolId> find(const std::vector<std::string> &symbols);
+
+	/**
+	 * @brief Looks up the ids of many sequences of symbols without interning them, taking the table lock once.
+	 * @param sequences The sequences of symbols to look up.
+	 * @return The ids of the symbols of each sequence in order, UNKNOWN_SYMBOL_ID for symbols that were never interned.
+	 */
+	static std::vector<std::vector<SymbolId>> find(const std::vector<std::vector<std::string>> &sequences);
+
+	/**
+	 * @brief Gets the symbol interned under an id.
+	 * @param id The id of the symbol.
+	 * @return The symbol string.
+	 * @throws std::out_of_range If the id was never assigned.
+	 */
+	static const std::string &getSymbol(const SymbolId &id);
+
+	/**
+	 * @brief Gets the symbols interned under a sequence of ids.
+	 * @param ids The ids of the symbols.
+	 * @return The symbol strings, in order.
+	 * @throws std::out_of_range If an id was never assigned.
+	 */
+	static std::vector<std::string> getSymbols(const std::vector<SymbolId> &ids);
+
+	/**
+	 * @brief Gets the number of interned symbols.
+	 * @return The number of interned symbols.
+	 */
+	static std::size_t size();
+};
@@ -0,0 +1,98 @@
+#pragma once
+#include "SymbolTable.h"
+#include "TMTape.h"
+#include "config.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Set of Turing machine configurations, a state together with a tape, used to skip configurations a search
+ * has already reached.
+ * @brief Configurations are found by the fingerprint of their state and tape in an open-addressing table with linear
+ * probing, so a lookup costs O(1) whatever the length of the tape. The tapes are only compared when two fingerprints
+ * match, to rule out a collision. A set is not thread safe, each simulation owns its own.
+ */
+class AUTOMATASIMULATOR_API TMConfigurationSet {
+  private:
+	/**
+	 * @brief A configuration stored in the set.
+	 */
+	struct Entry {
+		SymbolId state;
+		TMTape tape;
+	};
+
+	/**
+	 * @brief A slot of the table, the fingerprint of a configuration and the index of its entry plus one, 0 if empty.
+	 */
+	struct Slot {
+		uint64_t fingerprint;
+		uint32_t entry;
+	};
+
+	/**
+	 * @brief The table, its size a power of two kept at least twice the number of entries.
+	 */
+	std::vector<Slot> slots;
+
+	/**
+	 * @brief The configurations in the set, in the order they were inserted.
+	 */
+	std::vector<Entry> entries;
+
+	/**
+	 * @brief Computes the fingerprint of a configuration.
+	 * @param state The id of the state.
+	 * @param tape The tape.
+	 * @return The fingerprint.
+	 */
+	static uint64_t fingerprint(const SymbolId &state, const TMTape &tape);
+
+	/**
+	 * @brief Finds the slot holding a configuration, or the empty slot where it would go.
+	 * @param fingerprint The fingerprint of the configuration.
+	 * @param state The id of the state.
+	 * @param tape The tape.
+	 * @return The index of the slot.
+	 */
+	std::size_t findSlot(const uint64_t &fingerprint, const SymbolId &state, const TMTape &tape) const;
+
+	/**
+	 * @brief Doubles the size of the table, moving every entry to its slot in the new table.
+	 */
+	void grow();
+
+  public:
+	/**
+	 * @brief Constructs an empty set.
+	 */
+	TMConfigurationSet();
+
+	/**
+	 * @brief Adds a configuration to the set.
+	 * @param state The id of the state.
+	 * @param tape The tape, copied into the set.
+	 * @return True if the configuration was added, false if it was already in the set.
+	 */
+	bool insert(const SymbolId &state, const TMTape &tape);
+
+	/**
+	 * @brief Checks if a configuration is in the set.
+	 * @param state The id of the state.
+	 * @param tape The tape.
+	 * @return True if the configuration is in the set, false otherwise.
+	 */
+	bool contains(const SymbolId &state, const TMTape &tape) const;
+
+	/**
+	 * @brief Gets the number of configurations in the set.
+	 * @return The number of configurations.
+	 */
+	std::size_t size() const;
+
+	/**
+	 * @brief Removes every configuration, keeping the capacity of the set for reuse.
+	 */
+	void clear();
+};
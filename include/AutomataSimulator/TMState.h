@@ -4,6 +4,7 @@
 #include "config.h"
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 class AUTOMATASIMULATOR_API TMState {
   private:
@@ -20,7 +21,7 @@ class AUTOMATASIMULATOR_API TMState {
 	/**
 	 * @brief Transitions the start from the state.
 	 */
-	std::unordered_map<std::string, TMTransition> transitions;
+	std::unordered_map<TransitionKey, TMTransition> transitions;
 
 	/**
 	 * @brief Boolean indicating whether it is an accept state.
@@ -44,6 +45,13 @@ class AUTOMATASIMULATOR_API TMState {
 	 */
 	TMTransition *getTransitionInternal(const std::string &key);
 
+	/**
+	 * @brief Replaces a transition with an updated copy stored under its new key.
+	 * @param transitionKey The key of the transition to replace.
+	 * @param transition The updated transition.
+	 */
+	void replaceTransition(const TransitionKey &transitionKey, const TMTransition &transition);
+
   public:
 	TMState();
 
@@ -124,6 +132,13 @@ class AUTOMATASIMULATOR_API TMState {
 	 */
 	bool transitionExists(const std::string &key) const;
 
+	/**
+	 * @brief Checks if a transition exists.
+	 * @param key The structured key of the transition.
+	 * @return Bool indicating whether the transition exists or not.
+	 */
+	bool transitionExists(const TransitionKey &key) const;
+
 	/**
 	 * @brief Adds a transition to the state's transitions vector.
 	 * @param toStateKey The to state key of the transition.
@@ -142,6 +157,14 @@ class AUTOMATASIMULATOR_API TMState {
 	 */
 	TMTransition getTransition(const std::string &key);
 
+	/**
+	 * @brief Gets the transition with the structured key provided.
+	 * @param key The structured key of the transition to get.
+	 * @return The transition with the specified key.
+	 * @throw TransitionNotFoundException If transition is not found.
+	 */
+	TMTransition getTransition(const TransitionKey &key);
+
 	/**
 	 * @brief Gets a transition to state.
 	 * @param transitionKey The key of the transition.
@@ -159,6 +182,15 @@ class AUTOMATASIMULATOR_API TMState {
 	 */
 	void setTransitionToState(const std::string &transitionKey, const std::string &toState);
 
+	/**
+	 * @brief Sets a transition to state.
+	 * @param transitionKey The structured key of the transition.
+	 * @param toState The key of the to state.
+	 * @throw TransitionNotFoundException If transition is not found.
+	 * @throw InvalidTransitionException If the transition already exists.
+	 */
+	void setTransitionToState(const TransitionKey &transitionKey, const std::string &toState);
+
 	/**
 	 * @brief Gets a transition read symbol.
 	 * @param transitionKey The key of the transition.
@@ -217,6 +249,13 @@ class AUTOMATASIMULATOR_API TMState {
 	 */
 	void removeTransition(const std::string &transitionKey);
 
+	/**
+	 * @brief Removes a transition from the state's transitions vector.
+	 * @param transitionKey The structured key of the transition.
+	 * @throws TransitionNotFoundException If transition is not found.
+	 */
+	void removeTransition(const TransitionKey &transitionKey);
+
 	/**
 	 * @brief Clears transitions to the to state from the state's transitions vector.
 	 * @param toStateKey The to state key of the transition.
@@ -229,6 +268,12 @@ class AUTOMATASIMULATOR_API TMState {
 	 */
 	std::vector<TMTransition> getTransitions();
 
+	/**
+	 * @brief Gets transitions from the state without copying them.
+	 * @return A reference to the cached transitions, valid until the transitions of the state change.
+	 */
+	const std::vector<TMTransition> &getTransitionsView();
+
 	/**
 	 * @brief Clears all transitions from the state's transitions vector.
 	 */
@@ -1,31 +1,162 @@
 #pragma once
 #include "AutomatonException.h"
+#include "SymbolTable.h"
 #include "TMDirection.h"
+#include "TMTapeMode.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <list>
+#include <memory>
 #include <string>
 #include <vector>
 
 class TMTape {
+  public:
+	/**
+	 * @brief A maximal run of equal symbols on a run-length tape.
+	 */
+	struct Run {
+		SymbolId symbol;
+		int length;
+	};
+
+	/**
+	 * @brief Number of cells in a chunk of a chunked tape.
+	 */
+	static constexpr std::size_t CHUNK_SIZE = 64;
+
   private:
 	/**
-	 * @brief The tape of the Turing Machine.
+	 * @brief A block of cells of a chunked tape, cells past the end of the tape are blank.
+	 */
+	typedef std::array<SymbolId, CHUNK_SIZE> Chunk;
+
+	/**
+	 * @brief How the cells of the tape are stored, selecting which of tape, runs and chunks holds them.
+	 */
+	TMTapeMode mode;
+
+	/**
+	 * @brief The tape of the Turing Machine, as interned symbol ids stored contiguously.
+	 * @brief The tape is bounded on the left and grows to the right, so cells are indexed from the left end.
+	 */
+	std::vector<SymbolId> tape;
+
+	/**
+	 * @brief The cells of a run-length tape from the left end, with no two neighbouring runs sharing a symbol.
+	 */
+	std::vector<Run> runs;
+
+	/**
+	 * @brief The cells of a chunked tape, shared with copies of the tape until a write copies the chunk written to.
+	 */
+	std::vector<std::shared_ptr<Chunk>> chunks;
+
+	/**
+	 * @brief The number of cells of a chunked tape.
 	 */
-	std::list<std::string> tape;
+	std::size_t chunkedSize;
 
 	/**
-	 *  The current tape head
+	 * @brief The number of cells of a run-length tape, the sum of the lengths of the runs.
 	 */
-	std::list<std::string>::iterator head;
+	std::size_t runsSize;
 
 	/**
-	 * @brief The position of the head on the tape.
+	 * @brief The position of the head on the tape, the index of the cell under it.
 	 */
 	int headIndex;
 
 	/**
-	 * @brief The blank symbol of the tape.
+	 * @brief Index of the run under the head on a run-length tape.
+	 */
+	std::size_t headRun;
+
+	/**
+	 * @brief Offset of the head inside the run under it on a run-length tape.
+	 */
+	int headOffset;
+
+	/**
+	 * @brief Interned id of the blank symbol of the tape.
+	 */
+	SymbolId blankSymbol;
+
+	/**
+	 * @brief Polynomial hash of the cells, the sum of the value of each cell symbol times BASE to the power of its
+	 * index, modulo the Mersenne prime 2^61 - 1. Blank cells are worth 0, so the hash ignores how far the tape grew.
+	 */
+	uint64_t contentHash;
+
+	/**
+	 * @brief BASE to the power of the head index modulo 2^61 - 1, the weight of the cell under the head.
+	 */
+	uint64_t headPower;
+
+	/**
+	 * @brief Gets the value a symbol adds to the content hash for each cell holding it.
+	 * @param symbol The id of the symbol.
+	 * @return The value, 0 for the blank symbol.
+	 */
+	uint64_t symbolValue(const SymbolId &symbol) const;
+
+	/**
+	 * @brief Recomputes the content hash and head power from the cells, after the tape changed in bulk.
+	 */
+	void rehash();
+
+	/**
+	 * @brief Gets a cell of a contiguous or chunked tape.
+	 * @param index The index of the cell.
+	 * @return The id of the symbol in the cell.
+	 */
+	SymbolId cellAt(const std::size_t &index) const;
+
+	/**
+	 * @brief Copies the cells of the tape out, whatever mode it is stored in.
+	 * @return The ids of the symbols from the left end.
+	 */
+	std::vector<SymbolId> getCells() const;
+
+	/**
+	 * @brief Replaces the cells of the tape in its current mode, leaving the head index unchanged.
+	 * @param cells The ids of the symbols from the left end.
+	 */
+	void setCells(std::vector<SymbolId> cells);
+
+	/**
+	 * @brief Grows a chunked tape with blank cells.
+	 * @param size The new number of cells, at least the current one.
+	 */
+	void growChunks(const std::size_t &size);
+
+	/**
+	 * @brief Appends cells to a list of runs, extending the last run if it holds the same symbol.
+	 * @param runs The runs to append to.
+	 * @param symbol The id of the symbol of the cells.
+	 * @param length The number of cells to append.
+	 */
+	static void appendRun(std::vector<Run> &runs, const SymbolId &symbol, const int &length);
+
+	/**
+	 * @brief Finds the run under the head and the offset inside it from the head index.
+	 */
+	void locateHead();
+
+	/**
+	 * @brief Writes a symbol under the head of a run-length tape, splitting the run under the head and merging the
+	 * written cell with the runs next to it.
+	 * @param symbol The id of the symbol to write.
+	 */
+	void writeRun(const SymbolId &symbol);
+
+	/**
+	 * @brief Makes a run of a run-length tape start at a cell, splitting the run holding it.
+	 * @param position The index of the cell, at most the size of the tape.
+	 * @return The index of the run starting at the cell, the number of runs if the cell is past the end.
 	 */
-	std::string blankSymbol;
+	std::size_t splitRunsAt(const int &position);
 
   public:
 	/**
@@ -38,6 +169,11 @@ class TMTape {
 	 */
 	TMTape(std::string blankSymbol);
 
+	/**
+	 * @brief Constructs a new Tape object storing its cells in the given mode.
+	 */
+	TMTape(std::string blankSymbol, const TMTapeMode &mode);
+
 	/**
 	 * @brief Copy constructor for the Tape object.
 	 * @param other The Tape object to copy.
@@ -64,11 +200,49 @@ class TMTape {
 	 */
 	TMTape &operator=(TMTape &&other) noexcept;
 
+	/**
+	 * @brief Compares two tapes by their cells, blank symbol and head position, whatever mode they are stored in.
+	 * @param other The tape to compare with.
+	 * @return True if the tapes hold the same cells with the head on the same cell, false otherwise.
+	 */
+	bool operator==(const TMTape &other) const;
+
+	/**
+	 * @brief Compares two tapes by their cells, blank symbol and head position, whatever mode they are stored in.
+	 * @param other The tape to compare with.
+	 * @return True if the tapes differ, false otherwise.
+	 */
+	bool operator!=(const TMTape &other) const;
+
 	/**
 	 * @brief Deconstructor for the Tape object
 	 */
 	~TMTape();
 
+	/**
+	 * @brief Sets how the tape stores its cells, converting the cells already on it.
+	 * @param mode The storage mode to use.
+	 */
+	void setMode(const TMTapeMode &mode);
+
+	/**
+	 * @brief Gets how the tape stores its cells.
+	 * @return The storage mode of the tape.
+	 */
+	TMTapeMode getMode() const;
+
+	/**
+	 * @brief Gets the number of cells on the tape.
+	 * @return The number of cells from the left end to the rightmost cell visited.
+	 */
+	std::size_t getSize() const;
+
+	/**
+	 * @brief Gets the number of maximal runs of equal symbols on the tape.
+	 * @return The number of runs.
+	 */
+	std::size_t getRunCount() const;
+
 	/**
 	 * @brief Gets the tape of the Turing Machine.
 	 * @return The tape of the Turing Machine.
@@ -87,6 +261,12 @@ class TMTape {
 	 */
 	void loadInput(const std::vector<std::string> &input);
 
+	/**
+	 * @brief Loads already interned input onto the tape.
+	 * @param input The input symbol ids to load onto the tape.
+	 */
+	void loadInput(const std::vector<SymbolId> &input);
+
 	/**
 	 * @brief Sets the blank symbol of the tape.
 	 * @brief This update all blank symbols on the tape to the new symbol.
@@ -100,6 +280,12 @@ class TMTape {
 	 */
 	std::string getBlankSymbol() const;
 
+	/**
+	 * @brief Gets the interned id of the blank symbol of the tape.
+	 * @return The blank symbol id.
+	 */
+	SymbolId getBlankSymbolId() const;
+
 	/**
 	 * @brief Sets the current head position.
 	 */
@@ -117,12 +303,24 @@ class TMTape {
 	 */
 	std::string read() const;
 
+	/**
+	 * @brief Read the interned id of the current symbol
+	 * @return The current symbol id
+	 */
+	SymbolId readId() const;
+
 	/**
 	 * @brief Writes a symbol to the tape
 	 * @param symbol The symbol to write
 	 */
 	void write(const std::string &symbol);
 
+	/**
+	 * @brief Writes an interned symbol to the tape
+	 * @param symbol The id of the symbol to write
+	 */
+	void writeId(const SymbolId &symbol);
+
 	/**
 	 * @brief Moves the the tape according to direction given.
 	 */
@@ -138,6 +336,28 @@ class TMTape {
 	 */
 	void moveRight();
 
+	/**
+	 * @brief Writes a symbol and moves the head a number of times, as that many single steps would.
+	 * @brief A run-length tape replaces the cells passed over in one go instead of one cell at a time.
+	 * @param symbol The id of the symbol to write to each cell.
+	 * @param direction The direction to move after each write.
+	 * @param count The number of writes and moves.
+	 */
+	void sweep(const SymbolId &symbol, const TMDirection &direction, const int &count);
+
+	/**
+	 * @brief Gets the number of cells of the run under the head from the head to the end of the run in a direction.
+	 * @param direction The direction to count towards.
+	 * @return The number of cells, counting the cell under the head.
+	 */
+	int getHeadRunExtent(const TMDirection &direction) const;
+
+	/**
+	 * @brief Checks if the run under the head is the rightmost run of the tape.
+	 * @return True if every cell right of the head holds the symbol under the head.
+	 */
+	bool isHeadInLastRun() const;
+
 	/**
 	 * @brief Checks if the tape is empty
 	 */
@@ -155,7 +375,23 @@ class TMTape {
 
 	/**
 	 * @brief Converts the tape to a string
+	 * @brief A run-length tape prints each run of more than one cell as "symbol*length", keeping the head cell apart.
 	 * @return The tape as a string
 	 */
 	std::string toString() const;
+
+	/**
+	 * @brief Hashes the contents of the tape and the position of the head.
+	 * @brief The hash is computed over the runs of the tape, so a tape hashes the same in either mode.
+	 * @return The hash of the tape.
+	 */
+	std::size_t hash() const;
+
+	/**
+	 * @brief Gets a 64-bit fingerprint of the cells and head position, kept up to date on every write and move.
+	 * @brief Equal tapes have equal fingerprints, and tapes that differ have equal fingerprints with a probability of
+	 * about 2^-61, so sets of tapes can compare fingerprints first and the cells only when they match.
+	 * @return The fingerprint of the tape.
+	 */
+	uint64_t getFingerprint() const;
 };
\ No newline at end of file
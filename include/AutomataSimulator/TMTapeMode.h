@@ -0,0 +1,10 @@
+#pragma once
+#include "config.h"
+
+/**
+ * @brief How a tape stores its cells.
+ * @brief CONTIGUOUS keeps one symbol per cell, RUN_LENGTH keeps runs of equal symbols so memory grows with the number
+ * of runs instead of the number of cells. CHUNKED keeps the cells in fixed-size chunks that copies of the tape share
+ * until one of them writes, so copying a tape only copies chunk pointers.
+ */
+enum class AUTOMATASIMULATOR_API TMTapeMode { CONTIGUOUS, RUN_LENGTH, CHUNKED };
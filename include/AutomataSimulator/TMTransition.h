@@ -1,8 +1,11 @@
 #pragma once
 #include "AutomatonException.h"
+#include "SymbolTable.h"
 #include "TMDirection.h"
+#include "TransitionKey.h"
 #include "config.h"
 #include <string>
+#include <vector>
 
 /**
  * @brief Represents a transition between two states in a turing machine.
@@ -11,9 +14,9 @@
 class AUTOMATASIMULATOR_API TMTransition {
   private:
 	/**
-	 * @brief Unique identifier for the transition, formatted as "fromState-toState-Input".
+	 * @brief Structured unique identifier for the transition, kept in sync with its states, symbols and direction.
 	 */
-	std::string key;
+	TransitionKey key;
 
 	/**
 	 * @brief The key of the state from which the transition starts.
@@ -26,9 +29,9 @@ class AUTOMATASIMULATOR_API TMTransition {
 	std::string toStateKey;
 
 	/**
-	 * @brief The top of the stack symbol,
+	 * @brief Interned id of the symbol read from the tape,
 	 */
-	std::string readSymbol;
+	SymbolId readSymbol;
 
 	/**
 	 * @brief Direction of the transition
@@ -36,14 +39,20 @@ class AUTOMATASIMULATOR_API TMTransition {
 	TMDirection direction;
 
 	/**
-	 * @brief The Symbol to be pushed onto the stack.
+	 * @brief Interned id of the symbol written to the tape.
 	 */
-	std::string writeSymbol;
+	SymbolId writeSymbol;
 
 	/**
-	 * @brief Validates the format of a transition key
+	 * @brief Splits a transition key into its parts, validating its format
+	 * @throws TransitionNotFoundException If the key does not have the expected number of parts.
 	 */
-	static void validateTransitionKeyFormat(const std::string &key);
+	static std::vector<std::string> splitTransitionKey(const std::string &key);
+
+	/**
+	 * @brief Rebuilds the structured key from the states, symbols and direction.
+	 */
+	void updateKey();
 
   public:
 	TMTransition();
@@ -103,6 +112,21 @@ class AUTOMATASIMULATOR_API TMTransition {
 	                                         const std::string &readSymbol, const std::string &writeSymbol,
 	                                         TMDirection direction);
 
+	/**
+	 * @brief Generate a unique transition key from a structured key.
+	 * @param key The structured key.
+	 * @return A unique transition key string.
+	 */
+	static std::string generateTransitionKey(const TransitionKey &key);
+
+	/**
+	 * @brief Parses a transition key string into a structured key, looking up its parts without interning them.
+	 * @param key The transition key.
+	 * @return The structured key, which matches no transition if a part was never interned.
+	 * @throws TransitionNotFoundException if the transition key format is invalid.
+	 */
+	static TransitionKey parseTransitionKey(const std::string &key);
+
 	/**
 	 * @brief Gets the to state key of a transition from its key.
 	 * @param key The transition key.
@@ -144,6 +168,12 @@ class AUTOMATASIMULATOR_API TMTransition {
 	 */
 	std::string getKey() const;
 
+	/**
+	 * @brief Gets the structured unique key for this transition.
+	 * @return The structured key.
+	 */
+	const TransitionKey &getTransitionKey() const;
+
 	/**
 	 * @brief Sets the "from" state of this transition.
 	 * @param key The new "from" state key.
@@ -180,6 +210,12 @@ class AUTOMATASIMULATOR_API TMTransition {
 	 */
 	std::string getReadSymbol() const;
 
+	/**
+	 * @brief Gets the interned id of the read symbol for this transition.
+	 * @return The read symbol id.
+	 */
+	SymbolId getReadSymbolId() const;
+
 	/**
 	 * @brief Sets the symbol to be pushed onto the stack for this transition.
 	 * @param writeSymbol The new push symbol.
@@ -204,6 +240,12 @@ class AUTOMATASIMULATOR_API TMTransition {
 	 */
 	std::string getWriteSymbol() const;
 
+	/**
+	 * @brief Gets the interned id of the write symbol for this transition.
+	 * @return The write symbol id.
+	 */
+	SymbolId getWriteSymbolId() const;
+
 	/**
 	 * @brief Gets a string representation of this transition.
 	 * @return A string representation of the transition.
@@ -215,8 +257,7 @@ namespace std {
 template <> struct hash<TMTransition> {
 	size_t operator()(const TMTransition &t) const {
 		size_t hashValue = hash<std::string>()(t.getFromStateKey()) ^ (hash<std::string>()(t.getToStateKey()) << 1) ^
-		                   (hash<std::string>()(t.getReadSymbol()) << 2) ^
-		                   (hash<std::string>()(t.getWriteSymbol()) << 3) ^
+		                   (hash<SymbolId>()(t.getReadSymbolId()) << 2) ^ (hash<SymbolId>()(t.getWriteSymbolId()) << 3) ^
 		                   (hash<int>()(static_cast<int>(t.getDirection())) << 4);
 		return hashValue;
 	}
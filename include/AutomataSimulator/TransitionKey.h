@@ -0,0 +1,79 @@
+#pragma once
+#include "SymbolTable.h"
+#include "config.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Structured key identifying a transition within its automaton.
+ * Holds the interned ids of the from and to state labels and of up to three symbols: the input of a finite automaton
+ * transition, the input, stack and push symbols of a pushdown automaton transition, or the read symbol, write symbol
+ * and direction of a Turing machine transition. Unused symbols are epsilon. The hash is computed once on construction,
+ * so keys can be rebuilt and looked up without allocating or parsing strings.
+ */
+struct AUTOMATASIMULATOR_API TransitionKey {
+	/**
+	 * @brief Interned id of the from state label.
+	 */
+	SymbolId fromState;
+
+	/**
+	 * @brief Interned id of the to state label.
+	 */
+	SymbolId toState;
+
+	/**
+	 * @brief Ids of the symbols that identify the transition, in the order of its string key.
+	 */
+	std::array<SymbolId, 3> symbols;
+
+	/**
+	 * @brief Hash of all the ids, computed on construction.
+	 */
+	uint64_t hash;
+
+	TransitionKey();
+
+	/**
+	 * @brief Constructs a key from interned ids.
+	 * @param fromState The id of the from state label.
+	 * @param toState The id of the to state label.
+	 * @param first The first symbol of the transition.
+	 * @param second The second symbol of the transition, epsilon if unused.
+	 * @param third The third symbol of the transition, epsilon if unused.
+	 */
+	TransitionKey(const SymbolId &fromState, const SymbolId &toState, const SymbolId &first,
+	              const SymbolId &second = SymbolTable::EPSILON_SYMBOL_ID,
+	              const SymbolId &third = SymbolTable::EPSILON_SYMBOL_ID);
+
+	/**
+	 * @brief Joins the parts of a string transition key with '-' delimiters.
+	 * A '-' or backslash inside a part is escaped with a backslash, so labels and symbols containing the delimiter
+	 * round-trip.
+	 * @param parts The state labels and symbols of the transition, in key order.
+	 * @return The string key.
+	 */
+	static std::string joinParts(const std::vector<std::string> &parts);
+
+	/**
+	 * @brief Splits a string transition key on its unescaped '-' delimiters and unescapes each part.
+	 * @param key The string key.
+	 * @return The parts of the key, in order.
+	 */
+	static std::vector<std::string> splitParts(const std::string &key);
+
+	bool operator==(const TransitionKey &other) const;
+
+	bool operator!=(const TransitionKey &other) const;
+};
+
+namespace std {
+template <> struct hash<TransitionKey> {
+	size_t operator()(const TransitionKey &key) const {
+		return static_cast<size_t>(key.hash);
+	}
+};
+} // namespace std
@@ -1,4 +1,5 @@
 #pragma once
+#include "CacheMutex.h"
 #include "TMState.h"
 #include "TMTape.h"
 #include <stack>
@@ -16,7 +17,7 @@ class AUTOMATASIMULATOR_API TuringMachine {
 	/**
 	 * @brief The input of the automaton.
 	 */
-	std::vector<std::string> input;
+	std::vector<SymbolId> input;
 
 	/**
 	 * @brief The current state of the automaton.
@@ -28,15 +29,21 @@ class AUTOMATASIMULATOR_API TuringMachine {
 	 */
 	std::unordered_map<std::string, TMState> states;
 
+	/**
+	 * @brief Keys of the transitions leading into each state, by the key of the state.
+	 * @brief Each key names its from state, so editing a state only visits its own edges.
+	 */
+	std::unordered_map<std::string, std::unordered_set<TransitionKey>> incomingTransitions;
+
 	/**
 	 * @brief Finite set of input symbols. Formally defined as Sigma.
 	 */
-	std::unordered_set<std::string> inputAlphabet;
+	std::unordered_set<SymbolId> inputAlphabet;
 
 	/**
 	 * @brief Finite set of stack symbols. Formally defined as Gamma.
 	 */
-	std::unordered_set<std::string> tapeAlphabet;
+	std::unordered_set<SymbolId> tapeAlphabet;
 
 	/**
 	 * @brief Start state key. Formally defined as q0.
@@ -58,6 +65,12 @@ class AUTOMATASIMULATOR_API TuringMachine {
 	 */
 	bool statesCacheInvalidated;
 
+	/**
+	 * @brief Guards prepareConcurrentSimulation, so concurrent batches over this automaton never build a cache while
+	 * another reads it. Other automata have their own lock.
+	 */
+	CacheMutex simulationCachesMutex;
+
 	/**
 	 * @brief Cached convertion of the input alphabet from unordered map to vector.
 	 */
@@ -85,6 +98,32 @@ class AUTOMATASIMULATOR_API TuringMachine {
 	 */
 	TMState *getStateInternal(const std::string &key);
 
+	/**
+	 * @brief Records a transition in the incoming index of its to state.
+	 * @param transition The transition to record.
+	 */
+	void indexTransition(const TMTransition &transition);
+
+	/**
+	 * @brief Removes a transition from the incoming index of its to state.
+	 * @param transition The transition to remove.
+	 */
+	void unindexTransition(const TMTransition &transition);
+
+	/**
+	 * @brief Removes a transition from its from state and from the incoming index.
+	 * @param state The from state of the transition.
+	 * @param transition The transition to remove.
+	 */
+	void removeTransitionInternal(TMState &state, const TMTransition &transition);
+
+	/**
+	 * @brief Removes the incoming and outgoing transitions of a state from the incoming index, before the state is
+	 * erased.
+	 * @param key The key of the state.
+	 */
+	void unindexState(const std::string &key);
+
 	/**
 	 * @brief Checks if the transition is valid and throws an exception if it is not.
 	 * @param fromStateKey The key of the state to transition from.
@@ -98,6 +137,20 @@ class AUTOMATASIMULATOR_API TuringMachine {
 	void validateTransition(const std::string &fromStateKey, const std::string &toStateKey,
 	                        const std::string &readSymbol, const std::string &writeSymbol, TMDirection direction);
 
+	/**
+	 * @brief Builds every lazily computed structure that simulation reads, so that simulating afterwards only reads
+	 * the automaton.
+	 * @brief Runs under the automaton's own lock, so a batch never builds a cache while a concurrent batch over the
+	 * same unchanged automaton reads it.
+	 */
+	void prepareConcurrentSimulation();
+
+	/**
+	 * @brief Builds the structures read by simulation, called by prepareConcurrentSimulation under its lock.
+	 * @brief Overrides that build their own structures must call the base version.
+	 */
+	virtual void buildSimulationCaches();
+
   public:
 	TuringMachine();
 
@@ -198,6 +251,19 @@ class AUTOMATASIMULATOR_API TuringMachine {
 	 */
 	std::string readTape() const;
 
+	/**
+	 * @brief Sets how the tape stores its cells, converting the current tape.
+	 * @brief Simulations run on a tape in the same mode, RUN_LENGTH keeps long runs of equal symbols cheap.
+	 * @param mode The storage mode of the tape.
+	 */
+	void setTapeMode(const TMTapeMode &mode);
+
+	/**
+	 * @brief Gets how the tape stores its cells.
+	 * @return The storage mode of the tape.
+	 */
+	TMTapeMode getTapeMode() const;
+
 	/**
 	 * @brief Adds a state to the automaton.
 	 * @param isAccept Whether the state is an accept state or not.
@@ -241,6 +307,12 @@ class AUTOMATASIMULATOR_API TuringMachine {
 	 */
 	std::vector<TMState> getStates();
 
+	/**
+	 * @brief Gets the states of the automaton without copying them.
+	 * @return A reference to the cached states, valid until the automaton is modified.
+	 */
+	const std::vector<TMState> &getStatesView();
+
 	/**
 	 * @brief Removes a state from the automaton.
 	 * @param key The key of the state to remove.
@@ -520,6 +592,8 @@ class AUTOMATASIMULATOR_API TuringMachine {
 
 	/**
 	 * @brief Simulates the automaton on a given input string and depth.
+	 * @brief Builds caches lazily, so concurrent calls on the same automaton are not safe. Use simulateBatchParallel,
+	 * or a frozen snapshot where one exists, to simulate from several threads.
 	 * @param input The input strings to process.
 	 * @param simulationDepth The maximum number of transitions to simulate. Default is 50.
 	 * @return True if the input is accepted, false otherwise.
@@ -528,6 +602,32 @@ class AUTOMATASIMULATOR_API TuringMachine {
 	 */
 	virtual bool simulate(const std::vector<std::string> &input, const int &simulationDepth = 50) = 0;
 
+	/**
+	 * @brief Simulates the automaton on many inputs, checking the definition and preparing shared state once.
+	 * @brief Each result is the same as simulate would return for that input.
+	 * @param inputs The input strings to process.
+	 * @param simulationDepth The maximum number of transitions to simulate per input. Default is 50.
+	 * @return Whether each input is accepted, in order.
+	 * @throws InvalidStartStateException If the start state is not set.
+	 */
+	virtual std::vector<bool> simulateBatch(const std::vector<std::vector<std::string>> &inputs,
+	                                        const int &simulationDepth = 50) = 0;
+
+	/**
+	 * @brief Simulates the automaton on many inputs on a pool of worker threads sharing the automaton.
+	 * @brief The caches read by simulation are built once before the workers start and the workers only read the
+	 * automaton, so concurrent calls on the same automaton are safe as long as it is not modified meanwhile.
+	 * @brief Each result is the same as simulateBatch would return for that input.
+	 * @param inputs The input strings to process.
+	 * @param threadCount The number of worker threads, 0 to use the hardware concurrency. Default is 0.
+	 * @param simulationDepth The maximum number of transitions to simulate per input. Default is 50.
+	 * @return Whether each input is accepted, in order.
+	 * @throws InvalidStartStateException If the start state is not set.
+	 */
+	virtual std::vector<bool> simulateBatchParallel(const std::vector<std::vector<std::string>> &inputs,
+	                                                const std::size_t &threadCount = 0,
+	                                                const int &simulationDepth = 50) = 0;
+
 	/**
 	 * @brief Checks if the provided state is valid as the next state the automaton could transition to.
 	 * @param key The key of the state.
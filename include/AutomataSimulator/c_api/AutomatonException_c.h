@@ -1,4 +1,13 @@
 #include "../AutomatonException.h"
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#ifdef _WIN32
+#define automaton_strdup _strdup
+#else
+#define automaton_strdup strdup
+#endif
 
 typedef enum {
 	AUTOMATON_OK = 0,
@@ -39,7 +48,7 @@ inline void copy_automaton_error(AutomatonError *dest, const AutomatonError *src
 	dest->code = src->code;
 
 	if (src->message) {
-		char *new_msg = _strdup(src->message);
+		char *new_msg = automaton_strdup(src->message);
 		if (!new_msg) {
 			throw std::bad_alloc();
 		}
@@ -54,7 +63,7 @@ inline AutomatonError create_error(AutomatonErrorCode code, const char *message)
 	AutomatonError error{};
 	error.code = code;
 	try {
-		error.message = message ? _strdup(message) : nullptr;
+		error.message = message ? automaton_strdup(message) : nullptr;
 	} catch (...) {
 		error.message = nullptr;
 	}
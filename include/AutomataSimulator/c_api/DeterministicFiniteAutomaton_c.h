@@ -3,6 +3,7 @@
 #include "../config.h"
 #include "FAState_c.h"
 #include "FATransition_c.h"
+#include "FrozenDFA_c.h"
 #include "c_util.h"
 #include <vector>
 
@@ -126,6 +127,23 @@ AUTOMATASIMULATOR_EXPORT bool DFA_processInput(DFAHandle dfa, AutomatonError *er
 AUTOMATASIMULATOR_EXPORT const bool DFA_simulate(DFAHandle dfa, const char **input, const size_t length,
                                                  const int simulationDepth = 50, AutomatonError *error = nullptr);
 
+AUTOMATASIMULATOR_EXPORT void DFA_simulateBatch(DFAHandle dfa, const char ***inputs, const size_t *lengths,
+                                                const size_t count, bool *results, const int simulationDepth = 50,
+                                                AutomatonError *error = nullptr);
+
+AUTOMATASIMULATOR_EXPORT void DFA_simulateBatchParallel(DFAHandle dfa, const char ***inputs, const size_t *lengths,
+                                                        const size_t count, bool *results, const size_t threadCount = 0,
+                                                        const int simulationDepth = 50,
+                                                        AutomatonError *error = nullptr);
+
 AUTOMATASIMULATOR_EXPORT const bool DFA_checkNextState(DFAHandle dfa, const char *key, AutomatonError *error = nullptr);
 
+AUTOMATASIMULATOR_EXPORT void DFA_compile(DFAHandle dfa, AutomatonError *error = nullptr);
+
+AUTOMATASIMULATOR_EXPORT const bool DFA_isCompiled(DFAHandle dfa, AutomatonError *error = nullptr);
+
+AUTOMATASIMULATOR_EXPORT DFAHandle DFA_minimize(DFAHandle dfa, AutomatonError *error = nullptr);
+
+AUTOMATASIMULATOR_EXPORT FrozenDFAHandle DFA_freeze(DFAHandle dfa, AutomatonError *error = nullptr);
+
 AUTOMATASIMULATOR_EXTERN_C_END
\ No newline at end of file
@@ -153,6 +153,15 @@ AUTOMATASIMULATOR_EXPORT bool DPDA_processInput(DPDAHandle dpda, AutomatonError
 AUTOMATASIMULATOR_EXPORT const bool DPDA_simulate(DPDAHandle dpda, const char **input, const size_t length,
                                                   const int simulationDepth = 50, AutomatonError *error = nullptr);
 
+AUTOMATASIMULATOR_EXPORT void DPDA_simulateBatch(DPDAHandle dpda, const char ***inputs, const size_t *lengths,
+                                                 const size_t count, bool *results, const int simulationDepth = 50,
+                                                 AutomatonError *error = nullptr);
+
+AUTOMATASIMULATOR_EXPORT void DPDA_simulateBatchParallel(DPDAHandle dpda, const char ***inputs, const size_t *lengths,
+                                                         const size_t count, bool *results,
+                                                         const size_t threadCount = 0, const int simulationDepth = 50,
+                                                         AutomatonError *error = nullptr);
+
 AUTOMATASIMULATOR_EXPORT StringArray DPDA_getStack(DPDAHandle dpda, AutomatonError *error = nullptr);
 
 AUTOMATASIMULATOR_EXPORT void DPDA_pushStack(DPDAHandle dpda, const char *symbol, AutomatonError *error = nullptr);
@@ -1,6 +1,7 @@
 #pragma once
 #include "../DeterministicTuringMachine.h"
 #include "../config.h"
+#include "FrozenDTM_c.h"
 #include "TMState_c.h"
 #include "TMTransition_c.h"
 #include "c_util.h"
@@ -145,6 +146,19 @@ AUTOMATASIMULATOR_EXPORT bool DTM_processInput(DTMHandle dtm, AutomatonError *er
 AUTOMATASIMULATOR_EXPORT const bool DTM_simulate(DTMHandle dtm, const char **input, const size_t length,
                                                  const int simulationDepth = 50, AutomatonError *error = nullptr);
 
+AUTOMATASIMULATOR_EXPORT const bool DTM_simulateAccelerated(DTMHandle dtm, const char **input, const size_t length,
+                                                            const int simulationDepth, uint64_t *stepCount = nullptr,
+                                                            AutomatonError *error = nullptr);
+
+AUTOMATASIMULATOR_EXPORT void DTM_simulateBatch(DTMHandle dtm, const char ***inputs, const size_t *lengths,
+                                                const size_t count, bool *results, const int simulationDepth = 50,
+                                                AutomatonError *error = nullptr);
+
+AUTOMATASIMULATOR_EXPORT void DTM_simulateBatchParallel(DTMHandle dtm, const char ***inputs, const size_t *lengths,
+                                                        const size_t count, bool *results, const size_t threadCount = 0,
+                                                        const int simulationDepth = 50,
+                                                        AutomatonError *error = nullptr);
+
 AUTOMATASIMULATOR_EXPORT void DTM_setTape(DTMHandle dtm, const char **&tape, const size_t &length,
                                           AutomatonError *error = nullptr);
 
@@ -164,4 +178,6 @@ AUTOMATASIMULATOR_EXPORT const char *DTM_readTape(DTMHandle dtm, AutomatonError
 
 AUTOMATASIMULATOR_EXPORT const bool DTM_checkNextState(DTMHandle dtm, const char *key, AutomatonError *error = nullptr);
 
+AUTOMATASIMULATOR_EXPORT FrozenDTMHandle DTM_freeze(DTMHandle dtm, AutomatonError *error = nullptr);
+
 AUTOMATASIMULATOR_EXTERN_C_END
\ No newline at end of file
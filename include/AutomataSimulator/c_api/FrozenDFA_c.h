@@ -0,0 +1,29 @@
+#pragma once
+#include "../FrozenDFA.h"
+#include "../config.h"
+#include "c_util.h"
+
+AUTOMATASIMULATOR_EXTERN_C_BEGIN
+
+typedef struct FrozenDFA_t *FrozenDFAHandle;
+
+AUTOMATASIMULATOR_EXPORT void FrozenDFA_destroy(FrozenDFAHandle frozen, AutomatonError *error = nullptr);
+
+AUTOMATASIMULATOR_EXPORT const char *FrozenDFA_getStartState(FrozenDFAHandle frozen, AutomatonError *error = nullptr);
+
+AUTOMATASIMULATOR_EXPORT const size_t FrozenDFA_getStateCount(FrozenDFAHandle frozen, AutomatonError *error = nullptr);
+
+AUTOMATASIMULATOR_EXPORT const bool FrozenDFA_simulate(FrozenDFAHandle frozen, const char **input, const size_t length,
+                                                       const int simulationDepth = 50, AutomatonError *error = nullptr);
+
+AUTOMATASIMULATOR_EXPORT void FrozenDFA_simulateBatch(FrozenDFAHandle frozen, const char ***inputs,
+                                                      const size_t *lengths, const size_t count, bool *results,
+                                                      const int simulationDepth = 50, AutomatonError *error = nullptr);
+
+AUTOMATASIMULATOR_EXPORT void FrozenDFA_simulateBatchParallel(FrozenDFAHandle frozen, const char ***inputs,
+                                                              const size_t *lengths, const size_t count, bool *results,
+                                                              const size_t threadCount = 0,
+                                                              const int simulationDepth = 50,
+                                                              AutomatonError *error = nullptr);
+
+AUTOMATASIMULATOR_EXTERN_C_END
@@ -0,0 +1,29 @@
+#pragma once
+#include "../FrozenDTM.h"
+#include "../config.h"
+#include "c_util.h"
+
+AUTOMATASIMULATOR_EXTERN_C_BEGIN
+
+typedef struct FrozenDTM_t *FrozenDTMHandle;
+
+AUTOMATASIMULATOR_EXPORT void FrozenDTM_destroy(FrozenDTMHandle frozen, AutomatonError *error = nullptr);
+
+AUTOMATASIMULATOR_EXPORT const char *FrozenDTM_getStartState(FrozenDTMHandle frozen, AutomatonError *error = nullptr);
+
+AUTOMATASIMULATOR_EXPORT const size_t FrozenDTM_getStateCount(FrozenDTMHandle frozen, AutomatonError *error = nullptr);
+
+AUTOMATASIMULATOR_EXPORT const bool FrozenDTM_simulate(FrozenDTMHandle frozen, const char **input, const size_t length,
+                                                       const int simulationDepth = 50, AutomatonError *error = nullptr);
+
+AUTOMATASIMULATOR_EXPORT void FrozenDTM_simulateBatch(FrozenDTMHandle frozen, const char ***inputs,
+                                                      const size_t *lengths, const size_t count, bool *results,
+                                                      const int simulationDepth = 50, AutomatonError *error = nullptr);
+
+AUTOMATASIMULATOR_EXPORT void FrozenDTM_simulateBatchParallel(FrozenDTMHandle frozen, const char ***inputs,
+                                                              const size_t *lengths, const size_t count, bool *results,
+                                                              const size_t threadCount = 0,
+                                                              const int simulationDepth = 50,
+                                                              AutomatonError *error = nullptr);
+
+AUTOMATASIMULATOR_EXTERN_C_END
@@ -0,0 +1,34 @@
+#pragma once
+#include "../FrozenNPDA.h"
+#include "../config.h"
+#include "c_util.h"
+
+AUTOMATASIMULATOR_EXTERN_C_BEGIN
+
+typedef struct FrozenNPDA_t *FrozenNPDAHandle;
+
+AUTOMATASIMULATOR_EXPORT void FrozenNPDA_destroy(FrozenNPDAHandle frozen, AutomatonError *error = nullptr);
+
+AUTOMATASIMULATOR_EXPORT const char *FrozenNPDA_getStartState(FrozenNPDAHandle frozen, AutomatonError *error = nullptr);
+
+AUTOMATASIMULATOR_EXPORT const size_t FrozenNPDA_getStateCount(FrozenNPDAHandle frozen,
+                                                               AutomatonError *error = nullptr);
+
+AUTOMATASIMULATOR_EXPORT const bool FrozenNPDA_simulate(FrozenNPDAHandle frozen, const char **input,
+                                                        const size_t length, const int simulationDepth = 50,
+                                                        AutomatonError *error = nullptr);
+
+AUTOMATASIMULATOR_EXPORT void FrozenNPDA_simulateBatch(FrozenNPDAHandle frozen, const char ***inputs,
+                                                       const size_t *lengths, const size_t count, bool *results,
+                                                       const int simulationDepth = 50, AutomatonError *error = nullptr);
+
+AUTOMATASIMULATOR_EXPORT void FrozenNPDA_simulateBatchParallel(FrozenNPDAHandle frozen, const char ***inputs,
+                                                               const size_t *lengths, const size_t count, bool *results,
+                                                               const size_t threadCount = 0,
+                                                               const int simulationDepth = 50,
+                                                               AutomatonError *error = nullptr);
+
+AUTOMATASIMULATOR_EXPORT const bool FrozenNPDA_simulateGSS(FrozenNPDAHandle frozen, const char **input,
+                                                           const size_t length, AutomatonError *error = nullptr);
+
+AUTOMATASIMULATOR_EXTERN_C_END
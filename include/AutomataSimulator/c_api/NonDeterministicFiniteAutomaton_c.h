@@ -1,6 +1,7 @@
 #pragma once
 #include "../NonDeterministicFiniteAutomaton.h"
 #include "../config.h"
+#include "DeterministicFiniteAutomaton_c.h"
 #include "FAState_c.h"
 #include "FATransition_c.h"
 #include "c_util.h"
@@ -125,9 +126,32 @@ AUTOMATASIMULATOR_EXPORT const bool NFA_processInput(NFAHandle nfa, AutomatonErr
 AUTOMATASIMULATOR_EXPORT const bool NFA_simulate(NFAHandle nfa, const char **input, const size_t length,
                                                  const int simulationDepth = 50, AutomatonError *error = nullptr);
 
+AUTOMATASIMULATOR_EXPORT void NFA_simulateBatch(NFAHandle nfa, const char ***inputs, const size_t *lengths,
+                                                const size_t count, bool *results, const int simulationDepth = 50,
+                                                AutomatonError *error = nullptr);
+
+AUTOMATASIMULATOR_EXPORT void NFA_simulateBatchParallel(NFAHandle nfa, const char ***inputs, const size_t *lengths,
+                                                        const size_t count, bool *results, const size_t threadCount = 0,
+                                                        const int simulationDepth = 50,
+                                                        AutomatonError *error = nullptr);
+
 AUTOMATASIMULATOR_EXPORT const FAStateArray NFA_getPossibleCurrentStates(NFAHandle nfa,
                                                                          AutomatonError *error = nullptr);
 
 AUTOMATASIMULATOR_EXPORT const bool NFA_checkNextState(NFAHandle nfa, const char *key, AutomatonError *error = nullptr);
 
+AUTOMATASIMULATOR_EXPORT void NFA_compile(NFAHandle nfa, AutomatonError *error = nullptr);
+
+AUTOMATASIMULATOR_EXPORT const bool NFA_isCompiled(NFAHandle nfa, AutomatonError *error = nullptr);
+
+AUTOMATASIMULATOR_EXPORT void NFA_enableLazyDFA(NFAHandle nfa, const size_t memoryBudget = 1 << 20,
+                                                AutomatonError *error = nullptr);
+
+AUTOMATASIMULATOR_EXPORT void NFA_disableLazyDFA(NFAHandle nfa, AutomatonError *error = nullptr);
+
+AUTOMATASIMULATOR_EXPORT const bool NFA_isLazyDFAEnabled(NFAHandle nfa, AutomatonError *error = nullptr);
+
+AUTOMATASIMULATOR_EXPORT DFAHandle NFA_toDFA(NFAHandle nfa, const size_t maxStates = 10000,
+                                             AutomatonError *error = nullptr);
+
 AUTOMATASIMULATOR_EXTERN_C_END
\ No newline at end of file
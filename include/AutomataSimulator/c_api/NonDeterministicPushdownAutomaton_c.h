@@ -1,6 +1,7 @@
 #pragma once
 #include "../NonDeterministicPushdownAutomaton.h"
 #include "../config.h"
+#include "FrozenNPDA_c.h"
 #include "PDAState_c.h"
 #include "PDATransition_c.h"
 #include "c_util.h"
@@ -153,6 +154,15 @@ AUTOMATASIMULATOR_EXPORT bool NPDA_processInput(NPDAHandle npda, AutomatonError
 AUTOMATASIMULATOR_EXPORT const bool NPDA_simulate(NPDAHandle npda, const char **input, const size_t length,
                                                   const int simulationDepth = 50, AutomatonError *error = nullptr);
 
+AUTOMATASIMULATOR_EXPORT void NPDA_simulateBatch(NPDAHandle npda, const char ***inputs, const size_t *lengths,
+                                                 const size_t count, bool *results, const int simulationDepth = 50,
+                                                 AutomatonError *error = nullptr);
+
+AUTOMATASIMULATOR_EXPORT void NPDA_simulateBatchParallel(NPDAHandle npda, const char ***inputs, const size_t *lengths,
+                                                         const size_t count, bool *results,
+                                                         const size_t threadCount = 0, const int simulationDepth = 50,
+                                                         AutomatonError *error = nullptr);
+
 AUTOMATASIMULATOR_EXPORT const PDAStateArray NPDA_getPossibleCurrentStates(NPDAHandle npda,
                                                                            AutomatonError *error = nullptr);
 
@@ -169,4 +179,9 @@ AUTOMATASIMULATOR_EXPORT void NPDA_resetStack(NPDAHandle dpda, AutomatonError *e
 AUTOMATASIMULATOR_EXPORT const bool NPDA_checkNextState(NPDAHandle dpda, const char *key,
                                                         AutomatonError *error = nullptr);
 
+AUTOMATASIMULATOR_EXPORT FrozenNPDAHandle NPDA_freeze(NPDAHandle npda, AutomatonError *error = nullptr);
+
+AUTOMATASIMULATOR_EXPORT const bool NPDA_simulateGSS(NPDAHandle npda, const char **input, const size_t length,
+                                                     AutomatonError *error = nullptr);
+
 AUTOMATASIMULATOR_EXTERN_C_END
\ No newline at end of file
@@ -145,6 +145,15 @@ AUTOMATASIMULATOR_EXPORT bool NTM_processInput(NTMHandle ntm, AutomatonError *er
 AUTOMATASIMULATOR_EXPORT const bool NTM_simulate(NTMHandle ntm, const char **input, const size_t length,
                                                  const int simulationDepth = 50, AutomatonError *error = nullptr);
 
+AUTOMATASIMULATOR_EXPORT void NTM_simulateBatch(NTMHandle ntm, const char ***inputs, const size_t *lengths,
+                                                const size_t count, bool *results, const int simulationDepth = 50,
+                                                AutomatonError *error = nullptr);
+
+AUTOMATASIMULATOR_EXPORT void NTM_simulateBatchParallel(NTMHandle ntm, const char ***inputs, const size_t *lengths,
+                                                        const size_t count, bool *results, const size_t threadCount = 0,
+                                                        const int simulationDepth = 50,
+                                                        AutomatonError *error = nullptr);
+
 AUTOMATASIMULATOR_EXPORT const TMStateArray NTM_getPossibleCurrentStates(NTMHandle ntm,
                                                                          AutomatonError *error = nullptr);
 
@@ -4,7 +4,9 @@
 #include "AutomatonException_c.h"
 #include <exception>
 #include <functional>
+#include <cstring>
 #include <string>
+#include <vector>
 
 typedef struct {
 	char **data;
@@ -59,7 +61,7 @@ inline const StringArray convertToStringArray(const std::vector<std::string> &ve
 
 	for (size_t i = 0; i < result.length; ++i) {
 		result.data[i] = new char[vec[i].size() + 1];
-		strcpy_s(result.data[i], vec[i].size() + 1, vec[i].c_str());
+		std::memcpy(result.data[i], vec[i].c_str(), vec[i].size() + 1);
 	}
 
 	return result;
@@ -0,0 +1,173 @@
+#include "AutomataSimulator/BatchExecutor.h"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace {
+// Chunks a worker takes from its own share per lock, relative to the size of an even share
+constexpr std::size_t CHUNKS_PER_SHARE = 32;
+
+struct WorkerShare {
+	std::mutex mutex;
+	std::size_t begin = 0;
+	std::size_t end = 0;
+};
+
+struct BatchState {
+	std::unique_ptr<WorkerShare[]> shares;
+	std::size_t workerCount;
+	std::size_t grain;
+	std::atomic<bool> failed{false};
+	std::mutex errorMutex;
+	std::exception_ptr error;
+};
+
+bool takeOwnChunk(WorkerShare &share, const std::size_t &grain, std::size_t &begin, std::size_t &end) {
+	std::lock_guard<std::mutex> lock(share.mutex);
+	if (share.begin >= share.end) {
+		return false;
+	}
+	begin = share.begin;
+	end = std::min(share.end, share.begin + grain);
+	share.begin = end;
+	return true;
+}
+
+bool stealShare(BatchState &state, const std::size_t &worker) {
+	while (true) {
+		std::size_t victim = worker;
+		std::size_t largest = 0;
+		for (std::size_t i = 0; i < state.workerCount; i++) {
+			if (i == worker) {
+				continue;
+			}
+			std::lock_guard<std::mutex> lock(state.shares[i].mutex);
+			std::size_t remaining = state.shares[i].end - state.shares[i].begin;
+			if (remaining > largest) {
+				largest = remaining;
+				victim = i;
+			}
+		}
+		if (victim == worker) {
+			return false;
+		}
+
+		std::size_t stolenBegin;
+		std::size_t stolenEnd;
+		{
+			std::lock_guard<std::mutex> lock(state.shares[victim].mutex);
+			WorkerShare &share = state.shares[victim];
+			if (share.begin >= share.end) {
+				// The victim finished its share between the scan and the steal, look again
+				continue;
+			}
+			// The owner keeps the front half, the thief takes the back half (at least one index)
+			std::size_t remaining = share.end - share.begin;
+			stolenBegin = share.end - (remaining + 1) / 2;
+			stolenEnd = share.end;
+			share.end = stolenBegin;
+		}
+
+		std::lock_guard<std::mutex> lock(state.shares[worker].mutex);
+		state.shares[worker].begin = stolenBegin;
+		state.shares[worker].end = stolenEnd;
+		return true;
+	}
+}
+
+void runWorker(BatchState &state, const std::size_t &worker,
+               const std::function<void(const std::size_t &, const std::size_t &)> &task) {
+	try {
+		std::size_t begin;
+		std::size_t end;
+		while (!state.failed.load(std::memory_order_relaxed)) {
+			if (!takeOwnChunk(state.shares[worker], state.grain, begin, end)) {
+				if (!stealShare(state, worker)) {
+					return;
+				}
+				continue;
+			}
+			for (std::size_t i = begin; i < end; i++) {
+				task(i, worker);
+			}
+		}
+	} catch (...) {
+		std::lock_guard<std::mutex> lock(state.errorMutex);
+		if (!state.error) {
+			state.error = std::current_exception();
+		}
+		state.failed.store(true, std::memory_order_relaxed);
+	}
+}
+} // namespace
+
+std::size_t BatchExecutor::resolveThreadCount(const std::size_t &threadCount, const std::size_t &taskCount) {
+	std::size_t workers = threadCount;
+	if (workers == 0) {
+		workers = std::thread::hardware_concurrency();
+	}
+	return std::max<std::size_t>(1, std::min(workers, taskCount));
+}
+
+void BatchExecutor::run(const std::size_t &taskCount, const std::size_t &threadCount,
+                        const std::function<void(const std::size_t &, const std::size_t &)> &task) {
+	if (taskCount == 0) {
+		return;
+	}
+
+	const std::size_t workerCount = resolveThreadCount(threadCount, taskCount);
+	if (workerCount == 1) {
+		for (std::size_t i = 0; i < taskCount; i++) {
+			task(i, 0);
+		}
+		return;
+	}
+
+	BatchState state;
+	state.workerCount = workerCount;
+	state.shares.reset(new WorkerShare[workerCount]);
+	state.grain = std::max<std::size_t>(1, taskCount / (workerCount * CHUNKS_PER_SHARE));
+
+	// Even shares, the first taskCount % workerCount workers take one extra index
+	std::size_t next = 0;
+	for (std::size_t i = 0; i < workerCount; i++) {
+		std::size_t size = taskCount / workerCount + (i < taskCount % workerCount ? 1 : 0);
+		state.shares[i].begin = next;
+		state.shares[i].end = next + size;
+		next += size;
+	}
+
+	std::vector<std::thread> threads;
+	threads.reserve(workerCount - 1);
+	for (std::size_t i = 1; i < workerCount; i++) {
+		try {
+			threads.emplace_back([&state, &task, i]() { runWorker(state, i, task); });
+		} catch (const std::system_error &) {
+			// Shares of workers that never started are stolen by the running ones
+			break;
+		}
+	}
+	runWorker(state, 0, task);
+	for (auto &thread : threads) {
+		thread.join();
+	}
+
+	if (state.error) {
+		std::rethrow_exception(state.error);
+	}
+}
+
+std::vector<bool> BatchExecutor::runPredicate(
+    const std::size_t &taskCount, const std::size_t &threadCount,
+    const std::function<bool(const std::size_t &, const std::size_t &)> &predicate) {
+	// Workers write results by index, which std::vector<bool> does not allow across threads as its elements share bytes
+	std::vector<char> results(taskCount);
+	run(taskCount, threadCount,
+	    [&](const std::size_t &i, const std::size_t &worker) { results[i] = predicate(i, worker); });
+	return std::vector<bool>(results.begin(), results.end());
+}
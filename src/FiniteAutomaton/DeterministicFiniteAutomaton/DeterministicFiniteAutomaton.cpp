@@ -1,4 +1,86 @@
 #include "AutomataSimulator/DeterministicFiniteAutomaton.h"
+#include "AutomataSimulator/BatchExecutor.h"
+#include <algorithm>
+
+// Marks a missing transition in the compiled table
+static const uint32_t COMPILED_DEAD_STATE = UINT32_MAX;
+static_assert(COMPILED_DEAD_STATE == FrozenDFA::DEAD_STATE, "compiled and frozen tables share buildTransitionTable");
+
+namespace {
+/**
+ * @brief Partition of the integers [0, size) into blocks that can be split by marking elements.
+ * @brief Elements of a block are contiguous in the elements array, with the marked ones at the front.
+ */
+struct RefinablePartition {
+	std::vector<std::size_t> elements;
+	std::vector<std::size_t> location;
+	std::vector<std::size_t> blockOf;
+	std::vector<std::size_t> first;
+	std::vector<std::size_t> past;
+	std::vector<std::size_t> marked;
+	std::vector<std::size_t> touched;
+
+	RefinablePartition(const std::size_t &size)
+	    : elements(size), location(size), blockOf(size, 0), first(1, 0), past(1, size), marked(1, 0) {
+		for (std::size_t i = 0; i < size; i++) {
+			elements[i] = location[i] = i;
+		}
+	}
+
+	std::size_t blockCount() const {
+		return first.size();
+	}
+
+	void mark(const std::size_t &element) {
+		std::size_t block = blockOf[element];
+		std::size_t target = first[block] + marked[block];
+		std::size_t moved = elements[target];
+
+		std::swap(elements[location[element]], elements[target]);
+		location[moved] = location[element];
+		location[element] = target;
+
+		if (marked[block]++ == 0) {
+			touched.push_back(block);
+		}
+	}
+
+	/**
+	 * @brief Splits every touched block into its marked and unmarked elements.
+	 * @param onSplit Called with the original and the new block of each split.
+	 */
+	template <typename Callback> void split(Callback onSplit) {
+		for (const auto &block : touched) {
+			std::size_t boundary = first[block] + marked[block];
+			marked[block] = 0;
+			if (boundary == past[block]) {
+				continue;
+			}
+
+			// The smaller half moves to the new block
+			std::size_t newBlock = first.size();
+			if (boundary - first[block] <= past[block] - boundary) {
+				first.push_back(first[block]);
+				past.push_back(boundary);
+				first[block] = boundary;
+			} else {
+				first.push_back(boundary);
+				past.push_back(past[block]);
+				past[block] = boundary;
+			}
+			marked.push_back(0);
+			for (std::size_t i = first[newBlock]; i < past[newBlock]; i++) {
+				blockOf[elements[i]] = newBlock;
+			}
+			onSplit(block, newBlock);
+		}
+		touched.clear();
+	}
+};
+} // namespace
+
+DeterministicFiniteAutomaton::DeterministicFiniteAutomaton()
+    : compiledColumnCount(0), compiledStartState(0), compiledVersion(0) {}
 
 DeterministicFiniteAutomaton::~DeterministicFiniteAutomaton() = default;
 
@@ -15,12 +97,7 @@ bool DeterministicFiniteAutomaton::checkTransitionDeterminisim(const std::string
 	FAState *fromState = getStateInternal(fromStateKey);
 
 	// in a DFA, we can't have multiple transitions with the same input symbol
-	for (auto &transition : fromState->getTransitions()) {
-		if (transition.getInput() == input) {
-			return false;
-		}
-	}
-	return true;
+	return !fromState->hasTransitionOnInput(SymbolTable::find(input));
 }
 
 void DeterministicFiniteAutomaton::setInput(const std::vector<std::string> &input) {
@@ -132,7 +209,7 @@ void DeterministicFiniteAutomaton::updateTransitionFromState(const std::string &
 }
 
 const bool DeterministicFiniteAutomaton::processInput() {
-	if (currentState.empty()) {
+	if (currentState == INVALID_STATE_ID) {
 		throw InvalidAutomatonDefinitionException("Current state or start state must be set to run process input");
 	}
 
@@ -140,50 +217,355 @@ const bool DeterministicFiniteAutomaton::processInput() {
 		return getStateInternal(currentState)->getIsAccept();
 	}
 
-	const std::string &inputSymbol = this->input[inputHead];
+	const SymbolId &inputSymbol = this->input[inputHead];
 
-	const std::vector<FATransition> &transitions = getStateInternal(currentState)->getTransitions();
+	const std::vector<FATransition> &transitions = getStateInternal(currentState)->getTransitionsOnInput(inputSymbol);
+	if (transitions.empty()) {
+		return false;
+	}
 
-	for (const auto &transition : transitions) {
-		if (transition.getInput() != inputSymbol) {
-			continue;
+	currentState = transitions.front().getToStateId();
+	inputHead++;
+	return getStateInternal(currentState)->getIsAccept();
+}
+
+const bool DeterministicFiniteAutomaton::simulate(const std::vector<std::string> &input, const int &simulationDepth) {
+	if (startState == INVALID_STATE_ID) {
+		throw InvalidStartStateException("Start state must be set to run simulate");
+	}
+
+	const std::vector<SymbolId> inputIds = SymbolTable::find(input);
+	if (isCompiled()) {
+		return simulateCompiled(inputIds, simulationDepth);
+	}
+
+	return simulateInterpreted(inputIds, simulationDepth);
+}
+
+const std::vector<bool>
+DeterministicFiniteAutomaton::simulateBatch(const std::vector<std::vector<std::string>> &inputs,
+                                            const int &simulationDepth) {
+	if (startState == INVALID_STATE_ID) {
+		throw InvalidStartStateException("Start state must be set to run simulate");
+	}
+
+	std::vector<bool> results(inputs.size());
+	std::vector<std::vector<SymbolId>> inputIds = SymbolTable::find(inputs);
+	if (isCompiled()) {
+		for (std::size_t i = 0; i < inputs.size(); i++) {
+			results[i] = simulateCompiled(inputIds[i], simulationDepth);
 		}
-		currentState = transition.getToStateKey();
-		inputHead++;
-		return getStateInternal(currentState)->getIsAccept();
+		return results;
 	}
-	return false;
+
+	for (std::size_t i = 0; i < inputs.size(); i++) {
+		results[i] = simulateInterpreted(inputIds[i], simulationDepth);
+	}
+	return results;
 }
 
-const bool DeterministicFiniteAutomaton::simulate(const std::vector<std::string> &input, const int &simulationDepth) {
-	if (startState.empty()) {
+const std::vector<bool>
+DeterministicFiniteAutomaton::simulateBatchParallel(const std::vector<std::vector<std::string>> &inputs,
+                                                    const std::size_t &threadCount, const int &simulationDepth) {
+	if (startState == INVALID_STATE_ID) {
 		throw InvalidStartStateException("Start state must be set to run simulate");
 	}
 
+	prepareConcurrentSimulation();
+
+	std::vector<std::vector<SymbolId>> inputIds = SymbolTable::find(inputs);
+	if (isCompiled()) {
+		return BatchExecutor::runPredicate(inputs.size(), threadCount, [&](const std::size_t &i, const std::size_t &) {
+			return simulateCompiled(inputIds[i], simulationDepth);
+		});
+	}
+
+	return BatchExecutor::runPredicate(inputs.size(), threadCount, [&](const std::size_t &i, const std::size_t &) {
+		return simulateInterpreted(inputIds[i], simulationDepth);
+	});
+}
+
+const bool DeterministicFiniteAutomaton::simulateInterpreted(const std::vector<SymbolId> &inputIds,
+                                                             const int &simulationDepth) {
 	int inputIdx = 0;
 	int currentDepth = 0;
-	std::string simulationCurrentState = getStartState();
+	StateId simulationCurrentState = startState;
 
-	while (currentDepth <= simulationDepth && inputIdx < input.size()) {
-		const std::vector<FATransition> &transitions = getStateInternal(simulationCurrentState)->getTransitions();
+	while (currentDepth <= simulationDepth && inputIdx < inputIds.size()) {
+		const std::vector<FATransition> &transitions =
+		    getStateInternal(simulationCurrentState)->getTransitionsOnInput(inputIds[inputIdx]);
+		if (transitions.empty()) {
+			return false;
+		}
+		simulationCurrentState = transitions.front().getToStateId();
+		currentDepth++;
+		inputIdx++;
+	}
 
-		std::string currentInput = input[inputIdx];
+	return getStateInternal(simulationCurrentState)->getIsAccept();
+}
+
+void DeterministicFiniteAutomaton::compile() {
+	if (startState == INVALID_STATE_ID) {
+		throw InvalidStartStateException("Start state must be set to compile");
+	}
+
+	// Assign dense columns to the alphabet symbols, and index them by symbol id for simulation
+	std::unordered_map<SymbolId, uint32_t> symbolColumns;
+	SymbolId largestSymbol = 0;
+	for (const auto &symbol : inputAlphabet) {
+		symbolColumns[symbol] = static_cast<uint32_t>(symbolColumns.size());
+		largestSymbol = std::max(largestSymbol, symbol);
+	}
+	compiledSymbolColumns.assign(inputAlphabet.empty() ? 0 : largestSymbol + 1, COMPILED_DEAD_STATE);
+	for (const auto &pair : symbolColumns) {
+		compiledSymbolColumns[pair.first] = pair.second;
+	}
+	compiledColumnCount = symbolColumns.size();
+
+	// Rows are the state ids themselves, free state slots have no transitions and are not accepting so theirs stay dead
+	std::vector<uint32_t> stateRows(states.size());
+	compiledAcceptStates.assign(states.size(), false);
+	for (StateId id = 0; id < states.size(); id++) {
+		stateRows[id] = static_cast<uint32_t>(id);
+		compiledAcceptStates[id] = states[id].getIsAccept();
+	}
+	compiledTransitions = buildTransitionTable(stateRows, states.size(), symbolColumns);
 
-		bool transitionFound = false;
-		for (const auto &transition : transitions) {
-			if (transition.getInput() != currentInput) {
+	compiledStartState = startState;
+	compiledVersion = definitionVersion;
+}
+
+std::vector<uint32_t>
+DeterministicFiniteAutomaton::buildTransitionTable(const std::vector<uint32_t> &stateRows, const std::size_t &rowCount,
+                                                   const std::unordered_map<SymbolId, uint32_t> &symbolColumns) {
+	const std::size_t columns = symbolColumns.size();
+	std::vector<uint32_t> table(rowCount * columns, COMPILED_DEAD_STATE);
+	for (StateId id = 0; id < states.size(); id++) {
+		if (stateRows[id] == COMPILED_DEAD_STATE) {
+			continue;
+		}
+		for (const auto &transition : states[id].getTransitionsView()) {
+			auto columnIt = symbolColumns.find(transition.getInputId());
+			if (columnIt == symbolColumns.end()) {
 				continue;
 			}
-			simulationCurrentState = transition.getToStateKey();
-			transitionFound = true;
-			break;
+			table[stateRows[id] * columns + columnIt->second] = stateRows[transition.getToStateId()];
 		}
-		if (!transitionFound) {
+	}
+	return table;
+}
+
+const bool DeterministicFiniteAutomaton::isCompiled() const {
+	return !compiledAcceptStates.empty() && compiledVersion == definitionVersion;
+}
+
+const bool DeterministicFiniteAutomaton::simulateCompiled(const std::vector<SymbolId> &inputIds,
+                                                          const int &simulationDepth) const {
+	// Same step budget as the interpreted path: at most simulationDepth + 1 symbols are consumed
+	std::size_t steps =
+	    simulationDepth < 0 ? 0 : std::min(inputIds.size(), static_cast<std::size_t>(simulationDepth) + 1);
+
+	uint32_t simulationCurrentState = compiledStartState;
+	for (std::size_t i = 0; i < steps; i++) {
+		// Symbols outside the alphabet, unknown ones included, have no column
+		const SymbolId symbol = inputIds[i];
+		if (symbol >= compiledSymbolColumns.size() || compiledSymbolColumns[symbol] == COMPILED_DEAD_STATE) {
+			return false;
+		}
+		simulationCurrentState =
+		    compiledTransitions[simulationCurrentState * compiledColumnCount + compiledSymbolColumns[symbol]];
+		if (simulationCurrentState == COMPILED_DEAD_STATE) {
 			return false;
 		}
-		currentDepth++;
-		inputIdx++;
 	}
 
-	return getStateInternal(simulationCurrentState)->getIsAccept();
-}
\ No newline at end of file
+	return compiledAcceptStates[simulationCurrentState];
+}
+
+DeterministicFiniteAutomaton DeterministicFiniteAutomaton::minimize() {
+	if (startState == INVALID_STATE_ID) {
+		throw InvalidStartStateException("Start state must be set to minimize");
+	}
+
+	std::vector<SymbolId> symbols(inputAlphabet.begin(), inputAlphabet.end());
+	std::sort(symbols.begin(), symbols.end());
+	std::unordered_map<SymbolId, std::size_t> symbolColumns;
+	for (std::size_t column = 0; column < symbols.size(); column++) {
+		symbolColumns[symbols[column]] = column;
+	}
+	const std::size_t alphabetSize = symbols.size();
+
+	// Number the states reachable from the start state, in state id order
+	std::vector<bool> reachable(states.size(), false);
+	std::vector<StateId> pending = {startState};
+	reachable[startState] = true;
+	while (!pending.empty()) {
+		StateId state = pending.back();
+		pending.pop_back();
+		for (const auto &transition : states[state].getTransitionsView()) {
+			if (!reachable[transition.getToStateId()]) {
+				reachable[transition.getToStateId()] = true;
+				pending.push_back(transition.getToStateId());
+			}
+		}
+	}
+
+	std::vector<StateId> originalIds;
+	std::vector<std::size_t> numbering(states.size(), SIZE_MAX);
+	for (StateId id = 0; id < states.size(); id++) {
+		if (reachable[id]) {
+			numbering[id] = originalIds.size();
+			originalIds.push_back(id);
+		}
+	}
+
+	// Complete the automaton with a dead state that missing transitions lead to
+	const std::size_t deadState = originalIds.size();
+	const std::size_t stateCount = deadState + 1;
+	std::vector<std::size_t> delta(stateCount * alphabetSize, deadState);
+	for (std::size_t state = 0; state < deadState; state++) {
+		for (const auto &transition : states[originalIds[state]].getTransitionsView()) {
+			auto columnIt = symbolColumns.find(transition.getInputId());
+			if (columnIt != symbolColumns.end()) {
+				delta[state * alphabetSize + columnIt->second] = numbering[transition.getToStateId()];
+			}
+		}
+	}
+
+	// Predecessors of each state per symbol, stored contiguously per (symbol, state)
+	std::vector<std::size_t> predecessorOffsets(alphabetSize * (stateCount + 1) + 1, 0);
+	std::vector<std::size_t> predecessors(stateCount * alphabetSize);
+	for (std::size_t state = 0; state < stateCount; state++) {
+		for (std::size_t column = 0; column < alphabetSize; column++) {
+			predecessorOffsets[column * (stateCount + 1) + delta[state * alphabetSize + column] + 1]++;
+		}
+	}
+	for (std::size_t i = 1; i < predecessorOffsets.size(); i++) {
+		predecessorOffsets[i] += predecessorOffsets[i - 1];
+	}
+	std::vector<std::size_t> fill(predecessorOffsets.begin(), predecessorOffsets.end() - 1);
+	for (std::size_t state = 0; state < stateCount; state++) {
+		for (std::size_t column = 0; column < alphabetSize; column++) {
+			predecessors[fill[column * (stateCount + 1) + delta[state * alphabetSize + column]]++] = state;
+		}
+	}
+
+	// Start from the accepting / non-accepting split and refine on every splitter block
+	RefinablePartition partition(stateCount);
+	for (std::size_t state = 0; state < deadState; state++) {
+		if (states[originalIds[state]].getIsAccept()) {
+			partition.mark(state);
+		}
+	}
+	std::vector<std::size_t> worklist;
+	std::vector<bool> inWorklist(1, true);
+	worklist.push_back(0);
+	partition.split([&](const std::size_t &, const std::size_t &newBlock) {
+		inWorklist.push_back(true);
+		worklist.push_back(newBlock);
+	});
+
+	auto onSplit = [&](const std::size_t &block, const std::size_t &newBlock) {
+		// If the original block is still pending both halves must be, otherwise the smaller half is enough
+		inWorklist.push_back(false);
+		std::size_t smaller = newBlock;
+		if (!inWorklist[block] &&
+		    partition.past[block] - partition.first[block] < partition.past[newBlock] - partition.first[newBlock]) {
+			smaller = block;
+		}
+		inWorklist[smaller] = true;
+		worklist.push_back(smaller);
+	};
+
+	std::vector<std::size_t> splitter;
+	while (!worklist.empty()) {
+		std::size_t block = worklist.back();
+		worklist.pop_back();
+		inWorklist[block] = false;
+
+		splitter.assign(partition.elements.begin() + partition.first[block],
+		                partition.elements.begin() + partition.past[block]);
+		for (std::size_t column = 0; column < alphabetSize; column++) {
+			std::size_t offset = column * (stateCount + 1);
+			for (const auto &state : splitter) {
+				for (std::size_t i = predecessorOffsets[offset + state]; i < predecessorOffsets[offset + state + 1];
+				     i++) {
+					partition.mark(predecessors[i]);
+				}
+			}
+			partition.split(onSplit);
+		}
+	}
+
+	// Emit one state per block, leaving out the block of states equivalent to the dead state
+	const std::size_t deadBlock = partition.blockOf[deadState];
+	const std::size_t start = numbering[startState];
+	std::vector<std::string> blockLabels(partition.blockCount());
+	DeterministicFiniteAutomaton minimal;
+	minimal.setInputAlphabet(SymbolTable::getSymbols(symbols));
+
+	for (std::size_t state = 0; state < deadState; state++) {
+		std::size_t block = partition.blockOf[state];
+		if (block == deadBlock && state != start) {
+			continue;
+		}
+		if (blockLabels[block].empty()) {
+			blockLabels[block] = states[originalIds[state]].getLabel();
+			minimal.addState(blockLabels[block], states[originalIds[state]].getIsAccept());
+		}
+	}
+	minimal.setStartState(blockLabels[partition.blockOf[start]]);
+
+	for (std::size_t block = 0; block < partition.blockCount(); block++) {
+		if (block == deadBlock) {
+			continue;
+		}
+		std::size_t state = partition.elements[partition.first[block]];
+		for (std::size_t column = 0; column < alphabetSize; column++) {
+			std::size_t target = partition.blockOf[delta[state * alphabetSize + column]];
+			if (target == deadBlock) {
+				continue;
+			}
+			minimal.addTransition(blockLabels[block], blockLabels[target], SymbolTable::getSymbol(symbols[column]));
+		}
+	}
+
+	return minimal;
+}
+
+FrozenDFA DeterministicFiniteAutomaton::freeze() {
+	if (startState == INVALID_STATE_ID) {
+		throw InvalidStartStateException("Start state must be set to freeze");
+	}
+
+	FrozenDFA frozen;
+
+	// Number the live states densely, skipping free slots
+	std::vector<uint32_t> stateIndices(states.size(), FrozenDFA::DEAD_STATE);
+	for (StateId id = 0; id < states.size(); id++) {
+		if (!stateIdInUse(id)) {
+			continue;
+		}
+		stateIndices[id] = static_cast<uint32_t>(frozen.stateLabels.size());
+		frozen.stateLabels.push_back(states[id].getLabel());
+		frozen.acceptStates.push_back(states[id].getIsAccept());
+	}
+
+	for (const auto &symbol : inputAlphabet) {
+		frozen.symbolColumns.emplace(symbol, static_cast<uint32_t>(frozen.symbolColumns.size()));
+	}
+	for (StateId id = 0; id < states.size(); id++) {
+		if (!stateIdInUse(id)) {
+			continue;
+		}
+		for (const auto &transition : states[id].getTransitionsView()) {
+			frozen.symbolColumns.emplace(transition.getInputId(), static_cast<uint32_t>(frozen.symbolColumns.size()));
+		}
+	}
+
+	frozen.transitions = buildTransitionTable(stateIndices, frozen.stateLabels.size(), frozen.symbolColumns);
+
+	frozen.startState = stateIndices[startState];
+	return frozen;
+}
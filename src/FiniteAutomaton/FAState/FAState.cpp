@@ -1,74 +1,122 @@
 #include "AutomataSimulator/FAState.h"
+#include <algorithm>
 
+namespace {
+// Returned for inputs the state has no transitions on
+const std::vector<FATransition> noTransitions;
+} // namespace
 
-FAState::FAState() : key(""), label(""), isAccept(false), transitionsCacheInvalidated(false) {}
+FAState::FAState() : label(""), isAccept(false), transitionsCacheInvalidated(false) {}
 
 FAState::FAState(const std::string &label, const bool &isAccept)
-    : key(label), label(label), isAccept(isAccept), transitionsCacheInvalidated(false) {}
+    : label(label), isAccept(isAccept), transitionsCacheInvalidated(false) {}
 
 FAState::FAState(const FAState &other)
-    : key(other.key), label(other.label), isAccept(other.isAccept), transitions(other.transitions),
-      transitionsCacheInvalidated(other.transitionsCacheInvalidated) {}
+    : label(other.label), isAccept(other.isAccept), transitions(other.transitions), transitionsCacheInvalidated(true),
+      transitionsByInput(other.transitionsByInput), epsilonTransitions(other.epsilonTransitions) {}
 
 FAState &FAState::operator=(const FAState &other) {
 	if (this != &other) {
-		key = other.key;
 		label = other.label;
 		isAccept = other.isAccept;
 		transitions = other.transitions;
 		transitionsCacheInvalidated = true;
+		transitionsByInput = other.transitionsByInput;
+		epsilonTransitions = other.epsilonTransitions;
 	}
 	return *this;
 }
 
 FAState::FAState(FAState &&other) noexcept
-    : key(std::move(other.key)), label(std::move(other.label)), isAccept(other.isAccept),
-      transitionsCacheInvalidated(true), transitions(std::move(other.transitions)) {}
+    : label(std::move(other.label)), isAccept(other.isAccept),
+      transitionsCacheInvalidated(true), transitions(std::move(other.transitions)),
+      transitionsByInput(std::move(other.transitionsByInput)),
+      epsilonTransitions(std::move(other.epsilonTransitions)) {}
 
 FAState &FAState::operator=(FAState &&other) noexcept {
 	if (this != &other) {
-		key = std::move(other.key);
 		label = std::move(other.label);
 		isAccept = other.isAccept;
 		transitions = std::move(other.transitions);
 		transitionsCacheInvalidated = true;
+		transitionsByInput = std::move(other.transitionsByInput);
+		epsilonTransitions = std::move(other.epsilonTransitions);
 	}
 	return *this;
 }
 
 bool FAState::operator==(const FAState &other) const {
-	return key == other.key && label == other.label && isAccept == other.isAccept && transitions == other.transitions;
+	return label == other.label && isAccept == other.isAccept && transitions == other.transitions;
 }
 
 FAState::~FAState() {}
 
 FATransition *FAState::getTransitionInternal(const std::string &key) {
-	auto it = transitions.find(key);
+	auto it = transitions.find(FATransition::parseTransitionKey(key));
 	if (it == transitions.end()) {
 		throw TransitionNotFoundException(key);
 	}
 	return &(it->second);
 }
 
+FATransition *FAState::getTransitionInternal(const TransitionKey &key) {
+	auto it = transitions.find(key);
+	if (it == transitions.end()) {
+		throw TransitionNotFoundException(FATransition::generateTransitionKey(key));
+	}
+	return &(it->second);
+}
+
+void FAState::addToInputIndex(const FATransition &transition) {
+	if (transition.getInputId() == SymbolTable::EPSILON_SYMBOL_ID) {
+		epsilonTransitions.push_back(transition);
+	} else {
+		transitionsByInput[transition.getInputId()].push_back(transition);
+	}
+}
+
+void FAState::removeFromInputIndex(const FATransition &transition) {
+	auto it = transitionsByInput.find(transition.getInputId());
+	std::vector<FATransition> &bucket =
+	    transition.getInputId() == SymbolTable::EPSILON_SYMBOL_ID ? epsilonTransitions : it->second;
+
+	// Buckets hold the few transitions sharing one input, order within them does not matter
+	auto match = std::find_if(bucket.begin(), bucket.end(), [&](const FATransition &candidate) {
+		return candidate.getTransitionKey() == transition.getTransitionKey();
+	});
+	*match = std::move(bucket.back());
+	bucket.pop_back();
+
+	if (bucket.empty() && it != transitionsByInput.end()) {
+		transitionsByInput.erase(it);
+	}
+}
+
 bool FAState::transitionExists(const std::string &key) const {
+	return transitionExists(FATransition::parseTransitionKey(key));
+}
+
+bool FAState::transitionExists(const TransitionKey &key) const {
 	return transitions.find(key) != transitions.end();
 }
 
 std::string FAState::getKey() const {
-	return key;
+	return label;
 }
 
 void FAState::setLabel(const std::string &label) {
 	this->label = label;
-	this->key = label;
 
-	std::unordered_map<std::string, FATransition> newTransitions;
+	std::unordered_map<TransitionKey, FATransition> newTransitions;
 
 	// Loop over all transitions to update their from state key.
+	transitionsByInput.clear();
+	epsilonTransitions.clear();
 	for (const auto &pair : transitions) {
 		FATransition transition = pair.second;
-		transition.setFromStateKey(key);
-		newTransitions[transition.getKey()] = transition;
+		transition.setFromStateKey(label);
+		newTransitions[transition.getTransitionKey()] = transition;
+		addToInputIndex(transition);
 	}
 	transitions = newTransitions;
 	transitionsCacheInvalidated = true;
@@ -86,46 +134,50 @@ bool FAState::getIsAccept() const {
 	return isAccept;
 }
 
-void FAState::addTransition(const std::string &toStateKey, const std::string &input) {
-	std::string transitionKey = FATransition::generateTransitionKey(key, toStateKey, input);
+void FAState::addTransition(const std::string &toStateKey, const std::string &input, const StateId &toStateId) {
+	FATransition transition = FATransition(label, toStateKey, input);
 
 	// Check if transition already exists
-	if (transitionExists(transitionKey)) {
-		throw InvalidTransitionException("Transition already exists: " + key + " -> " + input + " -> " + toStateKey);
+	if (transitionExists(transition.getTransitionKey())) {
+		throw InvalidTransitionException("Transition already exists: " + label + " -> " + input + " -> " + toStateKey);
 	}
 
-	FATransition transition = FATransition(key, toStateKey, input);
-	transitions[transition.getKey()] = transition;
+	transition.setToStateId(toStateId);
+	transitions[transition.getTransitionKey()] = transition;
+	addToInputIndex(transition);
 	transitionsCacheInvalidated = true;
 }
 
-FATransition FAState::getTransition(const std::string& key) {
-	auto it = transitions.find(key);
-	// Check if state exists
-	if (it == transitions.end()) {
-		throw TransitionNotFoundException(key);
-	}
-	return it->second;
+FATransition FAState::getTransition(const std::string &key) {
+	return *getTransitionInternal(key);
+}
+
+FATransition FAState::getTransition(const TransitionKey &key) {
+	return *getTransitionInternal(key);
 }
 
 void FAState::setTransitionInput(const std::string &transitionKey, const std::string &input) {
 	if (!transitionExists(transitionKey)) {
 		throw TransitionNotFoundException(transitionKey);
 	}
+	setTransitionInput(FATransition::parseTransitionKey(transitionKey), input);
+}
 
-	std::string newTransitionKey = FATransition::generateTransitionKey(key, getTransitionToState(transitionKey), input);
+void FAState::setTransitionInput(const TransitionKey &transitionKey, const std::string &input) {
+	const FATransition oldTransition = *getTransitionInternal(transitionKey);
+	FATransition transition = oldTransition;
+	transition.setInput(input);
 
 	// Check if transition already exists
-	if (transitionExists(newTransitionKey)) {
-		throw InvalidTransitionException("Transition already exists: " + key + " -> " + input + " -> " +
-		                                 getTransitionToState(transitionKey));
+	if (transitionExists(transition.getTransitionKey())) {
+		throw InvalidTransitionException("Transition already exists: " + label + " -> " + input + " -> " +
+		                                 transition.getToStateKey());
 	}
 
-	FATransition *transition = getTransitionInternal(transitionKey);
-	transition->setInput(input);
-
-	transitions[newTransitionKey] = *transition;
 	transitions.erase(transitionKey);
+	transitions[transition.getTransitionKey()] = transition;
+	removeFromInputIndex(oldTransition);
+	addToInputIndex(transition);
 
 	transitionsCacheInvalidated = true;
 }
@@ -135,24 +187,31 @@ std::string FAState::getTransitionInput(const std::string &transitionKey) {
 	return transition->getInput();
 }
 
-void FAState::setTransitionToState(const std::string &transitionKey, const std::string &toState) {
+void FAState::setTransitionToState(const std::string &transitionKey, const std::string &toState,
+                                   const StateId &toStateId) {
 	if (!transitionExists(transitionKey)) {
 		throw TransitionNotFoundException(transitionKey);
 	}
-	std::string input = getTransitionInput(transitionKey);
-	std::string newTransitionKey = FATransition::generateTransitionKey(key, toState, input);
+	setTransitionToState(FATransition::parseTransitionKey(transitionKey), toState, toStateId);
+}
+
+void FAState::setTransitionToState(const TransitionKey &transitionKey, const std::string &toState,
+                                   const StateId &toStateId) {
+	const FATransition oldTransition = *getTransitionInternal(transitionKey);
+	FATransition transition = oldTransition;
+	transition.setToStateKey(toState);
+	transition.setToStateId(toStateId);
 
 	// Check if transition already exists
-	if (transitionExists(newTransitionKey)) {
-		throw InvalidTransitionException("Transition already exists: " + key + " -> " +
-		                                 getTransitionInput(transitionKey) + " -> " + toState);
+	if (transitionExists(transition.getTransitionKey())) {
+		throw InvalidTransitionException("Transition already exists: " + label + " -> " + transition.getInput() +
+		                                 " -> " + toState);
 	}
 
-	FATransition *transition = getTransitionInternal(transitionKey);
-	transition->setToStateKey(toState);
-
-	transitions[newTransitionKey] = *transition;
 	transitions.erase(transitionKey);
+	transitions[transition.getTransitionKey()] = transition;
+	removeFromInputIndex(oldTransition);
+	addToInputIndex(transition);
 
 	transitionsCacheInvalidated = true;
 }
@@ -163,6 +222,10 @@ std::string FAState::getTransitionToState(const std::string &transitionKey) {
 }
 
 std::vector<FATransition> FAState::getTransitions() {
+	return getTransitionsView();
+}
+
+const std::vector<FATransition> &FAState::getTransitionsView() {
 	if (transitionsCacheInvalidated) {
 		cachedTransitions.clear();
 		for (const auto &pair : transitions) {
@@ -173,11 +236,32 @@ std::vector<FATransition> FAState::getTransitions() {
 	return cachedTransitions;
 }
 
+const std::vector<FATransition> &FAState::getTransitionsOnInput(const SymbolId &input) const {
+	if (input == SymbolTable::EPSILON_SYMBOL_ID) {
+		return epsilonTransitions;
+	}
+	auto it = transitionsByInput.find(input);
+	return it == transitionsByInput.end() ? noTransitions : it->second;
+}
+
+bool FAState::hasTransitionOnInput(const SymbolId &input) const {
+	return !getTransitionsOnInput(input).empty();
+}
+
 void FAState::removeTransition(const std::string &transitionKey) {
 	if (!transitionExists(transitionKey)) {
 		throw TransitionNotFoundException(transitionKey);
 	}
-	transitions.erase(transitionKey);
+	removeTransition(FATransition::parseTransitionKey(transitionKey));
+}
+
+void FAState::removeTransition(const TransitionKey &transitionKey) {
+	auto it = transitions.find(transitionKey);
+	if (it == transitions.end()) {
+		throw TransitionNotFoundException(FATransition::generateTransitionKey(transitionKey));
+	}
+	removeFromInputIndex(it->second);
+	transitions.erase(it);
 	transitionsCacheInvalidated = true;
 }
 
@@ -185,6 +269,7 @@ void FAState::clearTransitionsTo(const std::string &toStateKey) {
 	auto it = transitions.begin();
 	while (it != transitions.end()) {
 		if (it->second.getToStateKey() == toStateKey) {
+			removeFromInputIndex(it->second);
 			it = transitions.erase(it);
 		} else {
 			++it;
@@ -195,6 +280,8 @@ void FAState::clearTransitionsTo(const std::string &toStateKey) {
 
 void FAState::clearTransitions() {
 	transitions.clear();
+	transitionsByInput.clear();
+	epsilonTransitions.clear();
 	transitionsCacheInvalidated = true;
 }
 
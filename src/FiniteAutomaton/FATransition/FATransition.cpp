@@ -1,19 +1,24 @@
 #include "AutomataSimulator/FATransition.h"
+#include <algorithm>
 
-FATransition::FATransition() : fromStateKey(""), toStateKey(""), input(""), key("") {}
+FATransition::FATransition()
+    : fromStateKey(""), toStateKey(""), toStateId(INVALID_STATE_ID), input(SymbolTable::EPSILON_SYMBOL_ID) {}
 
 FATransition::FATransition(const std::string &fromStateKey, const std::string &toStateKey, const std::string &input)
-    : fromStateKey(fromStateKey), toStateKey(toStateKey), input(input) {
-	key = generateTransitionKey(fromStateKey, toStateKey, input);
+    : fromStateKey(fromStateKey), toStateKey(toStateKey), toStateId(INVALID_STATE_ID),
+      input(SymbolTable::intern(input)) {
+	updateKey();
 }
 
 FATransition::FATransition(const FATransition &other)
-    : fromStateKey(other.fromStateKey), toStateKey(other.toStateKey), input(other.input), key(other.key) {}
+    : fromStateKey(other.fromStateKey), toStateKey(other.toStateKey), toStateId(other.toStateId),
+      input(other.input), key(other.key) {}
 
 FATransition &FATransition::operator=(const FATransition &other) {
 	if (this != &other) {
 		fromStateKey = other.fromStateKey;
 		toStateKey = other.toStateKey;
+		toStateId = other.toStateId;
 		input = other.input;
 		key = other.key;
 	}
@@ -21,14 +26,16 @@ FATransition &FATransition::operator=(const FATransition &other) {
 }
 
 FATransition::FATransition(FATransition &&other) noexcept
-    : fromStateKey(other.fromStateKey), toStateKey(other.toStateKey), input(other.input), key(other.key) {}
+    : fromStateKey(std::move(other.fromStateKey)), toStateKey(std::move(other.toStateKey)),
+      toStateId(other.toStateId), input(other.input), key(std::move(other.key)) {}
 
 FATransition &FATransition::operator=(FATransition &&other) noexcept {
 	if (this != &other) {
-		fromStateKey = other.fromStateKey;
-		toStateKey = other.toStateKey;
+		fromStateKey = std::move(other.fromStateKey);
+		toStateKey = std::move(other.toStateKey);
+		toStateId = other.toStateId;
 		input = other.input;
-		key = other.key;
+		key = std::move(other.key);
 	}
 	return *this;
 }
@@ -41,41 +48,55 @@ FATransition::~FATransition() {}
 
 std::string FATransition::generateTransitionKey(const std::string &fromStateKey, const std::string &toStateKey,
                                                 const std::string &input) {
-	return fromStateKey + "-" + toStateKey + "-" + input;
+	return TransitionKey::joinParts({fromStateKey, toStateKey, input});
+}
+
+std::string FATransition::generateTransitionKey(const TransitionKey &key) {
+	return generateTransitionKey(SymbolTable::getSymbol(key.fromState), SymbolTable::getSymbol(key.toState),
+	                             SymbolTable::getSymbol(key.symbols[0]));
 }
 
-void FATransition::validateTransitionKeyFormat(const std::string &key) {
+TransitionKey FATransition::parseTransitionKey(const std::string &key) {
+	std::vector<std::string> parts = splitTransitionKey(key);
+	return TransitionKey(SymbolTable::find(parts[0]), SymbolTable::find(parts[1]), SymbolTable::find(parts[2]));
+}
+
+std::vector<std::string> FATransition::splitTransitionKey(const std::string &key) {
 	// Expected format: fromState-toState-input
-	int delimiterCount = std::count(key.begin(), key.end(), '-');
-	if (delimiterCount != 2) {
+	std::vector<std::string> parts = TransitionKey::splitParts(key);
+	if (parts.size() != 3) {
 		throw InvalidTransitionException("Invalid FA transition key format: " + key);
 	}
+	return parts;
 }
 
 std::string FATransition::getFromStateFromKey(const std::string &key) {
-	validateTransitionKeyFormat(key);
-	return key.substr(0, key.find('-'));
+	return splitTransitionKey(key)[0];
 }
 
 std::string FATransition::getToStateFromKey(const std::string &key) {
-	validateTransitionKeyFormat(key);
-	size_t first = key.find('-');
-	size_t last = key.find_last_of('-');
-	return key.substr(first + 1, last - first - 1);
+	return splitTransitionKey(key)[1];
 }
 
 std::string FATransition::getInputFromKey(const std::string &key) {
-	validateTransitionKeyFormat(key);
-	return key.substr(key.find_last_of('-') + 1);
+	return splitTransitionKey(key)[2];
 }
 
 std::string FATransition::getKey() const {
+	return generateTransitionKey(fromStateKey, toStateKey, getInput());
+}
+
+const TransitionKey &FATransition::getTransitionKey() const {
 	return key;
 }
 
+void FATransition::updateKey() {
+	key = TransitionKey(SymbolTable::intern(fromStateKey), SymbolTable::intern(toStateKey), input);
+}
+
 void FATransition::setFromStateKey(const std::string &fromStateKey) {
 	this->fromStateKey = fromStateKey;
-	key = generateTransitionKey(fromStateKey, toStateKey, input);
+	updateKey();
 }
 
 std::string FATransition::getFromStateKey() const {
@@ -84,22 +105,34 @@ std::string FATransition::getFromStateKey() const {
 
 void FATransition::setToStateKey(const std::string &toStateKey) {
 	this->toStateKey = toStateKey;
-	key = generateTransitionKey(fromStateKey, toStateKey, input);
+	updateKey();
 }
 
 std::string FATransition::getToStateKey() const {
 	return toStateKey;
 }
 
+void FATransition::setToStateId(const StateId &toStateId) {
+	this->toStateId = toStateId;
+}
+
+StateId FATransition::getToStateId() const {
+	return toStateId;
+}
+
 void FATransition::setInput(const std::string &input) {
-	this->input = input;
-	key = generateTransitionKey(fromStateKey, toStateKey, input);
+	this->input = SymbolTable::intern(input);
+	updateKey();
 }
 
 std::string FATransition::getInput() const {
+	return SymbolTable::getSymbol(input);
+}
+
+SymbolId FATransition::getInputId() const {
 	return input;
 }
 
 std::string FATransition::toString() const {
-	return "Transition: [" + fromStateKey + " -> " + toStateKey + " | Input: " + input + "]";
+	return "Transition: [" + fromStateKey + " -> " + toStateKey + " | Input: " + getInput() + "]";
 }
@@ -1,7 +1,8 @@
 #include "AutomataSimulator/FiniteAutomaton.h"
 
 FiniteAutomaton::FiniteAutomaton()
-    : inputHead(0), startState(""), inputAlphabetCacheInvalidated(false), statesCacheInvalidated(false) {}
+    : inputHead(0), currentState(INVALID_STATE_ID), startState(INVALID_STATE_ID), inputAlphabetCacheInvalidated(false),
+      statesCacheInvalidated(false), definitionVersion(0) {}
 
 FiniteAutomaton::~FiniteAutomaton() {}
 
@@ -14,7 +15,8 @@ void FiniteAutomaton::validateTransition(const std::string &fromStateKey, const
 		throw StateNotFoundException(toStateKey);
 	}
 	FAState *fromState = getStateInternal(fromStateKey);
-	std::string transitionKey = FATransition::generateTransitionKey(fromStateKey, toStateKey, input);
+	TransitionKey transitionKey(SymbolTable::find(fromStateKey), SymbolTable::find(toStateKey),
+	                            SymbolTable::find(input));
 
 	// Check if the new transition would be a duplicate
 	if (fromState->transitionExists(transitionKey)) {
@@ -23,34 +25,105 @@ void FiniteAutomaton::validateTransition(const std::string &fromStateKey, const
 	}
 }
 
+void FiniteAutomaton::prepareConcurrentSimulation() {
+	std::lock_guard<CacheMutex> lock(simulationCachesMutex);
+	buildSimulationCaches();
+}
+
+void FiniteAutomaton::buildSimulationCaches() {
+	// Rebuilds the transition vector of every state whose cache was invalidated
+	for (auto &state : states) {
+		state.getTransitionsView();
+	}
+}
+
 FAState *FiniteAutomaton::getStateInternal(const std::string &key) {
-	auto it = states.find(key);
+	return &states[getStateId(key)];
+}
+
+FAState *FiniteAutomaton::getStateInternal(const StateId &id) {
+	// Check if state exists
+	if (!stateIdInUse(id)) {
+		throw StateNotFoundException(getStateLabel(id));
+	}
+	return &states[id];
+}
+
+StateId FiniteAutomaton::getStateId(const std::string &key) const {
+	auto it = stateIds.find(key);
 	// Check if state exists
-	if (it == states.end()) {
+	if (it == stateIds.end()) {
 		throw StateNotFoundException(key);
 	}
-	return &(it->second);
+	return it->second;
+}
+
+std::string FiniteAutomaton::getStateLabel(const StateId &id) const {
+	if (!stateIdInUse(id)) {
+		return "";
+	}
+	return states[id].getLabel();
+}
+
+bool FiniteAutomaton::stateIdInUse(const StateId &id) const {
+	return id < states.size() && stateSlotsInUse[id];
+}
+
+void FiniteAutomaton::releaseState(const StateId &id) {
+	stateIds.erase(states[id].getLabel());
+
+	// Drop the outgoing transitions of the state from the index of the states they lead to
+	for (const auto &transition : states[id].getTransitionsView()) {
+		unindexTransition(transition.getToStateId(), transition.getTransitionKey());
+	}
+	incomingTransitions[id].clear();
+
+	// Free slots hold an empty non-accepting state, so loops over all slots can skip the in-use check
+	states[id] = FAState();
+	stateSlotsInUse[id] = false;
+	freeStateIds.push_back(id);
+
+	if (id == startState) {
+		startState = INVALID_STATE_ID;
+	}
+	if (id == currentState) {
+		currentState = INVALID_STATE_ID;
+	}
+}
+
+void FiniteAutomaton::indexTransition(const StateId &fromId, const StateId &toId, const TransitionKey &key) {
+	incomingTransitions[toId][key] = fromId;
+}
+
+void FiniteAutomaton::unindexTransition(const StateId &toId, const TransitionKey &key) {
+	incomingTransitions[toId].erase(key);
+}
+
+void FiniteAutomaton::removeTransitionInternal(FAState &state, const FATransition &transition) {
+	unindexTransition(transition.getToStateId(), transition.getTransitionKey());
+	state.removeTransition(transition.getTransitionKey());
 }
 
 const bool FiniteAutomaton::stateExists(const std::string &key) const {
-	return states.find(key) != states.end();
+	return stateIds.find(key) != stateIds.end();
 }
 
 const bool FiniteAutomaton::inputAlphabetSymbolExists(const std::string &symbol) const {
-	return inputAlphabet.find(symbol) != inputAlphabet.end();
+	return inputAlphabet.find(SymbolTable::find(symbol)) != inputAlphabet.end();
 }
 
 const std::vector<std::string> FiniteAutomaton::getInput() const {
-	return input;
+	return SymbolTable::getSymbols(input);
 }
 
 void FiniteAutomaton::setInput(const std::vector<std::string> &input) {
-	this->input = input;
+	this->input = SymbolTable::intern(input);
 	this->inputHead = 0;
 }
 
 void FiniteAutomaton::addInput(const std::vector<std::string> &input) {
-	this->input.insert(this->input.end(), input.begin(), input.end());
+	std::vector<SymbolId> inputIds = SymbolTable::intern(input);
+	this->input.insert(this->input.end(), inputIds.begin(), inputIds.end());
 }
 
 const int FiniteAutomaton::getInputHead() const {
@@ -73,21 +146,34 @@ void FiniteAutomaton::addState(const std::string &label, const bool &isAccept) {
 		throw InvalidAutomatonDefinitionException("State with label " + label + " already exists");
 	}
 
-	FAState state(label, isAccept);
+	// Reuse the slot of a removed state if there is one
+	StateId id;
+	if (!freeStateIds.empty()) {
+		id = freeStateIds.back();
+		freeStateIds.pop_back();
+		states[id] = FAState(label, isAccept);
+		stateSlotsInUse[id] = true;
+	} else {
+		id = static_cast<StateId>(states.size());
+		states.emplace_back(label, isAccept);
+		stateSlotsInUse.push_back(true);
+		incomingTransitions.emplace_back();
+	}
+	stateIds[label] = id;
 
 	// Check if start state is empty, if so set it to the new state
-	if (startState.empty()) {
-		startState = label;
+	if (startState == INVALID_STATE_ID) {
+		startState = id;
 	}
 
 	// Check if current state is empty, if so set it to the new state
-	if (currentState.empty()) {
-		currentState = label;
+	if (currentState == INVALID_STATE_ID) {
+		currentState = id;
 	}
 
-	// Update the vector and invalidate conversion cache
-	states[state.getKey()] = state;
+	// Invalidate conversion cache
 	statesCacheInvalidated = true;
+	definitionVersion++;
 }
 
 void FiniteAutomaton::updateStateLabel(const std::string &key, const std::string &label) {
@@ -96,58 +182,66 @@ void FiniteAutomaton::updateStateLabel(const std::string &key, const std::string
 		throw InvalidAutomatonDefinitionException("State with label " + label + " already exists");
 	}
 
-	FAState *state = getStateInternal(key);
+	StateId id = getStateId(key);
 
-	state->setLabel(label);
-
-	if (key == startState) {
-		startState = label;
+	// Relabelling changes the keys of the outgoing transitions, so reindex them under their new keys
+	for (const auto &transition : states[id].getTransitionsView()) {
+		unindexTransition(transition.getToStateId(), transition.getTransitionKey());
+	}
+	states[id].setLabel(label);
+	for (const auto &transition : states[id].getTransitionsView()) {
+		indexTransition(id, transition.getToStateId(), transition.getTransitionKey());
 	}
+	stateIds.erase(key);
+	stateIds[label] = id;
 
-	states[state->getKey()] = *state;
-	states.erase(key);
+	// Repoint the transitions leading into the state to the new label, their ids are unchanged
+	SymbolId labelId = SymbolTable::intern(label);
+	std::unordered_map<TransitionKey, StateId> relabelledTransitions;
+	for (const auto &[transitionKey, fromId] : incomingTransitions[id]) {
+		states[fromId].setTransitionToState(transitionKey, label, id);
+		relabelledTransitions[TransitionKey(transitionKey.fromState, labelId, transitionKey.symbols[0])] = fromId;
+	}
+	incomingTransitions[id] = std::move(relabelledTransitions);
 
 	statesCacheInvalidated = true;
+	definitionVersion++;
 }
 
 const std::string FiniteAutomaton::getCurrentState() const {
 	// If there is no current state and no start state to fallback to then throw error
-	if (currentState.empty() && startState.empty()) {
+	if (currentState == INVALID_STATE_ID && startState == INVALID_STATE_ID) {
 		throw InvalidAutomatonDefinitionException("Current state and start state are not set");
 	}
 
 	// Fallback to start state if no current state is set
-	if (currentState.empty()) {
-		return startState;
+	if (currentState == INVALID_STATE_ID) {
+		return getStateLabel(startState);
 	}
 
-	return currentState;
+	return getStateLabel(currentState);
 }
 
 void FiniteAutomaton::setCurrentState(const std::string &key) {
-	// Check if state exists
-	if (!stateExists(key)) {
-		throw StateNotFoundException(key);
-	}
-
-	currentState = key;
+	currentState = getStateId(key);
 }
 
 FAState FiniteAutomaton::getState(const std::string &key) const {
-	auto it = states.find(key);
-	// Check if state exists
-	if (it == states.end()) {
-		throw StateNotFoundException(key);
-	}
-	return it->second;
+	return states[getStateId(key)];
 }
 
 const std::vector<FAState> FiniteAutomaton::getStates() {
+	return getStatesView();
+}
+
+const std::vector<FAState> &FiniteAutomaton::getStatesView() {
 	// if the conversion cache from unordered_map to vector is not valid then recompute
 	if (statesCacheInvalidated) {
 		cachedStates.clear();
-		for (const auto &pair : states) {
-			cachedStates.push_back(pair.second);
+		for (StateId id = 0; id < states.size(); id++) {
+			if (stateSlotsInUse[id]) {
+				cachedStates.push_back(states[id]);
+			}
 		}
 		statesCacheInvalidated = false;
 	}
@@ -155,26 +249,21 @@ const std::vector<FAState> FiniteAutomaton::getStates() {
 }
 
 void FiniteAutomaton::removeState(const std::string &key, const bool &strict) {
-	// Check if state exists
-	if (!stateExists(key)) {
-		throw StateNotFoundException(key);
-	}
+	StateId id = getStateId(key);
 
 	std::vector<std::string> conflictingTransitions;
 
 	// Check for conflicting transitions
-	for (auto &pair : states) {
-		std::vector<FATransition> transitions = pair.second.getTransitions();
-		for (const auto &transition : transitions) {
-			if (transition.getToStateKey() == key) {
-				if (strict) {
-					conflictingTransitions.push_back(transition.getKey());
-				} else {
-					pair.second.removeTransition(transition.getKey());
-				}
-			}
+	for (const auto &[transitionKey, fromId] : incomingTransitions[id]) {
+		if (strict) {
+			conflictingTransitions.push_back(FATransition::generateTransitionKey(transitionKey));
+		} else {
+			states[fromId].removeTransition(transitionKey);
 		}
 	}
+	if (!strict) {
+		incomingTransitions[id].clear();
+	}
 
 	// If strict mode is enabled and conflicts exist, throw an error
 	if (strict && !conflictingTransitions.empty()) {
@@ -188,14 +277,9 @@ void FiniteAutomaton::removeState(const std::string &key, const bool &strict) {
 		throw InvalidAutomatonDefinitionException(conflictMessage);
 	}
 
-	states.erase(key);
-	if (key == startState) {
-		startState = "";
-	}
-	if (key == currentState) {
-		currentState = "";
-	}
+	releaseState(id);
 	statesCacheInvalidated = true;
+	definitionVersion++;
 }
 
 void FiniteAutomaton::removeStates(const std::vector<std::string> &keys, const bool &strict) {
@@ -221,18 +305,17 @@ void FiniteAutomaton::removeStates(const std::vector<std::string> &keys, const b
 
 	// Check for conflicting transitions
 	for (const auto &key : keys) {
-		for (auto &pair : states) {
-			std::vector<FATransition> transitions = pair.second.getTransitions();
-			for (const auto &transition : transitions) {
-				if (transition.getToStateKey() == key) {
-					if (strict) {
-						conflictingTransitions[key].push_back(transition.getKey());
-					} else {
-						pair.second.removeTransition(transition.getKey());
-					}
-				}
+		StateId id = getStateId(key);
+		for (const auto &[transitionKey, fromId] : incomingTransitions[id]) {
+			if (strict) {
+				conflictingTransitions[key].push_back(FATransition::generateTransitionKey(transitionKey));
+			} else {
+				states[fromId].removeTransition(transitionKey);
 			}
 		}
+		if (!strict) {
+			incomingTransitions[id].clear();
+		}
 	}
 
 	// If strict mode is enabled and conflicts exist, throw an error
@@ -252,41 +335,40 @@ void FiniteAutomaton::removeStates(const std::vector<std::string> &keys, const b
 
 	// Remove states
 	for (const auto &key : keys) {
-		states.erase(key);
-		if (key == startState) {
-			startState = "";
-		}
-		if (key == currentState) {
-			currentState = "";
-		}
+		releaseState(getStateId(key));
 	}
 
 	statesCacheInvalidated = true;
+	definitionVersion++;
 }
 
 void FiniteAutomaton::clearStates() {
 	states.clear();
-	currentState = "";
-	startState = "";
+	stateSlotsInUse.clear();
+	incomingTransitions.clear();
+	stateIds.clear();
+	freeStateIds.clear();
+	currentState = INVALID_STATE_ID;
+	startState = INVALID_STATE_ID;
 	statesCacheInvalidated = true;
+	definitionVersion++;
 }
 
 void FiniteAutomaton::setInputAlphabet(const std::vector<std::string> &inputAlphabet, const bool &strict) {
 
 	std::unordered_map<std::string, std::vector<std::string>> conflictingTransitions;
-	std::unordered_set<std::string> newAlphabet =
-	    std::unordered_set<std::string>(inputAlphabet.begin(), inputAlphabet.end());
+	std::vector<SymbolId> newAlphabetIds = SymbolTable::intern(inputAlphabet);
+	std::unordered_set<SymbolId> newAlphabet = std::unordered_set<SymbolId>(newAlphabetIds.begin(), newAlphabetIds.end());
 
-	for (auto &pair : states) {
-		std::vector<FATransition> transitions = pair.second.getTransitions();
+	for (auto &state : states) {
+		std::vector<FATransition> transitions = state.getTransitions();
 		for (const auto &transition : transitions) {
-			std::string symbol = transition.getInput();
-			bool found = newAlphabet.find(symbol) != newAlphabet.end();
+			bool found = newAlphabet.find(transition.getInputId()) != newAlphabet.end();
 			if (!found) {
 				if (strict) {
-					conflictingTransitions[symbol].push_back(transition.getKey());
+					conflictingTransitions[transition.getInput()].push_back(transition.getKey());
 				} else {
-					pair.second.removeTransition(transition.getKey());
+					removeTransitionInternal(state, transition);
 				}
 			}
 		}
@@ -310,13 +392,15 @@ void FiniteAutomaton::setInputAlphabet(const std::vector<std::string> &inputAlph
 
 	this->inputAlphabet = newAlphabet;
 	inputAlphabetCacheInvalidated = true;
+	definitionVersion++;
 }
 
 void FiniteAutomaton::addInputAlphabet(const std::vector<std::string> &inputAlphabet) {
 	for (const auto &symbol : inputAlphabet) {
-		this->inputAlphabet.insert(symbol);
+		this->inputAlphabet.insert(SymbolTable::intern(symbol));
 	}
 	inputAlphabetCacheInvalidated = true;
+	definitionVersion++;
 }
 
 const std::vector<std::string> FiniteAutomaton::getInputAlphabet() {
@@ -324,7 +408,7 @@ const std::vector<std::string> FiniteAutomaton::getInputAlphabet() {
 	if (inputAlphabetCacheInvalidated) {
 		cachedInputAlphabet.clear();
 		for (const auto &symbol : inputAlphabet) {
-			cachedInputAlphabet.push_back(symbol);
+			cachedInputAlphabet.push_back(SymbolTable::getSymbol(symbol));
 		}
 		inputAlphabetCacheInvalidated = false;
 	}
@@ -338,16 +422,17 @@ void FiniteAutomaton::removeInputAlphabetSymbol(const std::string &symbol, const
 	}
 
 	std::vector<std::string> conflictingTransitions;
+	SymbolId symbolId = SymbolTable::find(symbol);
 
 	// Check for conflicting transitions
-	for (auto &pair : states) {
-		std::vector<FATransition> transitions = pair.second.getTransitions();
+	for (auto &state : states) {
+		std::vector<FATransition> transitions = state.getTransitions();
 		for (const auto &transition : transitions) {
-			if (transition.getInput() == symbol) {
+			if (transition.getInputId() == symbolId) {
 				if (strict) {
 					conflictingTransitions.push_back(transition.getKey());
 				} else {
-					pair.second.removeTransition(transition.getKey());
+					removeTransitionInternal(state, transition);
 				}
 			}
 		}
@@ -365,8 +450,9 @@ void FiniteAutomaton::removeInputAlphabetSymbol(const std::string &symbol, const
 		throw InvalidAutomatonDefinitionException(conflictMessage);
 	}
 
-	inputAlphabet.erase(symbol);
+	inputAlphabet.erase(SymbolTable::find(symbol));
 	inputAlphabetCacheInvalidated = true;
+	definitionVersion++;
 }
 
 void FiniteAutomaton::removeInputAlphabetSymbols(const std::vector<std::string> &symbols, const bool &strict) {
@@ -393,14 +479,15 @@ void FiniteAutomaton::removeInputAlphabetSymbols(const std::vector<std::string>
 
 	// Check for conflicting transitions
 	for (const auto &symbol : symbols) {
-		for (auto &pair : states) {
-			std::vector<FATransition> transitions = pair.second.getTransitions();
+		SymbolId symbolId = SymbolTable::find(symbol);
+		for (auto &state : states) {
+			std::vector<FATransition> transitions = state.getTransitions();
 			for (const auto &transition : transitions) {
-				if (transition.getInput() == symbol) {
+				if (transition.getInputId() == symbolId) {
 					if (strict) {
 						conflictingTransitions[symbol].push_back(transition.getKey());
 					} else {
-						pair.second.removeTransition(transition.getKey());
+						removeTransitionInternal(state, transition);
 					}
 				}
 			}
@@ -424,21 +511,22 @@ void FiniteAutomaton::removeInputAlphabetSymbols(const std::vector<std::string>
 
 	// If no missing symbols found then we remove
 	for (const auto &symbol : symbols) {
-		inputAlphabet.erase(symbol);
+		inputAlphabet.erase(SymbolTable::find(symbol));
 	}
 	inputAlphabetCacheInvalidated = true;
+	definitionVersion++;
 }
 
 void FiniteAutomaton::clearInputAlphabet(const bool &strict) {
-	for (auto &pair : states) {
-		std::vector<FATransition> transitions = pair.second.getTransitions();
+	for (auto &state : states) {
+		std::vector<FATransition> transitions = state.getTransitions();
 		for (const auto &transition : transitions) {
-			if (!transition.getInput().empty()) {
+			if (transition.getInputId() != SymbolTable::EPSILON_SYMBOL_ID) {
 				if (strict) {
 					throw InvalidAutomatonDefinitionException(
 					    "Cannot clear input alphabet because non-epsilon transitions exist");
 				} else {
-					pair.second.removeTransition(transition.getKey());
+					removeTransitionInternal(state, transition);
 				}
 			}
 		}
@@ -446,25 +534,22 @@ void FiniteAutomaton::clearInputAlphabet(const bool &strict) {
 
 	inputAlphabet.clear();
 	inputAlphabetCacheInvalidated = true;
+	definitionVersion++;
 }
 
 const std::string FiniteAutomaton::getStartState() const {
-	if (startState.empty()) {
+	if (startState == INVALID_STATE_ID) {
 		throw InvalidStartStateException("Start state is not set");
 	}
-	return startState;
+	return getStateLabel(startState);
 }
 
 void FiniteAutomaton::setStartState(const std::string &key) {
-	// Check if the state exists
-	if (!stateExists(key)) {
-		throw StateNotFoundException(key);
-	}
-
-	startState = key;
+	startState = getStateId(key);
+	definitionVersion++;
 
-	if (currentState.empty()) {
-		currentState = key;
+	if (currentState == INVALID_STATE_ID) {
+		currentState = startState;
 	}
 }
 
@@ -477,8 +562,13 @@ void FiniteAutomaton::addTransition(const std::string &fromStateKey, const std::
                                     const std::string &input) {
 	validateTransition(fromStateKey, toStateKey, input);
 	FAState *state = getStateInternal(fromStateKey);
-	state->addTransition(toStateKey, input);
+	StateId toId = getStateId(toStateKey);
+	state->addTransition(toStateKey, input, toId);
+	TransitionKey transitionKey(SymbolTable::find(fromStateKey), SymbolTable::find(toStateKey),
+	                            SymbolTable::find(input));
+	indexTransition(getStateId(fromStateKey), toId, transitionKey);
 	statesCacheInvalidated = true;
+	definitionVersion++;
 }
 
 void FiniteAutomaton::updateTransitionInput(const std::string &transitionKey, const std::string &input) {
@@ -503,7 +593,11 @@ void FiniteAutomaton::updateTransitionInput(const std::string &transitionKey, co
 	}
 
 	fromState->setTransitionInput(transitionKey, input);
+	StateId toId = getStateId(toStateKey);
+	unindexTransition(toId, FATransition::parseTransitionKey(transitionKey));
+	indexTransition(getStateId(fromStateKey), toId, FATransition::parseTransitionKey(newTransitionKey));
 	statesCacheInvalidated = true;
+	definitionVersion++;
 }
 
 void FiniteAutomaton::updateTransitionFromState(const std::string &transitionKey, const std::string &fromStateKey) {
@@ -530,11 +624,16 @@ void FiniteAutomaton::updateTransitionFromState(const std::string &transitionKey
 
 	FAState *newFromState = getStateInternal(fromStateKey);
 
+	StateId toId = getStateId(toStateKey);
+
 	// Remove the transition from the old from state
 	oldFromState->removeTransition(transitionKey);
+	unindexTransition(toId, FATransition::parseTransitionKey(transitionKey));
 	// Add the transition to the new from state
-	newFromState->addTransition(toStateKey, input);
+	newFromState->addTransition(toStateKey, input, toId);
+	indexTransition(getStateId(fromStateKey), toId, FATransition::parseTransitionKey(newTransitionKey));
 	statesCacheInvalidated = true;
+	definitionVersion++;
 }
 
 void FiniteAutomaton::updateTransitionToState(const std::string &transitionKey, const std::string &toStateKey) {
@@ -557,35 +656,55 @@ void FiniteAutomaton::updateTransitionToState(const std::string &transitionKey,
 		throw TransitionNotFoundException(transitionKey);
 	}
 
-	fromState->setTransitionToState(transitionKey, toStateKey);
+	StateId oldToId = fromState->getTransition(transitionKey).getToStateId();
+	StateId toId = getStateId(toStateKey);
+	fromState->setTransitionToState(transitionKey, toStateKey, toId);
+	unindexTransition(oldToId, FATransition::parseTransitionKey(transitionKey));
+	indexTransition(getStateId(fromStateKey), toId, FATransition::parseTransitionKey(newTransitionKey));
 	statesCacheInvalidated = true;
+	definitionVersion++;
 }
 
 void FiniteAutomaton::removeTransition(const std::string &transitionKey) {
 	std::string fromStateKey = FATransition::getFromStateFromKey(transitionKey);
 
 	FAState *fromState = getStateInternal(fromStateKey);
-	fromState->removeTransition(transitionKey);
+	removeTransitionInternal(*fromState, fromState->getTransition(transitionKey));
 	statesCacheInvalidated = true;
+	definitionVersion++;
 }
 
 void FiniteAutomaton::clearTransitionsBetween(const std::string &fromStateKey, const std::string &toStateKey) {
 	FAState *fromState = getStateInternal(fromStateKey);
+	for (const auto &transition : fromState->getTransitionsView()) {
+		if (transition.getToStateKey() == toStateKey) {
+			unindexTransition(transition.getToStateId(), transition.getTransitionKey());
+		}
+	}
 	fromState->clearTransitionsTo(toStateKey);
 	statesCacheInvalidated = true;
+	definitionVersion++;
 }
 
 void FiniteAutomaton::clearStateTransitions(const std::string &stateKey) {
 	FAState *state = getStateInternal(stateKey);
+	for (const auto &transition : state->getTransitionsView()) {
+		unindexTransition(transition.getToStateId(), transition.getTransitionKey());
+	}
 	state->clearTransitions();
 	statesCacheInvalidated = true;
+	definitionVersion++;
 }
 
 void FiniteAutomaton::clearTransitions() {
-	for (auto &pair : states) {
-		pair.second.clearTransitions();
+	for (auto &state : states) {
+		state.clearTransitions();
+	}
+	for (auto &incoming : incomingTransitions) {
+		incoming.clear();
 	}
 	statesCacheInvalidated = true;
+	definitionVersion++;
 }
 
 void FiniteAutomaton::addAcceptState(const std::string &stateKey) {
@@ -593,6 +712,7 @@ void FiniteAutomaton::addAcceptState(const std::string &stateKey) {
 
 	state->setIsAccept(true);
 	statesCacheInvalidated = true;
+	definitionVersion++;
 }
 
 void FiniteAutomaton::addAcceptStates(const std::vector<std::string> &keys) {
@@ -620,6 +740,7 @@ void FiniteAutomaton::addAcceptStates(const std::vector<std::string> &keys) {
 	}
 
 	statesCacheInvalidated = true;
+	definitionVersion++;
 }
 
 void FiniteAutomaton::removeAcceptState(const std::string &stateKey) {
@@ -627,6 +748,7 @@ void FiniteAutomaton::removeAcceptState(const std::string &stateKey) {
 
 	state->setIsAccept(false);
 	statesCacheInvalidated = true;
+	definitionVersion++;
 }
 
 void FiniteAutomaton::removeAcceptStates(const std::vector<std::string> &keys) {
@@ -654,20 +776,22 @@ void FiniteAutomaton::removeAcceptStates(const std::vector<std::string> &keys) {
 	}
 
 	statesCacheInvalidated = true;
+	definitionVersion++;
 }
 
 void FiniteAutomaton::clearAcceptStates() {
-	for (auto &pair : states) {
-		pair.second.setIsAccept(false);
+	for (auto &state : states) {
+		state.setIsAccept(false);
 	}
 	statesCacheInvalidated = true;
+	definitionVersion++;
 }
 
 std::vector<FAState> FiniteAutomaton::getAcceptStates() const {
 	std::vector<FAState> acceptStates;
-	for (auto &pair : states) {
-		if (pair.second.getIsAccept()) {
-			acceptStates.push_back(pair.second);
+	for (const auto &state : states) {
+		if (state.getIsAccept()) {
+			acceptStates.push_back(state);
 		}
 	}
 	return acceptStates;
@@ -679,25 +803,27 @@ void FiniteAutomaton::reset() {
 }
 
 const bool FiniteAutomaton::isAccepting() const {
-	return getState(currentState).getIsAccept();
+	if (!stateIdInUse(currentState)) {
+		throw StateNotFoundException(getStateLabel(currentState));
+	}
+	return states[currentState].getIsAccept();
 }
 
 const bool FiniteAutomaton::checkNextState(const std::string &key) const {
-	// Check if state exists
-	if (!stateExists(key)) {
-		throw StateNotFoundException(key);
+	StateId toStateId = getStateId(key);
+	if (!stateIdInUse(currentState)) {
+		throw StateNotFoundException(getStateLabel(currentState));
 	}
 
-	const std::string &currentInput = getInput()[inputHead];
+	const SymbolId &currentInput = input[inputHead];
 
-	FAState state = getState(currentState);
-	const std::vector<FATransition> &transitions = state.getTransitions();
-	for (const auto &transition : transitions) {
-		if (transition.getToStateKey() != key) {
-			continue;
-		}
-		if (transition.getInput().empty() || transition.getInput() == currentInput) {
-			return true;
+	// Only the transitions on the current input and the epsilon transitions can lead to the state
+	const FAState &state = states[currentState];
+	for (const SymbolId &inputId : {currentInput, SymbolTable::EPSILON_SYMBOL_ID}) {
+		for (const auto &transition : state.getTransitionsOnInput(inputId)) {
+			if (transition.getToStateId() == toStateId) {
+				return true;
+			}
 		}
 	}
 	return false;
@@ -0,0 +1,86 @@
+#include "AutomataSimulator/FrozenDFA.h"
+#include "AutomataSimulator/BatchExecutor.h"
+#include <algorithm>
+
+FrozenDFA::FrozenDFA() : startState(DEAD_STATE) {}
+
+FrozenDFA::Context FrozenDFA::createContext(const std::vector<std::string> &input) const {
+	return {SymbolTable::find(input), 0, startState};
+}
+
+bool FrozenDFA::step(Context &context) const {
+	if (context.currentState == DEAD_STATE || context.inputHead >= context.input.size()) {
+		return false;
+	}
+
+	auto columnIt = symbolColumns.find(context.input[context.inputHead]);
+	if (columnIt == symbolColumns.end()) {
+		context.currentState = DEAD_STATE;
+		return false;
+	}
+
+	context.currentState = transitions[context.currentState * symbolColumns.size() + columnIt->second];
+	context.inputHead++;
+	return context.currentState != DEAD_STATE;
+}
+
+bool FrozenDFA::isAccepting(const Context &context) const {
+	return context.currentState != DEAD_STATE && acceptStates[context.currentState];
+}
+
+std::string FrozenDFA::getCurrentState(const Context &context) const {
+	return context.currentState == DEAD_STATE ? "" : stateLabels[context.currentState];
+}
+
+std::string FrozenDFA::getStartState() const {
+	return stateLabels[startState];
+}
+
+std::size_t FrozenDFA::getStateCount() const {
+	return stateLabels.size();
+}
+
+bool FrozenDFA::simulate(const std::vector<std::string> &input, const int &simulationDepth) const {
+	return simulateInput(SymbolTable::find(input), simulationDepth);
+}
+
+std::vector<bool> FrozenDFA::simulateBatch(const std::vector<std::vector<std::string>> &inputs,
+                                           const int &simulationDepth) const {
+	std::vector<std::vector<SymbolId>> inputIds = SymbolTable::find(inputs);
+	std::vector<bool> results(inputs.size());
+	for (std::size_t i = 0; i < inputs.size(); i++) {
+		results[i] = simulateInput(inputIds[i], simulationDepth);
+	}
+	return results;
+}
+
+std::vector<bool> FrozenDFA::simulateBatchParallel(const std::vector<std::vector<std::string>> &inputs,
+                                                   const std::size_t &threadCount, const int &simulationDepth) const {
+	std::vector<std::vector<SymbolId>> inputIds = SymbolTable::find(inputs);
+
+	return BatchExecutor::runPredicate(inputs.size(), threadCount, [&](const std::size_t &i, const std::size_t &) {
+		return simulateInput(inputIds[i], simulationDepth);
+	});
+}
+
+bool FrozenDFA::simulateInput(const std::vector<SymbolId> &inputIds, const int &simulationDepth) const {
+	const std::size_t columns = symbolColumns.size();
+
+	// Same step budget as the automaton: at most simulationDepth + 1 symbols are consumed
+	std::size_t steps =
+	    simulationDepth < 0 ? 0 : std::min(inputIds.size(), static_cast<std::size_t>(simulationDepth) + 1);
+
+	uint32_t currentState = startState;
+	for (std::size_t i = 0; i < steps; i++) {
+		auto columnIt = symbolColumns.find(inputIds[i]);
+		if (columnIt == symbolColumns.end()) {
+			return false;
+		}
+		currentState = transitions[currentState * columns + columnIt->second];
+		if (currentState == DEAD_STATE) {
+			return false;
+		}
+	}
+
+	return acceptStates[currentState];
+}
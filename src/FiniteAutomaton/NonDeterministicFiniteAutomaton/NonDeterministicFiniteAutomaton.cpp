@@ -1,4 +1,39 @@
 #include "AutomataSimulator/NonDeterministicFiniteAutomaton.h"
+#include "AutomataSimulator/BatchExecutor.h"
+#include <algorithm>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+std::size_t StateSetHash::operator()(const std::vector<uint64_t> &stateSet) const {
+	std::size_t hashValue = 0;
+	for (const auto &word : stateSet) {
+		hashValue = hashValue * 31 + std::hash<uint64_t>()(word);
+	}
+	return hashValue;
+}
+
+namespace {
+/**
+ * @brief Marks a lazy DFA successor or state that is not cached.
+ */
+constexpr uint32_t UNCACHED_LAZY_DFA_STATE = UINT32_MAX;
+
+int countTrailingZeros(const uint64_t &bits) {
+#ifdef _MSC_VER
+	unsigned long index;
+	_BitScanForward64(&index, bits);
+	return static_cast<int>(index);
+#else
+	return __builtin_ctzll(bits);
+#endif
+}
+} // namespace
+
+NonDeterministicFiniteAutomaton::NonDeterministicFiniteAutomaton()
+    : possibleCurrentStatesCacheInvalidated(false), compiledMaskWords(0), compiledVersion(0), lazyDFAEnabled(false),
+      lazyDFAMemoryBudget(0), lazyDFADeadState(UNCACHED_LAZY_DFA_STATE), lazyDFAVersion(0), lazyDFAFlushCount(0),
+      epsilonClosuresVersion(0) {}
 
 NonDeterministicFiniteAutomaton::~NonDeterministicFiniteAutomaton() = default;
 
@@ -54,37 +89,37 @@ void NonDeterministicFiniteAutomaton::addInput(const std::vector<std::string> &i
 
 void NonDeterministicFiniteAutomaton::updateStateLabel(const std::string &key, const std::string &label) {
 	FiniteAutomaton::updateStateLabel(key, label);
-	if (possibleCurrentStates.find(key) != possibleCurrentStates.end()) {
-		possibleCurrentStates.erase(key);
-		possibleCurrentStates.insert(label);
-		possibleCurrentStatesCacheInvalidated = true;
-	}
+	// Possible current states are held by id, only the label conversion cache goes stale
+	possibleCurrentStatesCacheInvalidated = true;
 }
 
 void NonDeterministicFiniteAutomaton::setCurrentState(const std::string &state) {
 	FiniteAutomaton::setCurrentState(state);
 	possibleCurrentStates.clear();
-	possibleCurrentStates.insert(state);
+	possibleCurrentStates.insert(currentState);
 	possibleCurrentStatesCacheInvalidated = true;
 }
 
 void NonDeterministicFiniteAutomaton::removeState(const std::string &key, const bool &strict) {
+	StateId id = getStateId(key);
 	FiniteAutomaton::removeState(key, strict);
 
-	if (possibleCurrentStates.find(key) != possibleCurrentStates.end()) {
-		possibleCurrentStates.erase(key);
-	}
+	possibleCurrentStates.erase(id);
 	possibleCurrentStatesCacheInvalidated = true;
 }
 
 void NonDeterministicFiniteAutomaton::removeStates(const std::vector<std::string> &keys, const bool &strict) {
-	FiniteAutomaton::removeStates(keys, strict);
-
+	std::vector<StateId> ids;
 	for (const auto &key : keys) {
-		if (possibleCurrentStates.find(key) != possibleCurrentStates.end()) {
-			possibleCurrentStates.erase(key);
+		if (stateExists(key)) {
+			ids.push_back(getStateId(key));
 		}
 	}
+	FiniteAutomaton::removeStates(keys, strict);
+
+	for (const auto &id : ids) {
+		possibleCurrentStates.erase(id);
+	}
 	possibleCurrentStatesCacheInvalidated = true;
 }
 
@@ -128,7 +163,7 @@ const std::vector<std::string> NonDeterministicFiniteAutomaton::getPossibleCurre
 	if (possibleCurrentStatesCacheInvalidated) {
 		cachedPossibleCurrentStates.clear();
 		for (const auto &state : possibleCurrentStates) {
-			cachedPossibleCurrentStates.push_back(state);
+			cachedPossibleCurrentStates.push_back(getStateLabel(state));
 		}
 		possibleCurrentStatesCacheInvalidated = false;
 	}
@@ -144,27 +179,33 @@ void NonDeterministicFiniteAutomaton::reset() {
 }
 
 const bool NonDeterministicFiniteAutomaton::processInput() {
-	if (currentState.empty()) {
+	if (currentState == INVALID_STATE_ID) {
 		throw InvalidAutomatonDefinitionException("Current state or start state must be set to run process input");
 	}
 
-	std::string inputSymbol = "";
+	SymbolId inputSymbol = SymbolTable::EPSILON_SYMBOL_ID;
 	if (inputHead < this->input.size()) {
 		inputSymbol = this->input[inputHead];
 	}
 
 	std::unordered_set<FATransition> possibleTransitions;
-	std::unordered_set<std::string> possibleCurrentStates;
-
-	const std::vector<FATransition> &transitions = getStateInternal(currentState)->getTransitions();
+	std::unordered_set<StateId> possibleCurrentStates;
 
-	for (const auto &transition : transitions) {
-		if (transition.getInput() != inputSymbol && !transition.getInput().empty()) {
-			continue;
-		}
+	const FAState *state = getStateInternal(currentState);
 
+	for (const auto &transition : state->getTransitionsOnInput(SymbolTable::EPSILON_SYMBOL_ID)) {
 		possibleTransitions.insert(transition);
-		possibleCurrentStates.insert(transition.getToStateKey());
+		possibleCurrentStates.insert(transition.getToStateId());
+	}
+
+	// The input symbol can be read from the current state or after following epsilon transitions from it
+	if (inputSymbol != SymbolTable::EPSILON_SYMBOL_ID) {
+		for (const auto &closureState : getEpsilonClosures()[currentState]) {
+			for (const auto &transition : states[closureState].getTransitionsOnInput(inputSymbol)) {
+				possibleTransitions.insert(transition);
+				possibleCurrentStates.insert(transition.getToStateId());
+			}
+		}
 	}
 
 	if (possibleTransitions.empty()) {
@@ -174,9 +215,9 @@ const bool NonDeterministicFiniteAutomaton::processInput() {
 	FATransition transitionChosen = decideRandomTransition(possibleTransitions);
 
 	// Update current state to the chosen transition
-	currentState = transitionChosen.getToStateKey();
+	currentState = transitionChosen.getToStateId();
 	// Only increment the head if the input is a match
-	const bool &incrementHead = transitionChosen.getInput() == inputSymbol && inputHead < this->input.size();
+	const bool &incrementHead = transitionChosen.getInputId() == inputSymbol && inputHead < this->input.size();
 	if (incrementHead) {
 		inputHead++;
 	}
@@ -188,30 +229,110 @@ const bool NonDeterministicFiniteAutomaton::processInput() {
 	return getStateInternal(currentState)->getIsAccept();
 }
 
+namespace {
 struct Visited {
-	std::string state;
+	StateId state;
 	int head;
 
 	bool operator==(const Visited &other) const {
 		return state == other.state && head == other.head;
 	}
 };
+} // namespace
 
 namespace std {
 template <> struct hash<Visited> {
 	size_t operator()(const Visited &v) const {
-		return hash<std::string>()(v.state) ^ (hash<int>()(v.head) << 1);
+		return hash<StateId>()(v.state) ^ (hash<int>()(v.head) << 1);
 	}
 };
 } // namespace std
 
 const bool NonDeterministicFiniteAutomaton::simulate(const std::vector<std::string> &input, const int &simulationDepth) {
-	if (startState.empty()) {
+	if (startState == INVALID_STATE_ID) {
 		throw InvalidStartStateException("Start state must be set to run simulate");
 	}
 
+	std::vector<SymbolId> inputIds = SymbolTable::find(input);
+
+	if (lazyDFAEnabled) {
+		return simulateLazyDFA(inputIds);
+	}
+
+	if (isCompiled()) {
+		return simulateCompiled(inputIds);
+	}
+
+	return simulateInterpreted(inputIds, simulationDepth);
+}
+
+const std::vector<bool>
+NonDeterministicFiniteAutomaton::simulateBatch(const std::vector<std::vector<std::string>> &inputs,
+                                               const int &simulationDepth) {
+	if (startState == INVALID_STATE_ID) {
+		throw InvalidStartStateException("Start state must be set to run simulate");
+	}
+
+	std::vector<std::vector<SymbolId>> inputIds = SymbolTable::find(inputs);
+	std::vector<bool> results(inputs.size());
+
+	if (lazyDFAEnabled) {
+		for (std::size_t i = 0; i < inputs.size(); i++) {
+			results[i] = simulateLazyDFA(inputIds[i]);
+		}
+	} else if (isCompiled()) {
+		for (std::size_t i = 0; i < inputs.size(); i++) {
+			results[i] = simulateCompiled(inputIds[i]);
+		}
+	} else {
+		for (std::size_t i = 0; i < inputs.size(); i++) {
+			results[i] = simulateInterpreted(inputIds[i], simulationDepth);
+		}
+	}
+	return results;
+}
+
+const std::vector<bool>
+NonDeterministicFiniteAutomaton::simulateBatchParallel(const std::vector<std::vector<std::string>> &inputs,
+                                                       const std::size_t &threadCount, const int &simulationDepth) {
+	if (startState == INVALID_STATE_ID) {
+		throw InvalidStartStateException("Start state must be set to run simulate");
+	}
+
+	prepareConcurrentSimulation();
+	std::vector<std::vector<SymbolId>> inputIds = SymbolTable::find(inputs);
+
+	if (lazyDFAEnabled || isCompiled()) {
+		struct StateSetBuffers {
+			std::vector<uint64_t> active;
+			std::vector<uint64_t> next;
+		};
+		std::vector<StateSetBuffers> buffers(BatchExecutor::resolveThreadCount(threadCount, inputs.size()));
+
+		return BatchExecutor::runPredicate(
+		    inputs.size(), threadCount, [&](const std::size_t &i, const std::size_t &worker) {
+			    return simulateCompiled(inputIds[i], buffers[worker].active, buffers[worker].next);
+		    });
+	}
+	return BatchExecutor::runPredicate(inputs.size(), threadCount, [&](const std::size_t &i, const std::size_t &) {
+		return simulateInterpreted(inputIds[i], simulationDepth);
+	});
+}
+
+void NonDeterministicFiniteAutomaton::buildSimulationCaches() {
+	FiniteAutomaton::buildSimulationCaches();
+	getEpsilonClosures();
+	if (lazyDFAEnabled && !isCompiled()) {
+		compile();
+	}
+}
+
+const bool NonDeterministicFiniteAutomaton::simulateInterpreted(const std::vector<SymbolId> &inputIds,
+                                                                const int &simulationDepth) {
+	const std::vector<std::vector<StateId>> &closures = getEpsilonClosures();
+
 	struct Branch {
-		std::string state;
+		StateId state;
 		int head;
 		int depth;
 	};
@@ -225,38 +346,467 @@ const bool NonDeterministicFiniteAutomaton::simulate(const std::vector<std::stri
 		Branch branch = branches.front();
 		branches.pop();
 
-		visited.insert({branch.state, branch.head});
+		SymbolId currentInput = SymbolTable::EPSILON_SYMBOL_ID;
+		if (branch.head < inputIds.size()) {
+			currentInput = inputIds[branch.head];
+		}
+
+		// Epsilon transitions are folded into the closure, only reading a symbol moves the branch forward
+		for (const auto &closureState : closures[branch.state]) {
+			if (!visited.insert({closureState, branch.head}).second) {
+				continue;
+			}
+
+			if (branch.head == inputIds.size() && states[closureState].getIsAccept()) {
+				return true;
+			}
 
-		if (branch.head == input.size() && getStateInternal(branch.state)->getIsAccept()) {
-			return true;
+			if (branch.depth >= simulationDepth || branch.head >= inputIds.size()) {
+				continue;
+			}
+
+			for (const auto &transition : states[closureState].getTransitionsOnInput(currentInput)) {
+				if (visited.find({transition.getToStateId(), branch.head + 1}) != visited.end()) {
+					continue;
+				}
+
+				branches.push({transition.getToStateId(), branch.head + 1, branch.depth + 1});
+			}
 		}
+	}
 
-		if (branch.depth >= simulationDepth) {
-			continue;
+	return false;
+}
+
+const std::vector<std::vector<StateId>> &NonDeterministicFiniteAutomaton::getEpsilonClosures() {
+	if (epsilonClosuresVersion == definitionVersion && epsilonClosures.size() == states.size()) {
+		return epsilonClosures;
+	}
+
+	std::vector<std::vector<StateId>> epsilonSuccessors(states.size());
+	for (StateId id = 0; id < states.size(); id++) {
+		for (const auto &transition : states[id].getTransitionsOnInput(SymbolTable::EPSILON_SYMBOL_ID)) {
+			epsilonSuccessors[id].push_back(transition.getToStateId());
 		}
+	}
 
-		std::string currentInput = "";
-		if (branch.head < input.size()) {
-			currentInput = input[branch.head];
+	// Tarjan's algorithm finishes the strongly connected components in reverse topological order, so when a component
+	// finishes, the closures of all the components its epsilon transitions lead to are already complete
+	constexpr uint32_t UNVISITED = UINT32_MAX;
+	std::vector<uint32_t> order(states.size(), UNVISITED);
+	std::vector<uint32_t> lowLink(states.size());
+	std::vector<uint32_t> component(states.size(), UNVISITED);
+	std::vector<StateId> componentRoots;
+	// Marks the component each state was last added to a closure for, so the marks never need clearing
+	std::vector<uint32_t> addedTo(states.size(), UNVISITED);
+	std::vector<StateId> componentStack;
+	std::vector<std::pair<StateId, std::size_t>> callStack;
+	uint32_t nextOrder = 0;
+
+	epsilonClosures.assign(states.size(), {});
+	for (StateId root = 0; root < states.size(); root++) {
+		if (order[root] != UNVISITED) {
+			continue;
 		}
 
-		const std::vector<FATransition> &transitions = getStateInternal(branch.state)->getTransitions();
+		order[root] = lowLink[root] = nextOrder++;
+		componentStack.push_back(root);
+		callStack.push_back({root, 0});
+		while (!callStack.empty()) {
+			auto &[state, edge] = callStack.back();
+			if (edge < epsilonSuccessors[state].size()) {
+				StateId next = epsilonSuccessors[state][edge++];
+				if (order[next] == UNVISITED) {
+					order[next] = lowLink[next] = nextOrder++;
+					componentStack.push_back(next);
+					callStack.push_back({next, 0});
+				} else if (component[next] == UNVISITED) {
+					lowLink[state] = std::min(lowLink[state], order[next]);
+				}
+				continue;
+			}
 
-		for (const auto &transition : transitions) {
-			if (!transition.getInput().empty() && transition.getInput() != currentInput) {
+			StateId finished = state;
+			callStack.pop_back();
+			if (!callStack.empty()) {
+				StateId parent = callStack.back().first;
+				lowLink[parent] = std::min(lowLink[parent], lowLink[finished]);
+			}
+			if (lowLink[finished] != order[finished]) {
 				continue;
 			}
-			// Only increment the head if the input is a match and the input head is less than the input size
-			const bool &incrementHead = transition.getInput() == currentInput && branch.head < input.size();
-			const int &newHead = incrementHead ? branch.head + 1 : branch.head;
 
-			if (visited.find({transition.getToStateKey(), newHead}) != visited.end()) {
+			const uint32_t current = static_cast<uint32_t>(componentRoots.size());
+			componentRoots.push_back(finished);
+			std::vector<StateId> &closure = epsilonClosures[finished];
+			StateId member;
+			do {
+				member = componentStack.back();
+				componentStack.pop_back();
+				component[member] = current;
+				addedTo[member] = current;
+				closure.push_back(member);
+			} while (member != finished);
+
+			const std::size_t memberCount = closure.size();
+			for (std::size_t i = 0; i < memberCount; i++) {
+				for (const auto &next : epsilonSuccessors[closure[i]]) {
+					if (component[next] == current) {
+						continue;
+					}
+					for (const auto &reached : epsilonClosures[componentRoots[component[next]]]) {
+						if (addedTo[reached] != current) {
+							addedTo[reached] = current;
+							closure.push_back(reached);
+						}
+					}
+				}
+			}
+
+			for (std::size_t i = 0; i < memberCount; i++) {
+				if (closure[i] != finished) {
+					epsilonClosures[closure[i]] = closure;
+				}
+			}
+		}
+	}
+
+	epsilonClosuresVersion = definitionVersion;
+	return epsilonClosures;
+}
+
+void NonDeterministicFiniteAutomaton::compile() {
+	if (startState == INVALID_STATE_ID) {
+		throw InvalidStartStateException("Start state must be set to compile");
+	}
+
+	const std::size_t words = (states.size() + 63) / 64;
+	const std::vector<std::vector<StateId>> &closures = getEpsilonClosures();
+
+	// Assign a column to every symbol a transition reads, epsilon included
+	compiledSymbolColumns.clear();
+	for (auto &state : states) {
+		for (const auto &transition : state.getTransitionsView()) {
+			compiledSymbolColumns.emplace(transition.getInputId(),
+			                              static_cast<uint32_t>(compiledSymbolColumns.size()));
+		}
+	}
+	const std::size_t columns = compiledSymbolColumns.size();
+
+	// Identical masks are stored once, mask 0 is the empty set
+	std::unordered_map<std::vector<uint64_t>, uint32_t, StateSetHash> maskIndex;
+	compiledMasks.assign(words, 0);
+	maskIndex.emplace(std::vector<uint64_t>(words, 0), 0);
+
+	compiledSuccessors.assign(states.size() * columns, 0);
+	std::unordered_map<uint32_t, std::vector<uint64_t>> stateMasks;
+	for (StateId id = 0; id < states.size(); id++) {
+		stateMasks.clear();
+		for (const auto &transition : states[id].getTransitionsView()) {
+			uint32_t column = compiledSymbolColumns[transition.getInputId()];
+			std::vector<uint64_t> &mask = stateMasks[column];
+			mask.resize(words, 0);
+			for (const auto &closureState : closures[transition.getToStateId()]) {
+				mask[closureState / 64] |= uint64_t(1) << (closureState % 64);
+			}
+		}
+
+		for (const auto &[column, mask] : stateMasks) {
+			auto it = maskIndex.find(mask);
+			if (it == maskIndex.end()) {
+				it = maskIndex.emplace(mask, static_cast<uint32_t>(compiledMasks.size() / words)).first;
+				compiledMasks.insert(compiledMasks.end(), mask.begin(), mask.end());
+			}
+			compiledSuccessors[id * columns + column] = it->second;
+		}
+	}
+
+	compiledStartMask.assign(words, 0);
+	for (const auto &closureState : closures[startState]) {
+		compiledStartMask[closureState / 64] |= uint64_t(1) << (closureState % 64);
+	}
+
+	// Free state slots are never accepting, so they stay out of the accept mask
+	compiledAcceptMask.assign(words, 0);
+	for (StateId id = 0; id < states.size(); id++) {
+		if (states[id].getIsAccept()) {
+			compiledAcceptMask[id / 64] |= uint64_t(1) << (id % 64);
+		}
+	}
+
+	compiledMaskWords = words;
+	compiledVersion = definitionVersion;
+}
+
+const bool NonDeterministicFiniteAutomaton::isCompiled() const {
+	return compiledMaskWords != 0 && compiledVersion == definitionVersion;
+}
+
+void NonDeterministicFiniteAutomaton::stepCompiled(const uint64_t *active, const uint32_t &column,
+                                                   std::vector<uint64_t> &next) const {
+	const std::size_t words = compiledMaskWords;
+	const std::size_t columns = compiledSymbolColumns.size();
+
+	// The successor masks are already epsilon-closed, so one pass over the active states is a full step
+	std::fill(next.begin(), next.end(), 0);
+	for (std::size_t word = 0; word < words; word++) {
+		uint64_t bits = active[word];
+		while (bits != 0) {
+			StateId state = static_cast<StateId>(word * 64 + countTrailingZeros(bits));
+			bits &= bits - 1;
+
+			uint32_t maskIndex = compiledSuccessors[state * columns + column];
+			if (maskIndex == 0) {
 				continue;
 			}
+			const uint64_t *mask = &compiledMasks[maskIndex * words];
+			for (std::size_t i = 0; i < words; i++) {
+				next[i] |= mask[i];
+			}
+		}
+	}
+}
 
-			branches.push({transition.getToStateKey(), newHead, branch.depth + 1});
+const bool NonDeterministicFiniteAutomaton::simulateCompiled(const std::vector<SymbolId> &inputIds) const {
+	std::vector<uint64_t> active;
+	std::vector<uint64_t> next;
+	return simulateCompiled(inputIds, active, next);
+}
+
+const bool NonDeterministicFiniteAutomaton::simulateCompiled(const std::vector<SymbolId> &inputIds,
+                                                             std::vector<uint64_t> &active,
+                                                             std::vector<uint64_t> &next) const {
+	const std::size_t words = compiledMaskWords;
+
+	active.assign(compiledStartMask.begin(), compiledStartMask.end());
+	next.resize(words);
+
+	for (const auto &symbol : inputIds) {
+		auto columnIt = compiledSymbolColumns.find(symbol);
+		if (columnIt == compiledSymbolColumns.end()) {
+			return false;
+		}
+
+		stepCompiled(active.data(), columnIt->second, next);
+		active.swap(next);
+
+		if (std::all_of(active.begin(), active.end(), [](const uint64_t &bits) { return bits == 0; })) {
+			return false;
 		}
 	}
 
+	for (std::size_t word = 0; word < words; word++) {
+		if ((active[word] & compiledAcceptMask[word]) != 0) {
+			return true;
+		}
+	}
 	return false;
-}
\ No newline at end of file
+}
+
+void NonDeterministicFiniteAutomaton::enableLazyDFA(const std::size_t &memoryBudget) {
+	lazyDFAEnabled = true;
+	lazyDFAMemoryBudget = memoryBudget;
+	lazyDFAFlushCount = 0;
+	clearLazyDFA();
+}
+
+void NonDeterministicFiniteAutomaton::disableLazyDFA() {
+	lazyDFAEnabled = false;
+	clearLazyDFA();
+	lazyDFAStateSets.shrink_to_fit();
+	lazyDFATransitions.shrink_to_fit();
+	lazyDFAAccepting.shrink_to_fit();
+}
+
+const bool NonDeterministicFiniteAutomaton::isLazyDFAEnabled() const {
+	return lazyDFAEnabled;
+}
+
+const std::size_t NonDeterministicFiniteAutomaton::getLazyDFAStateCount() const {
+	return lazyDFAAccepting.size();
+}
+
+const std::size_t NonDeterministicFiniteAutomaton::getLazyDFAFlushCount() const {
+	return lazyDFAFlushCount;
+}
+
+void NonDeterministicFiniteAutomaton::clearLazyDFA() {
+	lazyDFAStateSets.clear();
+	lazyDFAStateIndex.clear();
+	lazyDFATransitions.clear();
+	lazyDFAAccepting.clear();
+	lazyDFADeadState = UNCACHED_LAZY_DFA_STATE;
+}
+
+uint32_t NonDeterministicFiniteAutomaton::addLazyDFAState(const std::vector<uint64_t> &stateSet) {
+	auto it = lazyDFAStateIndex.find(stateSet);
+	if (it != lazyDFAStateIndex.end()) {
+		return it->second;
+	}
+
+	uint32_t lazyState = static_cast<uint32_t>(lazyDFAAccepting.size());
+	lazyDFAStateIndex.emplace(stateSet, lazyState);
+	lazyDFAStateSets.insert(lazyDFAStateSets.end(), stateSet.begin(), stateSet.end());
+	lazyDFATransitions.resize(lazyDFATransitions.size() + compiledSymbolColumns.size(), UNCACHED_LAZY_DFA_STATE);
+
+	bool accepting = false;
+	bool empty = true;
+	for (std::size_t word = 0; word < compiledMaskWords; word++) {
+		accepting = accepting || (stateSet[word] & compiledAcceptMask[word]) != 0;
+		empty = empty && stateSet[word] == 0;
+	}
+	lazyDFAAccepting.push_back(accepting);
+	if (empty) {
+		lazyDFADeadState = lazyState;
+	}
+	return lazyState;
+}
+
+const bool NonDeterministicFiniteAutomaton::simulateLazyDFA(const std::vector<SymbolId> &inputIds) {
+	if (!isCompiled()) {
+		compile();
+	}
+	const std::size_t words = compiledMaskWords;
+	const std::size_t columns = compiledSymbolColumns.size();
+
+	// The start state is always cached first, so it is DFA state 0
+	if (lazyDFAVersion != definitionVersion || lazyDFAAccepting.empty()) {
+		clearLazyDFA();
+		addLazyDFAState(compiledStartMask);
+		lazyDFAVersion = definitionVersion;
+	}
+
+	// Approximate cost of one cached state: its set in the pool and the index key, its successor row and the index
+	// node overhead
+	const std::size_t stateBytes = 2 * words * sizeof(uint64_t) + columns * sizeof(uint32_t) + 64;
+
+	std::vector<uint64_t> next(words);
+	uint32_t current = 0;
+
+	for (const auto &symbol : inputIds) {
+		auto columnIt = compiledSymbolColumns.find(symbol);
+		if (columnIt == compiledSymbolColumns.end()) {
+			return false;
+		}
+
+		uint32_t target = lazyDFATransitions[current * columns + columnIt->second];
+		if (target == UNCACHED_LAZY_DFA_STATE) {
+			stepCompiled(&lazyDFAStateSets[current * words], columnIt->second, next);
+
+			auto it = lazyDFAStateIndex.find(next);
+			if (it != lazyDFAStateIndex.end()) {
+				target = it->second;
+			} else {
+				if ((lazyDFAAccepting.size() + 1) * stateBytes > lazyDFAMemoryBudget && lazyDFAAccepting.size() > 2) {
+					// Flush the cache and keep going from the start and current states only
+					std::vector<uint64_t> currentSet(lazyDFAStateSets.begin() + current * words,
+					                                 lazyDFAStateSets.begin() + (current + 1) * words);
+					clearLazyDFA();
+					lazyDFAFlushCount++;
+					addLazyDFAState(compiledStartMask);
+					current = addLazyDFAState(currentSet);
+				}
+				target = addLazyDFAState(next);
+			}
+			lazyDFATransitions[current * columns + columnIt->second] = target;
+		}
+
+		current = target;
+		if (current == lazyDFADeadState) {
+			return false;
+		}
+	}
+
+	return lazyDFAAccepting[current];
+}
+
+DeterministicFiniteAutomaton NonDeterministicFiniteAutomaton::toDFA(const std::size_t &maxStates) {
+	if (startState == INVALID_STATE_ID) {
+		throw InvalidStartStateException("Start state must be set to convert to a DFA");
+	}
+
+	const std::size_t words = (states.size() + 63) / 64;
+	const std::vector<std::vector<StateId>> &closures = getEpsilonClosures();
+
+	// Epsilon is not a DFA symbol, it is folded into the closures
+	std::vector<SymbolId> symbols;
+	for (const auto &symbol : inputAlphabet) {
+		if (symbol != SymbolTable::EPSILON_SYMBOL_ID) {
+			symbols.push_back(symbol);
+		}
+	}
+	std::sort(symbols.begin(), symbols.end());
+
+	DeterministicFiniteAutomaton dfa;
+	dfa.setInputAlphabet(SymbolTable::getSymbols(symbols));
+
+	// Each discovered set of NFA states becomes one DFA state, deduplicated by its mask
+	std::vector<std::vector<uint64_t>> stateSets;
+	std::vector<std::string> stateLabels;
+	std::unordered_map<std::vector<uint64_t>, std::size_t, StateSetHash> stateSetIndex;
+
+	auto addStateSet = [&](const std::vector<uint64_t> &stateSet) -> std::size_t {
+		auto it = stateSetIndex.find(stateSet);
+		if (it != stateSetIndex.end()) {
+			return it->second;
+		}
+		if (stateSets.size() >= maxStates) {
+			throw InvalidAutomatonDefinitionException("Converting to a DFA needs more than " +
+			                                          std::to_string(maxStates) + " states");
+		}
+
+		std::string label = "{";
+		bool accepting = false;
+		for (StateId id = 0; id < states.size(); id++) {
+			if ((stateSet[id / 64] >> (id % 64) & 1) == 0) {
+				continue;
+			}
+			label += (label.size() > 1 ? "," : "") + states[id].getLabel();
+			accepting = accepting || states[id].getIsAccept();
+		}
+		label += "}";
+		// State labels may themselves contain braces or commas, keep the generated labels unique
+		while (dfa.stateExists(label)) {
+			label += "'";
+		}
+
+		dfa.addState(label, accepting);
+		stateSetIndex.emplace(stateSet, stateSets.size());
+		stateSets.push_back(stateSet);
+		stateLabels.push_back(label);
+		return stateSets.size() - 1;
+	};
+
+	std::vector<uint64_t> startSet(words, 0);
+	for (const auto &closureState : closures[startState]) {
+		startSet[closureState / 64] |= uint64_t(1) << (closureState % 64);
+	}
+	dfa.setStartState(stateLabels[addStateSet(startSet)]);
+
+	std::vector<uint64_t> nextSet(words);
+	for (std::size_t current = 0; current < stateSets.size(); current++) {
+		for (const auto &symbol : symbols) {
+			std::fill(nextSet.begin(), nextSet.end(), 0);
+			bool empty = true;
+			for (StateId id = 0; id < states.size(); id++) {
+				if ((stateSets[current][id / 64] >> (id % 64) & 1) == 0) {
+					continue;
+				}
+				for (const auto &transition : states[id].getTransitionsOnInput(symbol)) {
+					for (const auto &closureState : closures[transition.getToStateId()]) {
+						nextSet[closureState / 64] |= uint64_t(1) << (closureState % 64);
+					}
+					empty = false;
+				}
+			}
+			if (empty) {
+				continue;
+			}
+
+			std::size_t next = addStateSet(nextSet);
+			dfa.addTransition(stateLabels[current], stateLabels[next], SymbolTable::getSymbol(symbol));
+		}
+	}
+
+	return dfa;
+}
@@ -1,4 +1,6 @@
 #include "AutomataSimulator/DeterministicPushdownAutomaton.h"
+#include "AutomataSimulator/BatchExecutor.h"
+#include <unordered_map>
 
 DeterministicPushdownAutomaton::~DeterministicPushdownAutomaton() = default;
 
@@ -7,25 +9,20 @@ bool DeterministicPushdownAutomaton::checkTransitionDeterminisim(const std::stri
                                                                  const std::string &stackSymbol) {
 
 	PDAState *fromState = getStateInternal(fromStateKey);
+	SymbolId inputId = SymbolTable::find(input);
+	SymbolId stackSymbolId = SymbolTable::find(stackSymbol);
 
-	// Check if there's already a transition with the same input/stack symbol
-	for (auto &transition : fromState->getTransitions()) {
-		// Conflicting transitions needs to have same stack symbol
-		if (transition.getStackSymbol() != stackSymbol) {
-			continue;
-		}
-		// For a DPDA, we can't have multiple transitions with:
-		// 1. Same input symbol (or both epsilon)
-		if (transition.getInput() == input) {
-			return false;
-		}
+	// Conflicting transitions needs to have same stack symbol, for a DPDA we can't have multiple transitions with:
+	// 1. Same input symbol (or both epsilon)
+	if (!fromState->getTransitionsOn(inputId, stackSymbolId).empty()) {
+		return false;
+	}
 
-		// 2. Both a non-empty input and an epsilon transition
-		if ((transition.getInput().empty() && !input.empty()) || (!transition.getInput().empty() && input.empty())) {
-			return false;
-		}
+	// 2. Both a non-empty input and an epsilon transition
+	if (inputId == SymbolTable::EPSILON_SYMBOL_ID) {
+		return !fromState->hasInputTransitionOnStack(stackSymbolId);
 	}
-	return true;
+	return fromState->getTransitionsOn(SymbolTable::EPSILON_SYMBOL_ID, stackSymbolId).empty();
 }
 
 void DeterministicPushdownAutomaton::addTransition(const std::string &fromStateKey, const std::string &toStateKey,
@@ -104,33 +101,28 @@ bool DeterministicPushdownAutomaton::processInput() {
 		throw InvalidAutomatonDefinitionException("Current state or start state must be set to run process input");
 	}
 
-	std::string inputSymbol = "";
+	SymbolId inputSymbol = SymbolTable::EPSILON_SYMBOL_ID;
 	if (inputHead < this->input.size()) {
 		inputSymbol = this->input[inputHead];
 	}
 
-	const std::vector<PDATransition> &transitions = getStateInternal(currentState)->getTransitions();
-	const std::string &stackTop = stack.empty() ? "" : stack.top();
+	const SymbolId stackTop = stack.empty() ? SymbolTable::EPSILON_SYMBOL_ID : stack.top();
 
-	for (const auto &transition : transitions) {
-		// Stack symbols have to match
-		if (transition.getStackSymbol() != stackTop && !transition.getStackSymbol().empty()) {
+	// Take the most specific transition matching the input and the top of the stack
+	for (const auto *transitions : getStateInternal(currentState)->getCandidateTransitions(inputSymbol, stackTop)) {
+		if (transitions->empty()) {
 			continue;
 		}
-		// Inputs have to match
-		if (transition.getInput() != inputSymbol && !transition.getInput().empty()) {
-			continue;
-		}
-		if (!transition.getStackSymbol().empty()) {
+		const PDATransition &transition = transitions->front();
+		if (transition.getStackSymbolId() != SymbolTable::EPSILON_SYMBOL_ID) {
 			stack.pop();
 		}
-		std::vector<std::string> pushSymbolsVec = parsePushSymbols(transition.getPushSymbol());
-		for (const auto &symbol : pushSymbolsVec) {
+		for (const auto &symbol : transition.getPushSymbolIds()) {
 			stack.push(symbol);
 		}
 		currentState = transition.getToStateKey();
 		// Only increment the head if the input is a match and the input head is less than the input size
-		const bool &incrementHead = transition.getInput() == inputSymbol && inputHead < this->input.size();
+		const bool &incrementHead = transition.getInputId() == inputSymbol && inputHead < this->input.size();
 		if (incrementHead) {
 			inputHead++;
 		}
@@ -145,53 +137,165 @@ bool DeterministicPushdownAutomaton::simulate(const std::vector<std::string> &in
 		throw InvalidStartStateException("Start state must be set to run simulate");
 	}
 
+	return simulateInput(SymbolTable::find(input), simulationDepth, SymbolTable::intern(INITIAL_STACK_SYMBOL));
+}
+
+std::vector<bool> DeterministicPushdownAutomaton::simulateBatch(const std::vector<std::vector<std::string>> &inputs,
+                                                                const int &simulationDepth) {
+	if (startState.empty()) {
+		throw InvalidStartStateException("Start state must be set to run simulate");
+	}
+
+	const SymbolId initialStackSymbol = SymbolTable::intern(INITIAL_STACK_SYMBOL);
+	std::vector<std::vector<SymbolId>> inputIds = SymbolTable::find(inputs);
+	std::vector<bool> results(inputs.size());
+	for (std::size_t i = 0; i < inputs.size(); i++) {
+		results[i] = simulateInput(inputIds[i], simulationDepth, initialStackSymbol);
+	}
+	return results;
+}
+
+std::vector<bool>
+DeterministicPushdownAutomaton::simulateBatchParallel(const std::vector<std::vector<std::string>> &inputs,
+                                                      const std::size_t &threadCount, const int &simulationDepth) {
+	if (startState.empty()) {
+		throw InvalidStartStateException("Start state must be set to run simulate");
+	}
+
+	prepareConcurrentSimulation();
+	const SymbolId initialStackSymbol = SymbolTable::intern(INITIAL_STACK_SYMBOL);
+	std::vector<std::vector<SymbolId>> inputIds = SymbolTable::find(inputs);
+
+	return BatchExecutor::runPredicate(inputs.size(), threadCount, [&](const std::size_t &i, const std::size_t &) {
+		return simulateInput(inputIds[i], simulationDepth, initialStackSymbol);
+	});
+}
+
+bool DeterministicPushdownAutomaton::simulateInput(const std::vector<SymbolId> &inputIds, const int &simulationDepth,
+                                                   const SymbolId &initialStackSymbol) {
 	int inputIdx = 0;
 	int currentDepth = 0;
-	std::string simulationCurrentState = getStartState();
-	std::stack<std::string> simulationStack;
-	simulationStack.push(INITIAL_STACK_SYMBOL);
+	std::string simulationCurrentState = startState;
+	std::stack<SymbolId> simulationStack;
+	simulationStack.push(initialStackSymbol);
 
 	while (currentDepth <= simulationDepth) {
-		const std::vector<PDATransition> &transitions = getStateInternal(simulationCurrentState)->getTransitions();
-
-		std::string currentInput = "";
-		if (inputIdx < input.size()) {
-			currentInput = input[inputIdx];
+		SymbolId currentInput = SymbolTable::EPSILON_SYMBOL_ID;
+		if (inputIdx < inputIds.size()) {
+			currentInput = inputIds[inputIdx];
 		}
 
-		std::string stackTop = simulationStack.empty() ? "" : simulationStack.top();
+		SymbolId stackTop = simulationStack.empty() ? SymbolTable::EPSILON_SYMBOL_ID : simulationStack.top();
 
 		bool transitionFound = false;
-		for (const auto &transition : transitions) {
-			// Stack symbols have to match
-			if (transition.getStackSymbol() != stackTop && !transition.getStackSymbol().empty()) {
+		for (const auto *transitions :
+		     getStateInternal(simulationCurrentState)->getCandidateTransitions(currentInput, stackTop)) {
+			if (transitions->empty()) {
 				continue;
 			}
-			// Inputs have to match
-			if (transition.getInput() != currentInput && !transition.getInput().empty()) {
-				continue;
-			}
-			if (!transition.getStackSymbol().empty()) {
+			const PDATransition &transition = transitions->front();
+			if (transition.getStackSymbolId() != SymbolTable::EPSILON_SYMBOL_ID) {
 				simulationStack.pop();
 			}
-			std::vector<std::string> pushSymbolsVec = parsePushSymbols(transition.getPushSymbol());
-			for (const auto &symbol : pushSymbolsVec) {
+			for (const auto &symbol : transition.getPushSymbolIds()) {
 				simulationStack.push(symbol);
 			}
 			simulationCurrentState = transition.getToStateKey();
 			// Only increment the head if the input is a match and the input head is less than the input size
-			const bool &incrementHead = transition.getInput() == currentInput && inputIdx < input.size();
+			const bool &incrementHead = transition.getInputId() == currentInput && inputIdx < inputIds.size();
 			if (incrementHead) {
 				inputIdx++;
 			}
 			transitionFound = true;
 			break;
 		}
-		if (!transitionFound && !currentInput.empty()) {
+		if (!transitionFound && currentInput != SymbolTable::EPSILON_SYMBOL_ID) {
 			return false;
 		}
 		currentDepth++;
 	}
 
 	return getStateInternal(simulationCurrentState)->getIsAccept();
-}
\ No newline at end of file
+}
+SimulationResult DeterministicPushdownAutomaton::simulateWithCycleDetection(const std::vector<std::string> &input,
+                                                                            const int &simulationDepth) {
+	if (startState.empty()) {
+		throw InvalidStartStateException("Start state must be set to run simulate");
+	}
+
+	const std::vector<SymbolId> inputIds = SymbolTable::find(input);
+	std::size_t inputIdx = 0;
+	std::string simulationCurrentState = startState;
+	std::vector<SymbolId> simulationStack = {SymbolTable::intern(INITIAL_STACK_SYMBOL)};
+
+	// Number the states once, so records key on a state number rather than interning the label on every step
+	std::unordered_map<std::string, uint32_t> stateNumbers;
+	stateNumbers.reserve(states.size());
+	for (const auto &pair : states) {
+		stateNumbers.emplace(pair.first, static_cast<uint32_t>(stateNumbers.size()));
+	}
+
+	// Epsilon moves made since the last input symbol was read, keyed by state and stack top. A record stays valid while
+	// no move leaves the stack lower than it was when the record was made, so records are kept by that height.
+	std::unordered_map<uint64_t, int> recordCounts;
+	std::vector<std::vector<uint64_t>> recordsByHeight(1);
+
+	auto dropRecordsAbove = [&](const std::size_t &height) {
+		while (recordsByHeight.size() > height + 1) {
+			for (const auto &key : recordsByHeight.back()) {
+				recordCounts[key]--;
+			}
+			recordsByHeight.pop_back();
+		}
+	};
+
+	for (int currentDepth = 0;; currentDepth++) {
+		const SymbolId currentInput =
+		    inputIdx < inputIds.size() ? inputIds[inputIdx] : SymbolTable::EPSILON_SYMBOL_ID;
+		const SymbolId stackTop = simulationStack.empty() ? SymbolTable::EPSILON_SYMBOL_ID : simulationStack.back();
+
+		const PDATransition *transition = nullptr;
+		for (const auto *transitions :
+		     getStateInternal(simulationCurrentState)->getCandidateTransitions(currentInput, stackTop)) {
+			if (!transitions->empty()) {
+				transition = &transitions->front();
+				break;
+			}
+		}
+		if (transition == nullptr) {
+			if (currentInput != SymbolTable::EPSILON_SYMBOL_ID) {
+				return SimulationResult::REJECTED;
+			}
+			return getStateInternal(simulationCurrentState)->getIsAccept() ? SimulationResult::ACCEPTED
+			                                                                : SimulationResult::REJECTED;
+		}
+
+		// The configuration reached with the last transition of the budget is still checked, but not left
+		if (currentDepth > simulationDepth) {
+			return SimulationResult::OUT_OF_BUDGET;
+		}
+
+		if (transition->getInputId() == currentInput && inputIdx < inputIds.size()) {
+			inputIdx++;
+			recordCounts.clear();
+			recordsByHeight.assign(1, {});
+		} else {
+			const uint64_t key = (static_cast<uint64_t>(stateNumbers.at(simulationCurrentState)) << 32) | stackTop;
+			if (recordCounts[key] > 0) {
+				return SimulationResult::DIVERGES;
+			}
+			recordCounts[key]++;
+			recordsByHeight.resize(simulationStack.size() + 1);
+			recordsByHeight[simulationStack.size()].push_back(key);
+		}
+
+		if (transition->getStackSymbolId() != SymbolTable::EPSILON_SYMBOL_ID) {
+			simulationStack.pop_back();
+		}
+		for (const auto &symbol : transition->getPushSymbolIds()) {
+			simulationStack.push_back(symbol);
+		}
+		dropRecordsAbove(simulationStack.size());
+		simulationCurrentState = transition->getToStateKey();
+	}
+}
@@ -0,0 +1,277 @@
+#include "AutomataSimulator/FrozenNPDA.h"
+#include "AutomataSimulator/BatchExecutor.h"
+#include <unordered_map>
+#include <utility>
+
+bool FrozenNPDA::Branch::operator==(const Branch &other) const {
+	return state == other.state && head == other.head && stack == other.stack;
+}
+
+std::size_t FrozenNPDA::BranchHash::operator()(const Branch &branch) const {
+	return std::hash<uint32_t>()(branch.state) ^ (std::hash<std::size_t>()(branch.head) << 1) ^
+	       (std::hash<StackPool::StackId>()(branch.stack) << 2);
+}
+
+FrozenNPDA::FrozenNPDA() : startState(0), initialStackSymbol(SymbolTable::EPSILON_SYMBOL_ID) {}
+
+std::string FrozenNPDA::getStartState() const {
+	return stateLabels[startState];
+}
+
+std::size_t FrozenNPDA::getStateCount() const {
+	return stateLabels.size();
+}
+
+bool FrozenNPDA::simulate(const std::vector<std::string> &input, const int &simulationDepth) const {
+	Context context;
+	return simulateInput(SymbolTable::find(input), context, simulationDepth);
+}
+
+bool FrozenNPDA::simulate(const std::vector<std::string> &input, Context &context, const int &simulationDepth) const {
+	return simulateInput(SymbolTable::find(input), context, simulationDepth);
+}
+
+std::vector<bool> FrozenNPDA::simulateBatch(const std::vector<std::vector<std::string>> &inputs,
+                                            const int &simulationDepth) const {
+	std::vector<std::vector<SymbolId>> inputIds = SymbolTable::find(inputs);
+	Context context;
+	std::vector<bool> results(inputs.size());
+	for (std::size_t i = 0; i < inputs.size(); i++) {
+		results[i] = simulateInput(inputIds[i], context, simulationDepth);
+	}
+	return results;
+}
+
+std::vector<bool> FrozenNPDA::simulateBatchParallel(const std::vector<std::vector<std::string>> &inputs,
+                                                    const std::size_t &threadCount, const int &simulationDepth) const {
+	std::vector<std::vector<SymbolId>> inputIds = SymbolTable::find(inputs);
+	std::vector<Context> contexts(BatchExecutor::resolveThreadCount(threadCount, inputs.size()));
+
+	return BatchExecutor::runPredicate(
+	    inputs.size(), threadCount, [&](const std::size_t &i, const std::size_t &worker) {
+		    return simulateInput(inputIds[i], contexts[worker], simulationDepth);
+	    });
+}
+
+bool FrozenNPDA::simulateInput(const std::vector<SymbolId> &inputIds, Context &context,
+                               const int &simulationDepth) const {
+	context.branches.clear();
+	context.visited.clear();
+	context.stacks.clear();
+	context.branches.push_back({startState, context.stacks.push(StackPool::EMPTY_STACK, initialStackSymbol), 0, 0});
+
+	while (!context.branches.empty()) {
+		Branch branch = std::move(context.branches.front());
+		context.branches.pop_front();
+
+		SymbolId currentInput = SymbolTable::EPSILON_SYMBOL_ID;
+		if (branch.head < inputIds.size()) {
+			currentInput = inputIds[branch.head];
+		}
+
+		const SymbolId stackTop = context.stacks.top(branch.stack);
+
+		// Stack neutral epsilon transitions are folded into the closure, every state in it shares the branch's stack
+		for (uint32_t i = closureOffsets[branch.state]; i < closureOffsets[branch.state + 1]; i++) {
+			const uint32_t closureState = closures[i];
+			if (!context.visited.insert({closureState, branch.stack, branch.head, branch.depth}).second) {
+				continue;
+			}
+
+			if (branch.head == inputIds.size() && acceptStates[closureState]) {
+				return true;
+			}
+
+			if (branch.depth >= simulationDepth) {
+				continue;
+			}
+
+			for (uint32_t t = transitionOffsets[closureState]; t < transitionOffsets[closureState + 1]; t++) {
+				const Transition &transition = transitions[t];
+				if (transition.stackSymbol != stackTop && transition.stackSymbol != SymbolTable::EPSILON_SYMBOL_ID) {
+					continue;
+				}
+				if (transition.stackNeutral) {
+					continue;
+				}
+
+				const bool isEpsilon = transition.input == SymbolTable::EPSILON_SYMBOL_ID;
+				if (!isEpsilon && transition.input != currentInput) {
+					continue;
+				}
+
+				Branch next{transition.toState, branch.stack, isEpsilon ? branch.head : branch.head + 1,
+				            branch.depth + 1};
+				if (transition.stackSymbol != SymbolTable::EPSILON_SYMBOL_ID) {
+					next.stack = context.stacks.pop(next.stack);
+				}
+				next.stack = context.stacks.push(next.stack, transition.pushSymbols);
+
+				if (context.visited.find(next) != context.visited.end()) {
+					continue;
+				}
+				context.branches.push_back(std::move(next));
+			}
+		}
+	}
+
+	return false;
+}
+
+struct FrozenNPDA::GraphStructuredStack {
+	/**
+	 * @brief A stack cell, shared by every branch that pushed it, linked to each of the stacks below it.
+	 */
+	struct Vertex {
+		SymbolId symbol;
+		std::vector<uint32_t> below;
+
+		/**
+		 * @brief Transitions that popped the cell, with the position they were taken at, replayed onto every stack
+		 * linked below the cell after they were taken.
+		 */
+		std::vector<std::pair<uint32_t, std::size_t>> pops;
+	};
+
+	// Marks the keys of the cells under the top one in a push, which are shared per transition rather than per state
+	static constexpr uint64_t CHAIN_KEY = uint64_t(1) << 63;
+
+	const FrozenNPDA &automaton;
+	const std::vector<SymbolId> &inputIds;
+
+	/**
+	 * @brief Cells of all the stacks, the first one stands for the empty stack.
+	 */
+	std::vector<Vertex> vertices;
+
+	/**
+	 * @brief Links between cells, packed as (cell, cell below).
+	 */
+	std::unordered_set<uint64_t> edges;
+
+	// Cells and configurations only ever reach one position ahead, so two generations of each are kept: index 0 for
+	// the position being processed and 1 for the next one
+	std::unordered_map<uint64_t, uint32_t> vertexIds[2];
+	std::unordered_set<uint64_t> configurations[2];
+	std::vector<std::pair<uint32_t, uint32_t>> pending[2];
+
+	std::size_t position;
+	bool accepted;
+
+	GraphStructuredStack(const FrozenNPDA &automaton, const std::vector<SymbolId> &inputIds)
+	    : automaton(automaton), inputIds(inputIds), vertices{{SymbolTable::EPSILON_SYMBOL_ID, {}, {}}}, position(0),
+	      accepted(false) {}
+
+	void addConfiguration(const uint32_t &state, const uint32_t &vertex, const std::size_t &at) {
+		const std::size_t generation = at - position;
+		if (!configurations[generation].insert((uint64_t(state) << 32) | vertex).second) {
+			return;
+		}
+		pending[generation].push_back({state, vertex});
+		if (at == inputIds.size() && automaton.acceptStates[state]) {
+			accepted = true;
+		}
+	}
+
+	uint32_t getVertex(const uint64_t &key, const SymbolId &symbol, const std::size_t &at) {
+		auto [it, inserted] = vertexIds[at - position].emplace(key, static_cast<uint32_t>(vertices.size()));
+		if (inserted) {
+			vertices.push_back({symbol, {}, {}});
+		}
+		return it->second;
+	}
+
+	void addEdge(const uint32_t &vertex, const uint32_t &below) {
+		if (!edges.insert((uint64_t(vertex) << 32) | below).second) {
+			return;
+		}
+		vertices[vertex].below.push_back(below);
+
+		// Pops already taken from the cell apply to the new stack below it as well
+		for (std::size_t i = 0; i < vertices[vertex].pops.size(); i++) {
+			const std::pair<uint32_t, std::size_t> pop = vertices[vertex].pops[i];
+			finishTransition(pop.first, below, pop.second);
+		}
+	}
+
+	/**
+	 * @brief Pushes the symbols of a transition onto a stack, after its pop if it has one, and moves to its to state.
+	 */
+	void finishTransition(const uint32_t &index, const uint32_t &base, const std::size_t &from) {
+		const Transition &transition = automaton.transitions[index];
+		const std::size_t at = transition.input == SymbolTable::EPSILON_SYMBOL_ID ? from : from + 1;
+
+		uint32_t top = base;
+		for (uint32_t i = 0; i < transition.pushSymbols.size(); i++) {
+			const SymbolId &symbol = transition.pushSymbols[i];
+			// The top cell is shared by every branch pushing the symbol into the state, the cells under it only by the
+			// branches taking the same transition
+			const uint64_t key = i + 1 == transition.pushSymbols.size() ? (uint64_t(transition.toState) << 32) | symbol
+			                                                              : CHAIN_KEY | (uint64_t(index) << 32) | i;
+			const uint32_t vertex = getVertex(key, symbol, at);
+			addEdge(vertex, top);
+			top = vertex;
+		}
+		addConfiguration(transition.toState, top, at);
+	}
+
+	void expand(const uint32_t &state, const uint32_t &vertex) {
+		SymbolId currentInput = SymbolTable::EPSILON_SYMBOL_ID;
+		if (position < inputIds.size()) {
+			currentInput = inputIds[position];
+		}
+		const SymbolId stackTop = vertices[vertex].symbol;
+
+		for (uint32_t t = automaton.transitionOffsets[state]; t < automaton.transitionOffsets[state + 1]; t++) {
+			const Transition &transition = automaton.transitions[t];
+			if (transition.stackSymbol != stackTop && transition.stackSymbol != SymbolTable::EPSILON_SYMBOL_ID) {
+				continue;
+			}
+			if (transition.input != currentInput && transition.input != SymbolTable::EPSILON_SYMBOL_ID) {
+				continue;
+			}
+
+			if (transition.stackSymbol == SymbolTable::EPSILON_SYMBOL_ID) {
+				finishTransition(t, vertex, position);
+				continue;
+			}
+			vertices[vertex].pops.push_back({t, position});
+			for (std::size_t i = 0; i < vertices[vertex].below.size(); i++) {
+				finishTransition(t, vertices[vertex].below[i], position);
+			}
+		}
+	}
+
+	bool run() {
+		const uint32_t initialStack = getVertex((uint64_t(automaton.startState) << 32) | automaton.initialStackSymbol,
+		                                        automaton.initialStackSymbol, 0);
+		addEdge(initialStack, 0);
+		addConfiguration(automaton.startState, initialStack, 0);
+
+		for (; position <= inputIds.size(); position++) {
+			for (std::size_t i = 0; i < pending[0].size() && !accepted; i++) {
+				const std::pair<uint32_t, uint32_t> configuration = pending[0][i];
+				expand(configuration.first, configuration.second);
+			}
+			if (accepted) {
+				return true;
+			}
+			if (pending[1].empty()) {
+				return false;
+			}
+
+			std::swap(vertexIds[0], vertexIds[1]);
+			std::swap(configurations[0], configurations[1]);
+			std::swap(pending[0], pending[1]);
+			vertexIds[1].clear();
+			configurations[1].clear();
+			pending[1].clear();
+		}
+		return false;
+	}
+};
+
+bool FrozenNPDA::simulateGSS(const std::vector<std::string> &input) const {
+	std::vector<SymbolId> inputIds = SymbolTable::find(input);
+	return GraphStructuredStack(*this, inputIds).run();
+}
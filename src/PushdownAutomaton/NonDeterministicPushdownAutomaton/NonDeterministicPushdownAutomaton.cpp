@@ -1,4 +1,9 @@
 #include "AutomataSimulator/NonDeterministicPushdownAutomaton.h"
+#include "AutomataSimulator/BatchExecutor.h"
+#include <algorithm>
+
+NonDeterministicPushdownAutomaton::NonDeterministicPushdownAutomaton()
+    : possibleCurrentStatesCacheInvalidated(false), epsilonClosuresVersion(0) {}
 
 NonDeterministicPushdownAutomaton::~NonDeterministicPushdownAutomaton() = default;
 
@@ -10,16 +15,128 @@ NonDeterministicPushdownAutomaton::decideRandomTransition(const std::unordered_s
 	return *it;
 }
 
-std::string NonDeterministicPushdownAutomaton::serializeStack(const std::stack<std::string> &stack) {
-	std::stack<std::string> tempStack = stack;
-	std::string result;
+bool NonDeterministicPushdownAutomaton::isStackNeutralEpsilon(const PDATransition &transition) {
+	return transition.getInputId() == SymbolTable::EPSILON_SYMBOL_ID &&
+	       transition.getStackSymbolId() == SymbolTable::EPSILON_SYMBOL_ID &&
+	       transition.getPushSymbolIds().empty();
+}
+
+const std::unordered_map<std::string, std::vector<std::string>> &
+NonDeterministicPushdownAutomaton::getEpsilonClosures() {
+	if (epsilonClosuresVersion == definitionVersion && epsilonClosures.size() == states.size()) {
+		return epsilonClosures;
+	}
+
+	// Number the states so the search can run over dense indices
+	std::vector<std::string> keys;
+	std::unordered_map<std::string, uint32_t> indices;
+	for (const auto &[key, state] : states) {
+		indices.emplace(key, static_cast<uint32_t>(keys.size()));
+		keys.push_back(key);
+	}
+
+	std::vector<std::vector<uint32_t>> epsilonSuccessors(keys.size());
+	for (uint32_t index = 0; index < keys.size(); index++) {
+		for (const auto &transition :
+		     states.at(keys[index]).getTransitionsOn(SymbolTable::EPSILON_SYMBOL_ID, SymbolTable::EPSILON_SYMBOL_ID)) {
+			if (isStackNeutralEpsilon(transition)) {
+				epsilonSuccessors[index].push_back(indices.at(transition.getToStateKey()));
+			}
+		}
+	}
+
+	// Tarjan's algorithm finishes the strongly connected components in reverse topological order, so when a component
+	// finishes, the closures of all the components its epsilon transitions lead to are already complete
+	constexpr uint32_t UNVISITED = UINT32_MAX;
+	std::vector<uint32_t> order(keys.size(), UNVISITED);
+	std::vector<uint32_t> lowLink(keys.size());
+	std::vector<uint32_t> component(keys.size(), UNVISITED);
+	std::vector<uint32_t> componentRoots;
+	// Marks the component each state was last added to a closure for, so the marks never need clearing
+	std::vector<uint32_t> addedTo(keys.size(), UNVISITED);
+	std::vector<uint32_t> componentStack;
+	std::vector<std::pair<uint32_t, std::size_t>> callStack;
+	std::vector<std::vector<uint32_t>> closures(keys.size());
+	uint32_t nextOrder = 0;
+
+	for (uint32_t root = 0; root < keys.size(); root++) {
+		if (order[root] != UNVISITED) {
+			continue;
+		}
+
+		order[root] = lowLink[root] = nextOrder++;
+		componentStack.push_back(root);
+		callStack.push_back({root, 0});
+		while (!callStack.empty()) {
+			auto &[state, edge] = callStack.back();
+			if (edge < epsilonSuccessors[state].size()) {
+				uint32_t next = epsilonSuccessors[state][edge++];
+				if (order[next] == UNVISITED) {
+					order[next] = lowLink[next] = nextOrder++;
+					componentStack.push_back(next);
+					callStack.push_back({next, 0});
+				} else if (component[next] == UNVISITED) {
+					lowLink[state] = std::min(lowLink[state], order[next]);
+				}
+				continue;
+			}
+
+			uint32_t finished = state;
+			callStack.pop_back();
+			if (!callStack.empty()) {
+				uint32_t parent = callStack.back().first;
+				lowLink[parent] = std::min(lowLink[parent], lowLink[finished]);
+			}
+			if (lowLink[finished] != order[finished]) {
+				continue;
+			}
+
+			const uint32_t current = static_cast<uint32_t>(componentRoots.size());
+			componentRoots.push_back(finished);
+			std::vector<uint32_t> &closure = closures[finished];
+			uint32_t member;
+			do {
+				member = componentStack.back();
+				componentStack.pop_back();
+				component[member] = current;
+				addedTo[member] = current;
+				closure.push_back(member);
+			} while (member != finished);
+
+			const std::size_t memberCount = closure.size();
+			for (std::size_t i = 0; i < memberCount; i++) {
+				for (const auto &next : epsilonSuccessors[closure[i]]) {
+					if (component[next] == current) {
+						continue;
+					}
+					for (const auto &reached : closures[componentRoots[component[next]]]) {
+						if (addedTo[reached] != current) {
+							addedTo[reached] = current;
+							closure.push_back(reached);
+						}
+					}
+				}
+			}
 
-	while (!tempStack.empty()) {
-		result += tempStack.top() + "|";
-		tempStack.pop();
+			for (std::size_t i = 0; i < memberCount; i++) {
+				if (closure[i] != finished) {
+					closures[closure[i]] = closure;
+				}
+			}
+		}
 	}
 
-	return result;
+	epsilonClosures.clear();
+	for (uint32_t index = 0; index < keys.size(); index++) {
+		std::vector<std::string> &closureKeys = epsilonClosures[keys[index]];
+		closureKeys.reserve(closures[index].size());
+		for (const auto &reached : closures[index]) {
+			closureKeys.push_back(keys[reached]);
+		}
+	}
+
+	epsilonClosuresVersion = definitionVersion;
+	return epsilonClosures;
 }
 
 std::vector<std::string> NonDeterministicPushdownAutomaton::getPossibleCurrentStates() {
@@ -47,7 +164,7 @@ bool NonDeterministicPushdownAutomaton::processInput() {
 		throw InvalidAutomatonDefinitionException("Current state or start state must be set to run process input");
 	}
 
-	std::string inputSymbol = "";
+	SymbolId inputSymbol = SymbolTable::EPSILON_SYMBOL_ID;
 	if (inputHead < this->input.size()) {
 		inputSymbol = this->input[inputHead];
 	}
@@ -55,19 +172,32 @@ bool NonDeterministicPushdownAutomaton::processInput() {
 	std::unordered_set<PDATransition> possibleTransitions;
 	std::unordered_set<std::string> possibleCurrentStates;
 
-	const std::vector<PDATransition> &transitions = getStateInternal(currentState)->getTransitions();
-	std::string stackTop = stack.empty() ? "" : stack.top();
+	SymbolId stackTop = stack.empty() ? SymbolTable::EPSILON_SYMBOL_ID : stack.top();
 
-	for (const auto &transition : transitions) {
-		if (transition.getStackSymbol() != stackTop && !transition.getStackSymbol().empty()) {
-			continue;
-		}
-		if (transition.getInput() == inputSymbol || transition.getInput().empty()) {
+	for (const auto *transitions : getStateInternal(currentState)->getCandidateTransitions(inputSymbol, stackTop)) {
+		for (const auto &transition : *transitions) {
 			possibleTransitions.insert(transition);
 			possibleCurrentStates.insert(transition.getToStateKey());
 		}
 	}
 
+	// The input symbol can also be read after following stack neutral epsilon transitions from the current state
+	if (inputSymbol != SymbolTable::EPSILON_SYMBOL_ID) {
+		for (const auto &closureState : getEpsilonClosures().at(currentState)) {
+			if (closureState == currentState) {
+				continue;
+			}
+			// Only the groups reading the input symbol, the first two candidates
+			const auto candidates = getStateInternal(closureState)->getCandidateTransitions(inputSymbol, stackTop);
+			for (const auto *transitions : {candidates[0], candidates[1]}) {
+				for (const auto &transition : *transitions) {
+					possibleTransitions.insert(transition);
+					possibleCurrentStates.insert(transition.getToStateKey());
+				}
+			}
+		}
+	}
+
 	if (possibleTransitions.empty()) {
 		return false;
 	}
@@ -78,16 +208,16 @@ bool NonDeterministicPushdownAutomaton::processInput() {
 	currentState = transitionChosen.getToStateKey();
 
 	// If the stack symbol is not epsilon then pop from stack
-	if (!transitionChosen.getStackSymbol().empty()) {
+	if (transitionChosen.getStackSymbolId() != SymbolTable::EPSILON_SYMBOL_ID) {
 		stack.pop();
 	}
 
-	std::vector<std::string> pushSymbolsVec = parsePushSymbols(transitionChosen.getPushSymbol());
+	const std::vector<SymbolId> &pushSymbolsVec = transitionChosen.getPushSymbolIds();
 	for (auto it = pushSymbolsVec.rbegin(); it != pushSymbolsVec.rend(); ++it) {
 		stack.push(*it);
 	}
 	// Only increment the head if the input is a match
-	const bool &incrementHead = transitionChosen.getInput() == inputSymbol && inputHead < this->input.size();
+	const bool &incrementHead = transitionChosen.getInputId() == inputSymbol && inputHead < this->input.size();
 	if (incrementHead) {
 		inputHead++;
 	}
@@ -99,20 +229,22 @@ bool NonDeterministicPushdownAutomaton::processInput() {
 	return getStateInternal(currentState)->getIsAccept();
 }
 
+namespace {
 struct Visited {
 	std::string state;
 	int head;
-	std::string stack;
+	StackPool::StackId stack;
 
 	bool operator==(const Visited &other) const {
 		return state == other.state && head == other.head && stack == other.stack;
 	}
 };
+} // namespace
 
 namespace std {
 template <> struct hash<Visited> {
 	size_t operator()(const Visited &v) const {
-		return hash<std::string>()(v.state) ^ (hash<int>()(v.head) << 1) ^ (hash<std::string>()(v.stack) << 2);
+		return hash<std::string>()(v.state) ^ (hash<int>()(v.head) << 1) ^ (hash<StackPool::StackId>()(v.stack) << 2);
 	}
 };
 } // namespace std
@@ -122,70 +254,166 @@ bool NonDeterministicPushdownAutomaton::simulate(const std::vector<std::string>
 		throw InvalidStartStateException("Start state must be set to run simulate");
 	}
 
+	return simulateInput(SymbolTable::find(input), simulationDepth, SymbolTable::intern(INITIAL_STACK_SYMBOL));
+}
+
+std::vector<bool> NonDeterministicPushdownAutomaton::simulateBatch(const std::vector<std::vector<std::string>> &inputs,
+                                                                   const int &simulationDepth) {
+	if (startState.empty()) {
+		throw InvalidStartStateException("Start state must be set to run simulate");
+	}
+
+	const SymbolId initialStackSymbol = SymbolTable::intern(INITIAL_STACK_SYMBOL);
+	std::vector<std::vector<SymbolId>> inputIds = SymbolTable::find(inputs);
+	// Computed once here, every input then reuses the cached closures
+	getEpsilonClosures();
+
+	std::vector<bool> results(inputs.size());
+	for (std::size_t i = 0; i < inputs.size(); i++) {
+		results[i] = simulateInput(inputIds[i], simulationDepth, initialStackSymbol);
+	}
+	return results;
+}
+
+std::vector<bool>
+NonDeterministicPushdownAutomaton::simulateBatchParallel(const std::vector<std::vector<std::string>> &inputs,
+                                                         const std::size_t &threadCount, const int &simulationDepth) {
+	if (startState.empty()) {
+		throw InvalidStartStateException("Start state must be set to run simulate");
+	}
+
+	prepareConcurrentSimulation();
+	const SymbolId initialStackSymbol = SymbolTable::intern(INITIAL_STACK_SYMBOL);
+	std::vector<std::vector<SymbolId>> inputIds = SymbolTable::find(inputs);
+
+	return BatchExecutor::runPredicate(inputs.size(), threadCount, [&](const std::size_t &i, const std::size_t &) {
+		return simulateInput(inputIds[i], simulationDepth, initialStackSymbol);
+	});
+}
+
+void NonDeterministicPushdownAutomaton::buildSimulationCaches() {
+	PushdownAutomaton::buildSimulationCaches();
+	getEpsilonClosures();
+}
+
+bool NonDeterministicPushdownAutomaton::simulateInput(const std::vector<SymbolId> &inputIds,
+                                                      const int &simulationDepth, const SymbolId &initialStackSymbol) {
 	struct Branch {
 		std::string state;
-		std::stack<std::string> stack;
+		StackPool::StackId stack;
 		int head;
 		int depth;
 	};
 
+	// Branches share the common bottom of their stacks, and equal stacks have equal ids
+	StackPool stacks;
 	std::queue<Branch> branches;
 	std::unordered_set<Visited> visited;
 
-	std::stack<std::string> initialStack;
-	initialStack.push(INITIAL_STACK_SYMBOL);
-	branches.push({getStartState(), initialStack, 0, 0});
+	branches.push({startState, stacks.push(StackPool::EMPTY_STACK, initialStackSymbol), 0, 0});
+
+	const std::unordered_map<std::string, std::vector<std::string>> &closures = getEpsilonClosures();
 
 	while (!branches.empty()) {
 		Branch branch = branches.front();
 		branches.pop();
 
-		visited.insert({branch.state, branch.head, serializeStack(branch.stack)});
-
-		if (branch.head == input.size() && getStateInternal(branch.state)->getIsAccept()) {
-			return true;
+		SymbolId currentInput = SymbolTable::EPSILON_SYMBOL_ID;
+		if (branch.head < inputIds.size()) {
+			currentInput = inputIds[branch.head];
 		}
 
-		if (branch.depth >= simulationDepth) {
-			continue;
-		}
-
-		const std::vector<PDATransition> &transitions = getStateInternal(branch.state)->getTransitions();
+		const SymbolId stackTop = stacks.top(branch.stack);
 
-		std::string currentInput = "";
-		if (branch.head < input.size()) {
-			currentInput = input[branch.head];
-		}
+		// Stack neutral epsilon transitions are folded into the closure, every state in it shares the branch's stack
+		for (const auto &closureState : closures.at(branch.state)) {
+			if (!visited.insert({closureState, branch.head, branch.stack}).second) {
+				continue;
+			}
 
-		const std::string stackTop = branch.stack.empty() ? "" : branch.stack.top();
+			if (branch.head == inputIds.size() && getStateInternal(closureState)->getIsAccept()) {
+				return true;
+			}
 
-		for (const auto &transition : transitions) {
-			if (transition.getStackSymbol() != stackTop && !transition.getStackSymbol().empty()) {
+			if (branch.depth >= simulationDepth) {
 				continue;
 			}
 
-			if (transition.getInput() == "" || transition.getInput() == input[branch.head]) {
-				const int &newHead = transition.getInput() == "" ? branch.head : branch.head + 1;
-				std::stack<std::string> branchStack = branch.stack;
-				if (!transition.getStackSymbol().empty()) {
-					branchStack.pop();
+			for (const auto *transitions :
+			     getStateInternal(closureState)->getCandidateTransitions(currentInput, stackTop)) {
+				for (const auto &transition : *transitions) {
+					if (isStackNeutralEpsilon(transition)) {
+						continue;
+					}
+
+					const bool isEpsilon = transition.getInputId() == SymbolTable::EPSILON_SYMBOL_ID;
+					const int &newHead = isEpsilon ? branch.head : branch.head + 1;
+					StackPool::StackId branchStack = branch.stack;
+					if (transition.getStackSymbolId() != SymbolTable::EPSILON_SYMBOL_ID) {
+						branchStack = stacks.pop(branchStack);
+					}
+
+					const std::vector<SymbolId> &pushSymbolsVec = transition.getPushSymbolIds();
+					for (auto it = pushSymbolsVec.rbegin(); it != pushSymbolsVec.rend(); ++it) {
+						branchStack = stacks.push(branchStack, *it);
+					}
+
+					if (visited.find({transition.getToStateKey(), newHead, branchStack}) != visited.end()) {
+						continue;
+					}
+
+					branches.push({transition.getToStateKey(), branchStack, newHead, branch.depth + 1});
 				}
+			}
+		}
+	}
 
-				std::vector<std::string> pushSymbolsVec = parsePushSymbols(transition.getPushSymbol());
-				for (auto it = pushSymbolsVec.rbegin(); it != pushSymbolsVec.rend(); ++it) {
-					branchStack.push(*it);
-				}
+	return false;
+}
+bool NonDeterministicPushdownAutomaton::simulateGSS(const std::vector<std::string> &input) {
+	if (startState.empty()) {
+		throw InvalidStartStateException("Start state must be set to run simulate");
+	}
 
-				std::string serializedStack = serializeStack(branchStack);
+	return freeze().simulateGSS(input);
+}
 
-				if (visited.find({transition.getToStateKey(), newHead, serializedStack}) != visited.end()) {
-					continue;
-				}
+FrozenNPDA NonDeterministicPushdownAutomaton::freeze() {
+	if (startState.empty()) {
+		throw InvalidStartStateException("Start state must be set to freeze");
+	}
 
-				branches.push({transition.getToStateKey(), branchStack, newHead, branch.depth + 1});
-			}
+	FrozenNPDA frozen;
+	frozen.initialStackSymbol = SymbolTable::intern(INITIAL_STACK_SYMBOL);
+
+	std::unordered_map<std::string, uint32_t> stateIndices;
+	for (const auto &[key, state] : states) {
+		stateIndices.emplace(key, static_cast<uint32_t>(frozen.stateLabels.size()));
+		frozen.stateLabels.push_back(key);
+		frozen.acceptStates.push_back(state.getIsAccept());
+	}
+	frozen.startState = stateIndices.at(startState);
+
+	const std::unordered_map<std::string, std::vector<std::string>> &stateClosures = getEpsilonClosures();
+
+	frozen.transitionOffsets.push_back(0);
+	frozen.closureOffsets.push_back(0);
+	for (const auto &key : frozen.stateLabels) {
+		for (const auto &transition : getStateInternal(key)->getTransitionsView()) {
+			std::vector<SymbolId> pushSymbols = transition.getPushSymbolIds();
+			// The first push symbol ends on top of the stack
+			std::reverse(pushSymbols.begin(), pushSymbols.end());
+			frozen.transitions.push_back({transition.getInputId(), transition.getStackSymbolId(), pushSymbols,
+			                              stateIndices.at(transition.getToStateKey()),
+			                              isStackNeutralEpsilon(transition)});
+		}
+		frozen.transitionOffsets.push_back(static_cast<uint32_t>(frozen.transitions.size()));
+
+		for (const auto &closureState : stateClosures.at(key)) {
+			frozen.closures.push_back(stateIndices.at(closureState));
 		}
+		frozen.closureOffsets.push_back(static_cast<uint32_t>(frozen.closures.size()));
 	}
 
-	return false;
-}
\ No newline at end of file
+	return frozen;
+}
@@ -1,4 +1,14 @@
 #include "AutomataSimulator/PDAState.h"
+#include <algorithm>
+
+namespace {
+// Returned for input and stack symbols the state has no transitions on
+const std::vector<PDATransition> noTransitions;
+
+uint64_t inputIndexKey(const SymbolId &input, const SymbolId &stackSymbol) {
+	return (static_cast<uint64_t>(input) << 32) | stackSymbol;
+}
+} // namespace
 
 PDAState::PDAState() : key(""), label(""), isAccept(false), transitionsCacheInvalidated(false) {}
 
@@ -7,7 +17,9 @@ PDAState::PDAState(const std::string &label, const bool &isAccept)
 
 PDAState::PDAState(const PDAState &other)
     : key(other.key), label(other.label), isAccept(other.isAccept), transitions(other.transitions),
-      transitionsCacheInvalidated(other.transitionsCacheInvalidated) {}
+      transitionsCacheInvalidated(true),
+      transitionsByInputAndStack(other.transitionsByInputAndStack), inputTransitionCounts(other.inputTransitionCounts) {
+}
 
 PDAState &PDAState::operator=(const PDAState &other) {
 	if (this != &other) {
@@ -15,14 +27,18 @@ PDAState &PDAState::operator=(const PDAState &other) {
 		label = other.label;
 		isAccept = other.isAccept;
 		transitions = other.transitions;
-		transitionsCacheInvalidated = other.transitionsCacheInvalidated;
+		transitionsCacheInvalidated = true;
+		transitionsByInputAndStack = other.transitionsByInputAndStack;
+		inputTransitionCounts = other.inputTransitionCounts;
 	}
 	return *this;
 }
 
 PDAState::PDAState(PDAState &&other) noexcept
     : key(std::move(other.key)), label(std::move(other.label)), isAccept(other.isAccept),
-      transitions(std::move(other.transitions)), transitionsCacheInvalidated(other.transitionsCacheInvalidated) {}
+      transitions(std::move(other.transitions)), transitionsCacheInvalidated(true),
+      transitionsByInputAndStack(std::move(other.transitionsByInputAndStack)),
+      inputTransitionCounts(std::move(other.inputTransitionCounts)) {}
 
 PDAState &PDAState::operator=(PDAState &&other) noexcept {
 	if (this != &other) {
@@ -30,7 +46,9 @@ PDAState &PDAState::operator=(PDAState &&other) noexcept {
 		label = std::move(other.label);
 		isAccept = other.isAccept;
 		transitions = std::move(other.transitions);
-		transitionsCacheInvalidated = other.transitionsCacheInvalidated;
+		transitionsCacheInvalidated = true;
+		transitionsByInputAndStack = std::move(other.transitionsByInputAndStack);
+		inputTransitionCounts = std::move(other.inputTransitionCounts);
 	}
 	return *this;
 }
@@ -42,14 +60,46 @@ bool PDAState::operator==(const PDAState &other) const {
 PDAState::~PDAState() {}
 
 PDATransition *PDAState::getTransitionInternal(const std::string &key) {
-	auto it = transitions.find(key);
+	auto it = transitions.find(PDATransition::parseTransitionKey(key));
 	if (it == transitions.end()) {
 		throw TransitionNotFoundException(key);
 	}
 	return &(it->second);
 }
 
+void PDAState::addToInputIndex(const PDATransition &transition) {
+	transitionsByInputAndStack[inputIndexKey(transition.getInputId(), transition.getStackSymbolId())].push_back(
+	    transition);
+	if (transition.getInputId() != SymbolTable::EPSILON_SYMBOL_ID) {
+		inputTransitionCounts[transition.getStackSymbolId()]++;
+	}
+}
+
+void PDAState::removeFromInputIndex(const PDATransition &transition) {
+	auto it = transitionsByInputAndStack.find(inputIndexKey(transition.getInputId(), transition.getStackSymbolId()));
+	std::vector<PDATransition> &bucket = it->second;
+
+	// Buckets hold the few transitions sharing one input and stack symbol, order within them does not matter
+	auto match = std::find_if(bucket.begin(), bucket.end(), [&](const PDATransition &candidate) {
+		return candidate.getTransitionKey() == transition.getTransitionKey();
+	});
+	*match = std::move(bucket.back());
+	bucket.pop_back();
+	if (bucket.empty()) {
+		transitionsByInputAndStack.erase(it);
+	}
+
+	if (transition.getInputId() != SymbolTable::EPSILON_SYMBOL_ID &&
+	    --inputTransitionCounts[transition.getStackSymbolId()] == 0) {
+		inputTransitionCounts.erase(transition.getStackSymbolId());
+	}
+}
+
 bool PDAState::transitionExists(const std::string &key) const {
+	return transitionExists(PDATransition::parseTransitionKey(key));
+}
+
+bool PDAState::transitionExists(const TransitionKey &key) const {
 	return transitions.find(key) != transitions.end();
 }
 
@@ -61,13 +111,16 @@ void PDAState::setLabel(const std::string &label) {
 	this->label = label;
 	this->key = label;
 
-	std::unordered_map<std::string, PDATransition> newTransitions;
+	std::unordered_map<TransitionKey, PDATransition> newTransitions;
 
 	// Loop over all transitions to update their from state key.
+	transitionsByInputAndStack.clear();
+	inputTransitionCounts.clear();
 	for (const auto &pair : transitions) {
 		PDATransition transition = pair.second;
 		transition.setFromStateKey(key);
-		newTransitions[transition.getKey()] = transition;
+		newTransitions[transition.getTransitionKey()] = transition;
+		addToInputIndex(transition);
 	}
 	transitions = newTransitions;
 	transitionsCacheInvalidated = true;
@@ -87,49 +140,52 @@ bool PDAState::getIsAccept() const {
 
 void PDAState::addTransition(const std::string &toStateKey, const std::string &input, const std::string &stackSymbol,
                              const std::string &pushSymbol) {
-	std::string transitionKey = PDATransition::generateTransitionKey(key, toStateKey, input, stackSymbol, pushSymbol);
+	PDATransition transition = PDATransition(key, toStateKey, input, stackSymbol, pushSymbol);
 
 	// Check if transition already exists
-	if (transitionExists(transitionKey)) {
+	if (transitionExists(transition.getTransitionKey())) {
 		throw InvalidTransitionException("Transition already exists: " + key + " -> " + input + " -> " + toStateKey +
 		                                 " -> " + stackSymbol + " -> " + pushSymbol);
 	}
 
-	PDATransition transition = PDATransition(key, toStateKey, input, stackSymbol, pushSymbol);
-	transitions[transition.getKey()] = transition;
+	transitions[transition.getTransitionKey()] = transition;
+	addToInputIndex(transition);
 	transitionsCacheInvalidated = true;
 }
 
 PDATransition PDAState::getTransition(const std::string &key) {
+	return *getTransitionInternal(key);
+}
+
+PDATransition PDAState::getTransition(const TransitionKey &key) {
 	auto it = transitions.find(key);
 	// Check if state exists
 	if (it == transitions.end()) {
-		throw TransitionNotFoundException(key);
+		throw TransitionNotFoundException(PDATransition::generateTransitionKey(key));
 	}
 	return it->second;
 }
 
+void PDAState::replaceTransition(const TransitionKey &transitionKey, const PDATransition &transition) {
+	auto it = transitions.find(transitionKey);
+	removeFromInputIndex(it->second);
+	transitions.erase(it);
+	transitions[transition.getTransitionKey()] = transition;
+	addToInputIndex(transition);
+	transitionsCacheInvalidated = true;
+}
+
 void PDAState::setTransitionInput(const std::string &transitionKey, const std::string &input) {
-	if (!transitionExists(transitionKey)) {
-		throw TransitionNotFoundException(transitionKey);
-	}
-	std::string newTransitionKey = PDATransition::generateTransitionKey(key, getTransitionToState(transitionKey), input,
-	                                                                    getTransitionStackSymbol(transitionKey),
-	                                                                    getTransitionPushSymbol(transitionKey));
+	PDATransition transition = *getTransitionInternal(transitionKey);
+	transition.setInput(input);
 
 	// Check if transition already exists
-	if (transitionExists(newTransitionKey)) {
+	if (transitionExists(transition.getTransitionKey())) {
 		throw InvalidTransitionException("Transition already exists: " + key + " -> " + input + " -> " +
-		                                 getTransitionToState(transitionKey));
+		                                 transition.getToStateKey());
 	}
 
-	PDATransition *transition = getTransitionInternal(transitionKey);
-	transition->setInput(input);
-
-	transitions[newTransitionKey] = *transition;
-	transitions.erase(transitionKey);
-
-	transitionsCacheInvalidated = true;
+	replaceTransition(PDATransition::parseTransitionKey(transitionKey), transition);
 }
 
 std::string PDAState::getTransitionInput(const std::string &transitionKey) {
@@ -146,24 +202,20 @@ void PDAState::setTransitionToState(const std::string &transitionKey, const std:
 	if (!transitionExists(transitionKey)) {
 		throw TransitionNotFoundException(transitionKey);
 	}
+	setTransitionToState(PDATransition::parseTransitionKey(transitionKey), toState);
+}
 
-	std::string newTransitionKey = PDATransition::generateTransitionKey(key, toState, getTransitionInput(transitionKey),
-	                                                                    getTransitionStackSymbol(transitionKey),
-	                                                                    getTransitionPushSymbol(transitionKey));
+void PDAState::setTransitionToState(const TransitionKey &transitionKey, const std::string &toState) {
+	PDATransition transition = getTransition(transitionKey);
+	transition.setToStateKey(toState);
 
 	// Check if transition already exists
-	if (transitionExists(newTransitionKey)) {
-		throw InvalidTransitionException("Transition already exists: " + key + " -> " +
-		                                 getTransitionInput(transitionKey) + " -> " + toState);
+	if (transitionExists(transition.getTransitionKey())) {
+		throw InvalidTransitionException("Transition already exists: " + key + " -> " + transition.getInput() +
+		                                 " -> " + toState);
 	}
 
-	PDATransition *transition = getTransitionInternal(transitionKey);
-	transition->setToStateKey(toState);
-
-	transitions[newTransitionKey] = *transition;
-	transitions.erase(transitionKey);
-
-	transitionsCacheInvalidated = true;
+	replaceTransition(transitionKey, transition);
 }
 
 std::string PDAState::getTransitionStackSymbol(const std::string &transitionKey) {
@@ -172,27 +224,16 @@ std::string PDAState::getTransitionStackSymbol(const std::string &transitionKey)
 }
 
 void PDAState::setTransitionStackSymbol(const std::string &transitionKey, const std::string &stackSymbol) {
-	if (!transitionExists(transitionKey)) {
-		throw TransitionNotFoundException(transitionKey);
-	}
-
-	std::string newTransitionKey = PDATransition::generateTransitionKey(key, getTransitionToState(transitionKey),
-	                                                                    getTransitionInput(transitionKey), stackSymbol,
-	                                                                    getTransitionPushSymbol(transitionKey));
+	PDATransition transition = *getTransitionInternal(transitionKey);
+	transition.setStackSymbol(stackSymbol);
 
 	// Check if transition already exists
-	if (transitionExists(newTransitionKey)) {
-		throw InvalidTransitionException("Transition already exists: " + key + " -> " +
-		                                 getTransitionInput(transitionKey) + " -> " +
-		                                 getTransitionToState(transitionKey));
+	if (transitionExists(transition.getTransitionKey())) {
+		throw InvalidTransitionException("Transition already exists: " + key + " -> " + transition.getInput() +
+		                                 " -> " + transition.getToStateKey());
 	}
-	PDATransition *transition = getTransitionInternal(transitionKey);
-	transition->setStackSymbol(stackSymbol);
-
-	transitions[newTransitionKey] = *transition;
-	transitions.erase(transitionKey);
 
-	transitionsCacheInvalidated = true;
+	replaceTransition(PDATransition::parseTransitionKey(transitionKey), transition);
 }
 
 std::string PDAState::getTransitionPushSymbol(const std::string &transitionKey) {
@@ -201,30 +242,23 @@ std::string PDAState::getTransitionPushSymbol(const std::string &transitionKey)
 }
 
 void PDAState::setTransitionPushSymbol(const std::string &transitionKey, const std::string &pushSymbol) {
-	if (!transitionExists(transitionKey)) {
-		throw TransitionNotFoundException(transitionKey);
-	}
-
-	std::string newTransitionKey = PDATransition::generateTransitionKey(
-	    key, getTransitionToState(transitionKey), getTransitionInput(transitionKey),
-	    getTransitionStackSymbol(transitionKey), pushSymbol);
+	PDATransition transition = *getTransitionInternal(transitionKey);
+	transition.setPushSymbol(pushSymbol);
 
 	// Check if transition already exists
-	if (transitionExists(newTransitionKey)) {
-		throw InvalidTransitionException("Transition already exists: " + key + " -> " +
-		                                 getTransitionInput(transitionKey) + " -> " +
-		                                 getTransitionToState(transitionKey));
+	if (transitionExists(transition.getTransitionKey())) {
+		throw InvalidTransitionException("Transition already exists: " + key + " -> " + transition.getInput() +
+		                                 " -> " + transition.getToStateKey());
 	}
-	PDATransition *transition = getTransitionInternal(transitionKey);
-	transition->setPushSymbol(pushSymbol);
-
-	transitions[newTransitionKey] = *transition;
-	transitions.erase(transitionKey);
 
-	transitionsCacheInvalidated = true;
+	replaceTransition(PDATransition::parseTransitionKey(transitionKey), transition);
 }
 
 std::vector<PDATransition> PDAState::getTransitions() {
+	return getTransitionsView();
+}
+
+const std::vector<PDATransition> &PDAState::getTransitionsView() {
 	if (transitionsCacheInvalidated) {
 		cachedTransitions.clear();
 		for (const auto &pair : transitions) {
@@ -235,11 +269,44 @@ std::vector<PDATransition> PDAState::getTransitions() {
 	return cachedTransitions;
 }
 
+const std::vector<PDATransition> &PDAState::getTransitionsOn(const SymbolId &input,
+                                                             const SymbolId &stackSymbol) const {
+	auto it = transitionsByInputAndStack.find(inputIndexKey(input, stackSymbol));
+	return it == transitionsByInputAndStack.end() ? noTransitions : it->second;
+}
+
+std::array<const std::vector<PDATransition> *, 4> PDAState::getCandidateTransitions(const SymbolId &input,
+                                                                                    const SymbolId &stackTop) const {
+	const bool inputIsEpsilon = input == SymbolTable::EPSILON_SYMBOL_ID;
+	const bool stackIsEpsilon = stackTop == SymbolTable::EPSILON_SYMBOL_ID;
+
+	// Epsilon input or stack top makes some of the groups the same bucket, which must only be returned once
+	return {&getTransitionsOn(input, stackTop),
+	        stackIsEpsilon ? &noTransitions : &getTransitionsOn(input, SymbolTable::EPSILON_SYMBOL_ID),
+	        inputIsEpsilon ? &noTransitions : &getTransitionsOn(SymbolTable::EPSILON_SYMBOL_ID, stackTop),
+	        inputIsEpsilon || stackIsEpsilon
+	            ? &noTransitions
+	            : &getTransitionsOn(SymbolTable::EPSILON_SYMBOL_ID, SymbolTable::EPSILON_SYMBOL_ID)};
+}
+
+bool PDAState::hasInputTransitionOnStack(const SymbolId &stackSymbol) const {
+	return inputTransitionCounts.find(stackSymbol) != inputTransitionCounts.end();
+}
+
 void PDAState::removeTransition(const std::string &transitionKey) {
 	if (!transitionExists(transitionKey)) {
 		throw TransitionNotFoundException(transitionKey);
 	}
-	transitions.erase(transitionKey);
+	removeTransition(PDATransition::parseTransitionKey(transitionKey));
+}
+
+void PDAState::removeTransition(const TransitionKey &transitionKey) {
+	auto it = transitions.find(transitionKey);
+	if (it == transitions.end()) {
+		throw TransitionNotFoundException(PDATransition::generateTransitionKey(transitionKey));
+	}
+	removeFromInputIndex(it->second);
+	transitions.erase(it);
 	transitionsCacheInvalidated = true;
 }
 
@@ -247,6 +314,7 @@ void PDAState::clearTransitionsTo(const std::string &toStateKey) {
 	auto it = transitions.begin();
 	while (it != transitions.end()) {
 		if (it->second.getToStateKey() == toStateKey) {
+			removeFromInputIndex(it->second);
 			it = transitions.erase(it);
 		} else {
 			++it;
@@ -257,6 +325,8 @@ void PDAState::clearTransitionsTo(const std::string &toStateKey) {
 
 void PDAState::clearTransitions() {
 	transitions.clear();
+	transitionsByInputAndStack.clear();
+	inputTransitionCounts.clear();
 	transitionsCacheInvalidated = true;
 }
 
@@ -1,17 +1,22 @@
 #include "AutomataSimulator/PDATransition.h"
+#include <algorithm>
+#include <sstream>
 
-PDATransition::PDATransition() : fromStateKey(""), toStateKey(""), input(""), stackSymbol(""), key("") {}
+PDATransition::PDATransition()
+    : fromStateKey(""), toStateKey(""), input(SymbolTable::EPSILON_SYMBOL_ID),
+      stackSymbol(SymbolTable::EPSILON_SYMBOL_ID) {}
 
 PDATransition::PDATransition(const std::string &fromStateKey, const std::string &toStateKey, const std::string &input,
                              const std::string &stackSymbol, const std::string &pushSymbol)
-    : fromStateKey(fromStateKey), toStateKey(toStateKey), input(input), stackSymbol(stackSymbol),
-      pushSymbol(pushSymbol) {
-	key = generateTransitionKey(fromStateKey, toStateKey, input, stackSymbol, pushSymbol);
+    : fromStateKey(fromStateKey), toStateKey(toStateKey), input(SymbolTable::intern(input)),
+      stackSymbol(SymbolTable::intern(stackSymbol)), pushSymbol(pushSymbol),
+      pushSymbolIds(SymbolTable::intern(parsePushSymbols(pushSymbol))) {
+	updateKey();
 }
 
 PDATransition::PDATransition(const PDATransition &other)
     : fromStateKey(other.fromStateKey), toStateKey(other.toStateKey), input(other.input), key(other.key),
-      stackSymbol(other.stackSymbol), pushSymbol(other.pushSymbol) {}
+      stackSymbol(other.stackSymbol), pushSymbol(other.pushSymbol), pushSymbolIds(other.pushSymbolIds) {}
 
 PDATransition &PDATransition::operator=(const PDATransition &other) {
 	if (this != &other) {
@@ -21,13 +26,15 @@ PDATransition &PDATransition::operator=(const PDATransition &other) {
 		key = other.key;
 		stackSymbol = other.stackSymbol;
 		pushSymbol = other.pushSymbol;
+		pushSymbolIds = other.pushSymbolIds;
 	}
 	return *this;
 }
 
 PDATransition::PDATransition(PDATransition &&other) noexcept
     : fromStateKey(other.fromStateKey), toStateKey(other.toStateKey), input(other.input),
-      stackSymbol(other.stackSymbol), pushSymbol(other.pushSymbol), key(other.key) {}
+      stackSymbol(other.stackSymbol), pushSymbol(other.pushSymbol), pushSymbolIds(std::move(other.pushSymbolIds)),
+      key(other.key) {}
 
 PDATransition &PDATransition::operator=(PDATransition &&other) noexcept {
 	if (this != &other) {
@@ -37,6 +44,7 @@ PDATransition &PDATransition::operator=(PDATransition &&other) noexcept {
 		key = other.key;
 		stackSymbol = other.stackSymbol;
 		pushSymbol = other.pushSymbol;
+		pushSymbolIds = std::move(other.pushSymbolIds);
 	}
 	return *this;
 }
@@ -51,57 +59,88 @@ PDATransition::~PDATransition() {}
 std::string PDATransition::generateTransitionKey(const std::string &fromStateKey, const std::string &toStateKey,
                                                  const std::string &input, const std::string &stackSymbol,
                                                  const std::string &pushSymbol) {
-	return fromStateKey + "-" + toStateKey + "-" + input + "-" + stackSymbol + "-" + pushSymbol;
+	return TransitionKey::joinParts({fromStateKey, toStateKey, input, stackSymbol, pushSymbol});
 }
 
-void PDATransition::validateTransitionKeyFormat(const std::string &key) {
-	int delimiterCount = std::count(key.begin(), key.end(), '-');
-	if (delimiterCount != 4) {
+std::string PDATransition::generateTransitionKey(const TransitionKey &key) {
+	return generateTransitionKey(SymbolTable::getSymbol(key.fromState), SymbolTable::getSymbol(key.toState),
+	                             SymbolTable::getSymbol(key.symbols[0]), SymbolTable::getSymbol(key.symbols[1]),
+	                             SymbolTable::getSymbol(key.symbols[2]));
+}
+
+TransitionKey PDATransition::parseTransitionKey(const std::string &key) {
+	std::vector<std::string> parts = splitTransitionKey(key);
+	return TransitionKey(SymbolTable::find(parts[0]), SymbolTable::find(parts[1]), SymbolTable::find(parts[2]),
+	                     SymbolTable::find(parts[3]), SymbolTable::find(parts[4]));
+}
+
+std::vector<std::string> PDATransition::parsePushSymbols(const std::string &pushSymbols) {
+	std::vector<std::string> symbols;
+	char delimiter = ',';
+
+	if (pushSymbols.find(delimiter) == std::string::npos) {
+		if (!pushSymbols.empty()) {
+			symbols.push_back(pushSymbols);
+		}
+		return symbols;
+	}
+
+	std::stringstream ss(pushSymbols);
+	std::string symbol;
+
+	// Extract symbols separated by the delimiter
+	while (std::getline(ss, symbol, delimiter)) {
+		if (!symbol.empty()) {
+			symbols.push_back(symbol);
+		}
+	}
+	return symbols;
+}
+
+std::vector<std::string> PDATransition::splitTransitionKey(const std::string &key) {
+	std::vector<std::string> parts = TransitionKey::splitParts(key);
+	if (parts.size() != 5) {
 		throw TransitionNotFoundException("Invalid PDA transition key format: " + key);
 	}
+	return parts;
 }
 
 std::string PDATransition::getFromStateFromKey(const std::string &key) {
-	validateTransitionKeyFormat(key);
-	size_t first = key.find('-');
-	return key.substr(0, first);
+	return splitTransitionKey(key)[0];
 }
 
 std::string PDATransition::getToStateFromKey(const std::string &key) {
-	validateTransitionKeyFormat(key);
-	size_t first = key.find('-');
-	size_t second = key.find('-', first + 1);
-	return key.substr(first + 1, second - first - 1);
+	return splitTransitionKey(key)[1];
 }
 
 std::string PDATransition::getInputFromKey(const std::string &key) {
-	validateTransitionKeyFormat(key);
-	size_t first = key.find('-');
-	size_t second = key.find('-', first + 1);
-	size_t third = key.find('-', second + 1);
-	return key.substr(second + 1, third - second - 1);
+	return splitTransitionKey(key)[2];
 }
 
 std::string PDATransition::getStackSymbolFromKey(const std::string &key) {
-	validateTransitionKeyFormat(key);
-	size_t third = key.find('-', key.find('-', key.find('-') + 1) + 1);
-	size_t fourth = key.find('-', third + 1);
-	return key.substr(third + 1, fourth - third - 1);
+	return splitTransitionKey(key)[3];
 }
 
 std::string PDATransition::getPushSymbolFromKey(const std::string &key) {
-	validateTransitionKeyFormat(key);
-	size_t lastDelimiter = key.find_last_of('-');
-	return key.substr(lastDelimiter + 1);
+	return splitTransitionKey(key)[4];
 }
 
 std::string PDATransition::getKey() const {
+	return generateTransitionKey(fromStateKey, toStateKey, getInput(), getStackSymbol(), pushSymbol);
+}
+
+const TransitionKey &PDATransition::getTransitionKey() const {
 	return key;
 }
 
+void PDATransition::updateKey() {
+	key = TransitionKey(SymbolTable::intern(fromStateKey), SymbolTable::intern(toStateKey), input, stackSymbol,
+	                    SymbolTable::intern(pushSymbol));
+}
+
 void PDATransition::setFromStateKey(const std::string &fromStateKey) {
 	this->fromStateKey = fromStateKey;
-	key = generateTransitionKey(fromStateKey, toStateKey, input, stackSymbol, pushSymbol);
+	updateKey();
 }
 
 std::string PDATransition::getFromStateKey() const {
@@ -110,7 +149,7 @@ std::string PDATransition::getFromStateKey() const {
 
 void PDATransition::setToStateKey(const std::string &toState) {
 	this->toStateKey = toState;
-	key = generateTransitionKey(fromStateKey, toStateKey, input, stackSymbol, pushSymbol);
+	updateKey();
 }
 
 std::string PDATransition::getToStateKey() const {
@@ -118,26 +157,39 @@ std::string PDATransition::getToStateKey() const {
 }
 
 void PDATransition::setInput(const std::string &input) {
-	this->input = input;
-	key = generateTransitionKey(fromStateKey, toStateKey, input, stackSymbol, pushSymbol);
+	this->input = SymbolTable::intern(input);
+	updateKey();
 }
 
 std::string PDATransition::getInput() const {
+	return SymbolTable::getSymbol(input);
+}
+
+SymbolId PDATransition::getInputId() const {
 	return input;
 }
 
 void PDATransition::setStackSymbol(const std::string &stackSymbol) {
-	this->stackSymbol = stackSymbol;
-	key = generateTransitionKey(fromStateKey, toStateKey, input, stackSymbol, pushSymbol);
+	this->stackSymbol = SymbolTable::intern(stackSymbol);
+	updateKey();
 }
 
 std::string PDATransition::getStackSymbol() const {
+	return SymbolTable::getSymbol(stackSymbol);
+}
+
+SymbolId PDATransition::getStackSymbolId() const {
 	return stackSymbol;
 }
 
 void PDATransition::setPushSymbol(const std::string &pushSymbol) {
 	this->pushSymbol = pushSymbol;
-	key = generateTransitionKey(fromStateKey, toStateKey, input, stackSymbol, pushSymbol);
+	pushSymbolIds = SymbolTable::intern(parsePushSymbols(pushSymbol));
+	updateKey();
+}
+
+const std::vector<SymbolId> &PDATransition::getPushSymbolIds() const {
+	return pushSymbolIds;
 }
 
 std::string PDATransition::getPushSymbol() const {
@@ -145,6 +197,6 @@ std::string PDATransition::getPushSymbol() const {
 }
 
 std::string PDATransition::toString() const {
-	return "Transition: [" + fromStateKey + " -> " + toStateKey + " | Input: " + input +
-	       " | Stack Symbol: " + stackSymbol + " | Push Symbol: " + pushSymbol + "]";
+	return "Transition: [" + fromStateKey + " -> " + toStateKey + " | Input: " + getInput() +
+	       " | Stack Symbol: " + getStackSymbol() + " | Push Symbol: " + pushSymbol + "]";
 }
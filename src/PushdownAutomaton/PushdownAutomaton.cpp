@@ -4,33 +4,14 @@ const std::string INITIAL_STACK_SYMBOL = "Z";
 
 PushdownAutomaton::PushdownAutomaton()
     : inputHead(0), startState(""), inputAlphabetCacheInvalidated(false), stackAlphabetCacheInvalidated(false),
-      statesCacheInvalidated(false) {
-	stack.push(INITIAL_STACK_SYMBOL);
+      statesCacheInvalidated(false), definitionVersion(0) {
+	stack.push(SymbolTable::intern(INITIAL_STACK_SYMBOL));
 }
 
 PushdownAutomaton::~PushdownAutomaton() {}
 
 std::vector<std::string> PushdownAutomaton::parsePushSymbols(const std::string &pushSymbols) {
-	std::vector<std::string> symbols;
-	char delimiter = ',';
-
-	if (pushSymbols.find(delimiter) == std::string::npos) {
-		if (!pushSymbols.empty()) {
-			symbols.push_back(pushSymbols);
-		}
-		return symbols;
-	}
-
-	std::stringstream ss(pushSymbols);
-	std::string symbol;
-
-	// Extract symbols separated by the delimiter
-	while (std::getline(ss, symbol, delimiter)) {
-		if (!symbol.empty()) {
-			symbols.push_back(symbol);
-		}
-	}
-	return symbols;
+	return PDATransition::parsePushSymbols(pushSymbols);
 }
 
 void PushdownAutomaton::validateTransition(const std::string &fromStateKey, const std::string &toStateKey,
@@ -61,8 +42,9 @@ void PushdownAutomaton::validateTransition(const std::string &fromStateKey, cons
 	}
 
 	PDAState *fromState = getStateInternal(fromStateKey);
-	std::string transitionKey =
-	    PDATransition::generateTransitionKey(fromStateKey, toStateKey, input, stackSymbol, pushSymbol);
+	TransitionKey transitionKey(SymbolTable::find(fromStateKey), SymbolTable::find(toStateKey),
+	                            SymbolTable::find(input), SymbolTable::find(stackSymbol),
+	                            SymbolTable::find(pushSymbol));
 
 	// Check if the new transition would be a duplicate
 	if (fromState->transitionExists(transitionKey)) {
@@ -72,6 +54,38 @@ void PushdownAutomaton::validateTransition(const std::string &fromStateKey, cons
 	}
 }
 
+void PushdownAutomaton::prepareConcurrentSimulation() {
+	std::lock_guard<CacheMutex> lock(simulationCachesMutex);
+	buildSimulationCaches();
+}
+
+void PushdownAutomaton::buildSimulationCaches() {
+	// Rebuilds the transition vector of every state whose cache was invalidated
+	for (auto &pair : states) {
+		pair.second.getTransitionsView();
+	}
+}
+
+void PushdownAutomaton::indexTransition(const PDATransition &transition) {
+	incomingTransitions[transition.getToStateKey()].insert(transition.getTransitionKey());
+}
+
+void PushdownAutomaton::unindexTransition(const PDATransition &transition) {
+	incomingTransitions[transition.getToStateKey()].erase(transition.getTransitionKey());
+}
+
+void PushdownAutomaton::removeTransitionInternal(PDAState &state, const PDATransition &transition) {
+	unindexTransition(transition);
+	state.removeTransition(transition.getTransitionKey());
+}
+
+void PushdownAutomaton::unindexState(const std::string &key) {
+	for (const auto &transition : getStateInternal(key)->getTransitionsView()) {
+		unindexTransition(transition);
+	}
+	incomingTransitions.erase(key);
+}
+
 PDAState *PushdownAutomaton::getStateInternal(const std::string &key) {
 	auto it = states.find(key);
 	// Check if state exists
@@ -82,7 +96,7 @@ PDAState *PushdownAutomaton::getStateInternal(const std::string &key) {
 }
 
 std::vector<std::string> PushdownAutomaton::getInput() const {
-	return input;
+	return SymbolTable::getSymbols(input);
 }
 
 void PushdownAutomaton::setInput(const std::vector<std::string> &input) {
@@ -103,7 +117,7 @@ void PushdownAutomaton::setInput(const std::vector<std::string> &input) {
 		throw InputAlphabetSymbolNotFoundException(missingSymbolsString);
 	}
 
-	this->input = input;
+	this->input = SymbolTable::intern(input);
 	this->inputHead = 0;
 }
 
@@ -125,7 +139,8 @@ void PushdownAutomaton::addInput(const std::vector<std::string> &input) {
 		throw InputAlphabetSymbolNotFoundException(missingSymbolsString);
 	}
 
-	this->input.insert(this->input.end(), input.begin(), input.end());
+	std::vector<SymbolId> inputIds = SymbolTable::intern(input);
+	this->input.insert(this->input.end(), inputIds.begin(), inputIds.end());
 }
 
 int PushdownAutomaton::getInputHead() const {
@@ -143,11 +158,32 @@ void PushdownAutomaton::setInputHead(const int &inputHead) {
 }
 
 std::stack<std::string> PushdownAutomaton::getStack() {
-	return stack;
+	// Unwind a copy of the stack so the symbols can be pushed back bottom first
+	std::stack<SymbolId> tempStack = stack;
+	std::vector<SymbolId> symbols;
+	while (!tempStack.empty()) {
+		symbols.push_back(tempStack.top());
+		tempStack.pop();
+	}
+
+	std::stack<std::string> result;
+	for (auto it = symbols.rbegin(); it != symbols.rend(); ++it) {
+		result.push(SymbolTable::getSymbol(*it));
+	}
+	return result;
 }
 
 void PushdownAutomaton::setStack(std::stack<std::string> stack) {
-	this->stack = stack;
+	std::vector<std::string> symbols;
+	while (!stack.empty()) {
+		symbols.push_back(stack.top());
+		stack.pop();
+	}
+
+	this->stack = std::stack<SymbolId>();
+	for (auto it = symbols.rbegin(); it != symbols.rend(); ++it) {
+		this->stack.push(SymbolTable::intern(*it));
+	}
 }
 
 void PushdownAutomaton::pushStack(const std::string &symbol) {
@@ -155,7 +191,7 @@ void PushdownAutomaton::pushStack(const std::string &symbol) {
 		throw StackAlphabetSymbolNotFoundException("Symbol not in alphabet");
 	}
 
-	stack.push(symbol);
+	stack.push(SymbolTable::find(symbol));
 }
 
 std::string PushdownAutomaton::popStack() {
@@ -163,10 +199,10 @@ std::string PushdownAutomaton::popStack() {
 		return "";
 	}
 
-	const std::string &top = stack.top();
+	SymbolId top = stack.top();
 	stack.pop();
 
-	return top;
+	return SymbolTable::getSymbol(top);
 }
 
 std::string PushdownAutomaton::peekStack() const {
@@ -174,11 +210,11 @@ std::string PushdownAutomaton::peekStack() const {
 		return "";
 	}
 
-	return stack.top();
+	return SymbolTable::getSymbol(stack.top());
 }
 
 void PushdownAutomaton::resetStack() {
-	stack = std::stack<std::string>();
+	stack = std::stack<SymbolId>();
 }
 
 bool PushdownAutomaton::stateExists(const std::string &key) const {
@@ -186,11 +222,11 @@ bool PushdownAutomaton::stateExists(const std::string &key) const {
 }
 
 bool PushdownAutomaton::inputAlphabetSymbolExists(const std::string &symbol) const {
-	return inputAlphabet.find(symbol) != inputAlphabet.end();
+	return inputAlphabet.find(SymbolTable::find(symbol)) != inputAlphabet.end();
 }
 
 bool PushdownAutomaton::stackAlphabetSymbolExists(const std::string &symbol) const {
-	return stackAlphabet.find(symbol) != stackAlphabet.end();
+	return stackAlphabet.find(SymbolTable::find(symbol)) != stackAlphabet.end();
 }
 
 void PushdownAutomaton::addState(const std::string &label, const bool &isAccept) {
@@ -214,6 +250,7 @@ void PushdownAutomaton::addState(const std::string &label, const bool &isAccept)
 	// Update the vector and invalidate conversion cache
 	states[state.getKey()] = state;
 	statesCacheInvalidated = true;
+	definitionVersion++;
 }
 
 void PushdownAutomaton::updateStateLabel(const std::string &key, const std::string &label) {
@@ -222,18 +259,42 @@ void PushdownAutomaton::updateStateLabel(const std::string &key, const std::stri
 		throw InvalidAutomatonDefinitionException("State with label " + label + " already exists");
 	}
 
-	PDAState *state = getStateInternal(key);
+	// Move the state's node to the new key instead of copying it, so its transitions come along untouched
+	auto node = states.extract(key);
+	if (node.empty()) {
+		throw StateNotFoundException(key);
+	}
+	PDAState &state = node.mapped();
 
 	if (key == startState) {
 		startState = label;
 	}
 
-	state->setLabel(label);
+	// Relabelling changes the keys of the outgoing transitions, so reindex them under their new keys
+	for (const auto &transition : state.getTransitionsView()) {
+		unindexTransition(transition);
+	}
+	state.setLabel(label);
+	for (const auto &transition : state.getTransitionsView()) {
+		indexTransition(transition);
+	}
 
-	states[state->getKey()] = *state;
-	states.erase(key);
+	node.key() = label;
+	states.insert(std::move(node));
+
+	// Repoint the transitions leading into the state to the new label
+	std::unordered_set<TransitionKey> transitionKeys = std::move(incomingTransitions[key]);
+	incomingTransitions.erase(key);
+	for (const auto &transitionKey : transitionKeys) {
+		PDAState *fromState = getStateInternal(SymbolTable::getSymbol(transitionKey.fromState));
+		fromState->setTransitionToState(transitionKey, label);
+		indexTransition(fromState->getTransition(TransitionKey(transitionKey.fromState, SymbolTable::intern(label),
+		                                                       transitionKey.symbols[0], transitionKey.symbols[1],
+		                                                       transitionKey.symbols[2])));
+	}
 
 	statesCacheInvalidated = true;
+	definitionVersion++;
 }
 
 std::string PushdownAutomaton::getCurrentState() const {
@@ -269,6 +330,10 @@ PDAState PushdownAutomaton::getState(const std::string &key) const {
 }
 
 std::vector<PDAState> PushdownAutomaton::getStates() {
+	return getStatesView();
+}
+
+const std::vector<PDAState> &PushdownAutomaton::getStatesView() {
 	// if the conversion cache from unordered_map to vector is not valid then recompute
 	if (statesCacheInvalidated) {
 		cachedStates.clear();
@@ -289,18 +354,16 @@ void PushdownAutomaton::removeState(const std::string &key, const bool &strict)
 	std::vector<std::string> conflictingTransitions;
 
 	// Check for conflicting transitions
-	for (auto &pair : states) {
-		std::vector<PDATransition> transitions = pair.second.getTransitions();
-		for (const auto &transition : transitions) {
-			if (transition.getToStateKey() == key) {
-				if (strict) {
-					conflictingTransitions.push_back(transition.getKey());
-				} else {
-					pair.second.removeTransition(transition.getKey());
-				}
-			}
+	for (const auto &transitionKey : incomingTransitions[key]) {
+		if (strict) {
+			conflictingTransitions.push_back(PDATransition::generateTransitionKey(transitionKey));
+		} else {
+			getStateInternal(SymbolTable::getSymbol(transitionKey.fromState))->removeTransition(transitionKey);
 		}
 	}
+	if (!strict) {
+		incomingTransitions[key].clear();
+	}
 
 	// If strict mode is enabled and conflicts exist, throw an error
 	if (strict && !conflictingTransitions.empty()) {
@@ -314,6 +377,7 @@ void PushdownAutomaton::removeState(const std::string &key, const bool &strict)
 		throw InvalidAutomatonDefinitionException(conflictMessage);
 	}
 
+	unindexState(key);
 	states.erase(key);
 	if (key == startState) {
 		startState = "";
@@ -322,6 +386,7 @@ void PushdownAutomaton::removeState(const std::string &key, const bool &strict)
 		currentState = "";
 	}
 	statesCacheInvalidated = true;
+	definitionVersion++;
 }
 
 void PushdownAutomaton::removeStates(const std::vector<std::string> &keys, const bool &strict) {
@@ -347,18 +412,16 @@ void PushdownAutomaton::removeStates(const std::vector<std::string> &keys, const
 
 	// Check for conflicting transitions
 	for (const auto &key : keys) {
-		for (auto &pair : states) {
-			std::vector<PDATransition> transitions = pair.second.getTransitions();
-			for (const auto &transition : transitions) {
-				if (transition.getToStateKey() == key) {
-					if (strict) {
-						conflictingTransitions[key].push_back(transition.getKey());
-					} else {
-						pair.second.removeTransition(transition.getKey());
-					}
-				}
+		for (const auto &transitionKey : incomingTransitions[key]) {
+			if (strict) {
+				conflictingTransitions[key].push_back(PDATransition::generateTransitionKey(transitionKey));
+			} else {
+				getStateInternal(SymbolTable::getSymbol(transitionKey.fromState))->removeTransition(transitionKey);
 			}
 		}
+		if (!strict) {
+			incomingTransitions[key].clear();
+		}
 	}
 
 	// If strict mode is enabled and conflicts exist, throw an error
@@ -378,6 +441,7 @@ void PushdownAutomaton::removeStates(const std::vector<std::string> &keys, const
 
 	// Remove states
 	for (const auto &key : keys) {
+		unindexState(key);
 		states.erase(key);
 		if (key == startState) {
 			startState = "";
@@ -388,30 +452,32 @@ void PushdownAutomaton::removeStates(const std::vector<std::string> &keys, const
 	}
 
 	statesCacheInvalidated = true;
+	definitionVersion++;
 }
 
 void PushdownAutomaton::clearStates() {
 	states.clear();
+	incomingTransitions.clear();
 	currentState = "";
 	startState = "";
 	statesCacheInvalidated = true;
+	definitionVersion++;
 }
 
 void PushdownAutomaton::setInputAlphabet(const std::vector<std::string> &inputAlphabet, const bool &strict) {
 	std::unordered_map<std::string, std::vector<std::string>> conflictingTransitions;
-	std::unordered_set<std::string> newAlphabet =
-	    std::unordered_set<std::string>(inputAlphabet.begin(), inputAlphabet.end());
+	std::vector<SymbolId> newAlphabetIds = SymbolTable::intern(inputAlphabet);
+	std::unordered_set<SymbolId> newAlphabet = std::unordered_set<SymbolId>(newAlphabetIds.begin(), newAlphabetIds.end());
 
 	for (auto &pair : states) {
 		std::vector<PDATransition> transitions = pair.second.getTransitions();
 		for (const auto &transition : transitions) {
-			std::string symbol = transition.getInput();
-			bool found = newAlphabet.find(symbol) != newAlphabet.end();
+			bool found = newAlphabet.find(transition.getInputId()) != newAlphabet.end();
 			if (!found) {
 				if (strict) {
-					conflictingTransitions[symbol].push_back(transition.getKey());
+					conflictingTransitions[transition.getInput()].push_back(transition.getKey());
 				} else {
-					pair.second.removeTransition(transition.getKey());
+					removeTransitionInternal(pair.second, transition);
 				}
 			}
 		}
@@ -435,13 +501,15 @@ void PushdownAutomaton::setInputAlphabet(const std::vector<std::string> &inputAl
 
 	this->inputAlphabet = newAlphabet;
 	inputAlphabetCacheInvalidated = true;
+	definitionVersion++;
 }
 
 void PushdownAutomaton::addInputAlphabet(const std::vector<std::string> &inputAlphabet) {
 	for (const auto &symbol : inputAlphabet) {
-		this->inputAlphabet.insert(symbol);
+		this->inputAlphabet.insert(SymbolTable::intern(symbol));
 	}
 	inputAlphabetCacheInvalidated = true;
+	definitionVersion++;
 }
 
 std::vector<std::string> PushdownAutomaton::getInputAlphabet() {
@@ -449,7 +517,7 @@ std::vector<std::string> PushdownAutomaton::getInputAlphabet() {
 	if (inputAlphabetCacheInvalidated) {
 		cachedInputAlphabet.clear();
 		for (const auto &symbol : inputAlphabet) {
-			cachedInputAlphabet.push_back(symbol);
+			cachedInputAlphabet.push_back(SymbolTable::getSymbol(symbol));
 		}
 		inputAlphabetCacheInvalidated = false;
 	}
@@ -462,16 +530,17 @@ void PushdownAutomaton::removeInputAlphabetSymbol(const std::string &symbol, con
 		throw InputAlphabetSymbolNotFoundException(symbol);
 	}
 	std::vector<std::string> conflictingTransitions;
+	SymbolId symbolId = SymbolTable::find(symbol);
 
 	// Check for conflicting transitions
 	for (auto &pair : states) {
 		std::vector<PDATransition> transitions = pair.second.getTransitions();
 		for (const auto &transition : transitions) {
-			if (transition.getInput() == symbol) {
+			if (transition.getInputId() == symbolId) {
 				if (strict) {
 					conflictingTransitions.push_back(transition.getKey());
 				} else {
-					pair.second.removeTransition(transition.getKey());
+					removeTransitionInternal(pair.second, transition);
 				}
 			}
 		}
@@ -489,8 +558,9 @@ void PushdownAutomaton::removeInputAlphabetSymbol(const std::string &symbol, con
 		throw InvalidAutomatonDefinitionException(conflictMessage);
 	}
 
-	inputAlphabet.erase(symbol);
+	inputAlphabet.erase(symbolId);
 	inputAlphabetCacheInvalidated = true;
+	definitionVersion++;
 }
 
 void PushdownAutomaton::removeInputAlphabetSymbols(const std::vector<std::string> &symbols, const bool &strict) {
@@ -517,14 +587,15 @@ void PushdownAutomaton::removeInputAlphabetSymbols(const std::vector<std::string
 
 	// Check for conflicting transitions
 	for (const auto &symbol : symbols) {
+		SymbolId symbolId = SymbolTable::find(symbol);
 		for (auto &pair : states) {
 			std::vector<PDATransition> transitions = pair.second.getTransitions();
 			for (const auto &transition : transitions) {
-				if (transition.getInput() == symbol) {
+				if (transition.getInputId() == symbolId) {
 					if (strict) {
 						conflictingTransitions[symbol].push_back(transition.getKey());
 					} else {
-						pair.second.removeTransition(transition.getKey());
+						removeTransitionInternal(pair.second, transition);
 					}
 				}
 			}
@@ -548,21 +619,22 @@ void PushdownAutomaton::removeInputAlphabetSymbols(const std::vector<std::string
 
 	// If no missing symbols found then we remove
 	for (const auto &symbol : symbols) {
-		inputAlphabet.erase(symbol);
+		inputAlphabet.erase(SymbolTable::find(symbol));
 	}
 	inputAlphabetCacheInvalidated = true;
+	definitionVersion++;
 }
 
 void PushdownAutomaton::clearInputAlphabet(const bool &strict) {
 	for (auto &pair : states) {
 		std::vector<PDATransition> transitions = pair.second.getTransitions();
 		for (const auto &transition : transitions) {
-			if (!transition.getInput().empty()) {
+			if (transition.getInputId() != SymbolTable::EPSILON_SYMBOL_ID) {
 				if (strict) {
 					throw InvalidAutomatonDefinitionException(
 					    "Cannot clear input alphabet because non-epsilon transitions exist");
 				} else {
-					pair.second.removeTransition(transition.getKey());
+					removeTransitionInternal(pair.second, transition);
 				}
 			}
 		}
@@ -570,35 +642,36 @@ void PushdownAutomaton::clearInputAlphabet(const bool &strict) {
 
 	inputAlphabet.clear();
 	inputAlphabetCacheInvalidated = true;
+	definitionVersion++;
 }
 
 void PushdownAutomaton::setStackAlphabet(const std::vector<std::string> &stackAlphabet, const bool &strict) {
 	std::unordered_map<std::string, std::vector<std::string>> conflictingTransitions;
-	std::unordered_set<std::string> newAlphabet =
-	    std::unordered_set<std::string>(inputAlphabet.begin(), inputAlphabet.end());
+	std::vector<SymbolId> newAlphabetIds = SymbolTable::intern(stackAlphabet);
+	std::unordered_set<SymbolId> newAlphabet = std::unordered_set<SymbolId>(newAlphabetIds.begin(), newAlphabetIds.end());
 
 	for (auto &pair : states) {
 		std::vector<PDATransition> transitions = pair.second.getTransitions();
 		for (const auto &transition : transitions) {
-			const std::string &stackSymbol = transition.getStackSymbol();
-			bool found = newAlphabet.find(stackSymbol) != newAlphabet.end();
+			bool found = transition.getStackSymbolId() == SymbolTable::EPSILON_SYMBOL_ID ||
+			             newAlphabet.find(transition.getStackSymbolId()) != newAlphabet.end();
 			if (!found) {
 				if (strict) {
-					conflictingTransitions[stackSymbol].push_back(transition.getKey());
+					conflictingTransitions[transition.getStackSymbol()].push_back(transition.getKey());
 				} else {
-					pair.second.removeTransition(transition.getKey());
+					removeTransitionInternal(pair.second, transition);
 				}
 			}
 
 			// Check for push symbols
 			std::vector<std::string> pushSymbolsVec = parsePushSymbols(transition.getPushSymbol());
 			for (const auto &pushSymbol : pushSymbolsVec) {
-				found = newAlphabet.find(pushSymbol) != newAlphabet.end();
+				found = newAlphabet.find(SymbolTable::find(pushSymbol)) != newAlphabet.end();
 				if (!found) {
 					if (strict) {
 						conflictingTransitions[pushSymbol].push_back(transition.getKey());
 					} else {
-						pair.second.removeTransition(transition.getKey());
+						removeTransitionInternal(pair.second, transition);
 					}
 				}
 			}
@@ -621,15 +694,17 @@ void PushdownAutomaton::setStackAlphabet(const std::vector<std::string> &stackAl
 		    conflictMessage + " If you wish to delete these transitions, call the function again with strict=false.");
 	}
 
-	this->stackAlphabet = std::unordered_set<std::string>(stackAlphabet.begin(), stackAlphabet.end());
+	this->stackAlphabet = newAlphabet;
 	stackAlphabetCacheInvalidated = true;
+	definitionVersion++;
 }
 
 void PushdownAutomaton::addStackAlphabet(const std::vector<std::string> &stackAlphabet) {
 	for (const auto &symbol : stackAlphabet) {
-		this->stackAlphabet.insert(symbol);
+		this->stackAlphabet.insert(SymbolTable::intern(symbol));
 	}
 	stackAlphabetCacheInvalidated = true;
+	definitionVersion++;
 }
 
 std::vector<std::string> PushdownAutomaton::getStackAlphabet() {
@@ -637,7 +712,7 @@ std::vector<std::string> PushdownAutomaton::getStackAlphabet() {
 	if (stackAlphabetCacheInvalidated) {
 		cachedStackAlphabet.clear();
 		for (const auto &symbol : stackAlphabet) {
-			cachedStackAlphabet.push_back(symbol);
+			cachedStackAlphabet.push_back(SymbolTable::getSymbol(symbol));
 		}
 		stackAlphabetCacheInvalidated = false;
 	}
@@ -651,16 +726,17 @@ void PushdownAutomaton::removeStackAlphabetSymbol(const std::string &symbol, con
 	}
 
 	std::vector<std::string> conflictingTransitions;
+	SymbolId symbolId = SymbolTable::find(symbol);
 
 	// Check for conflicting transitions
 	for (auto &pair : states) {
 		std::vector<PDATransition> transitions = pair.second.getTransitions();
 		for (const auto &transition : transitions) {
-			if (transition.getStackSymbol() == symbol || transition.getPushSymbol() == symbol) {
+			if (transition.getStackSymbolId() == symbolId || transition.getPushSymbol() == symbol) {
 				if (strict) {
 					conflictingTransitions.push_back(transition.getKey());
 				} else {
-					pair.second.removeTransition(transition.getKey());
+					removeTransitionInternal(pair.second, transition);
 				}
 			}
 		}
@@ -678,8 +754,9 @@ void PushdownAutomaton::removeStackAlphabetSymbol(const std::string &symbol, con
 		throw InvalidAutomatonDefinitionException(conflictMessage);
 	}
 
-	stackAlphabet.erase(symbol);
+	stackAlphabet.erase(SymbolTable::find(symbol));
 	stackAlphabetCacheInvalidated = true;
+	definitionVersion++;
 }
 
 void PushdownAutomaton::removeStackAlphabetSymbols(const std::vector<std::string> &symbols, const bool &strict) {
@@ -705,14 +782,16 @@ void PushdownAutomaton::removeStackAlphabetSymbols(const std::vector<std::string
 
 	// If no missing symbols found then we remove
 	for (const auto &symbol : symbols) {
-		stackAlphabet.erase(symbol);
+		stackAlphabet.erase(SymbolTable::find(symbol));
 	}
 	stackAlphabetCacheInvalidated = true;
+	definitionVersion++;
 }
 
 void PushdownAutomaton::clearStackAlphabet(const bool &strict) {
 	stackAlphabet.clear();
 	stackAlphabetCacheInvalidated = true;
+	definitionVersion++;
 }
 
 std::string PushdownAutomaton::getStartState() const {
@@ -733,6 +812,7 @@ void PushdownAutomaton::setStartState(const std::string &key) {
 	if (currentState.empty()) {
 		currentState = key;
 	}
+	definitionVersion++;
 }
 
 PDATransition PushdownAutomaton::getTransition(const std::string &key) const {
@@ -746,7 +826,9 @@ void PushdownAutomaton::addTransition(const std::string &fromStateKey, const std
 	validateTransition(fromStateKey, toStateKey, input, stackSymbol, pushSymbol);
 	PDAState *state = getStateInternal(fromStateKey);
 	state->addTransition(toStateKey, input, stackSymbol, pushSymbol);
+	indexTransition(PDATransition(fromStateKey, toStateKey, input, stackSymbol, pushSymbol));
 	statesCacheInvalidated = true;
+	definitionVersion++;
 }
 
 void PushdownAutomaton::updateTransitionInput(const std::string &transitionKey, const std::string &input) {
@@ -773,8 +855,11 @@ void PushdownAutomaton::updateTransitionInput(const std::string &transitionKey,
 		throw TransitionNotFoundException(transitionKey);
 	}
 
+	unindexTransition(fromState->getTransition(transitionKey));
 	fromState->setTransitionInput(transitionKey, input);
+	indexTransition(fromState->getTransition(newTransitionKey));
 	statesCacheInvalidated = true;
+	definitionVersion++;
 }
 
 void PushdownAutomaton::updateTransitionFromState(const std::string &transitionKey, const std::string &fromStateKey) {
@@ -805,10 +890,12 @@ void PushdownAutomaton::updateTransitionFromState(const std::string &transitionK
 	PDAState *newFromState = getStateInternal(fromStateKey);
 
 	// Remove the transition from the old from state
-	oldFromState->removeTransition(transitionKey);
+	removeTransitionInternal(*oldFromState, oldFromState->getTransition(transitionKey));
 	// Add the transition to the new from state
 	newFromState->addTransition(toStateKey, input, stackSymbol, pushSymbol);
+	indexTransition(newFromState->getTransition(newTransitionKey));
 	statesCacheInvalidated = true;
+	definitionVersion++;
 }
 
 void PushdownAutomaton::updateTransitionToState(const std::string &transitionKey, const std::string &toStateKey) {
@@ -835,8 +922,11 @@ void PushdownAutomaton::updateTransitionToState(const std::string &transitionKey
 		throw TransitionNotFoundException(transitionKey);
 	}
 
+	unindexTransition(fromState->getTransition(transitionKey));
 	fromState->setTransitionToState(transitionKey, toStateKey);
+	indexTransition(fromState->getTransition(newTransitionKey));
 	statesCacheInvalidated = true;
+	definitionVersion++;
 }
 
 void PushdownAutomaton::updateTransitionStackSymbol(const std::string &transitionKey, const std::string &stackSymbol) {
@@ -863,8 +953,11 @@ void PushdownAutomaton::updateTransitionStackSymbol(const std::string &transitio
 		throw TransitionNotFoundException(transitionKey);
 	}
 
+	unindexTransition(fromState->getTransition(transitionKey));
 	fromState->setTransitionStackSymbol(transitionKey, stackSymbol);
+	indexTransition(fromState->getTransition(newTransitionKey));
 	statesCacheInvalidated = true;
+	definitionVersion++;
 }
 
 void PushdownAutomaton::updateTransitionPushSymbol(const std::string &transitionKey, const std::string &pushSymbol) {
@@ -891,35 +984,51 @@ void PushdownAutomaton::updateTransitionPushSymbol(const std::string &transition
 		throw TransitionNotFoundException(transitionKey);
 	}
 
+	unindexTransition(fromState->getTransition(transitionKey));
 	fromState->setTransitionPushSymbol(transitionKey, pushSymbol);
+	indexTransition(fromState->getTransition(newTransitionKey));
 	statesCacheInvalidated = true;
+	definitionVersion++;
 }
 
 void PushdownAutomaton::removeTransition(const std::string &transitionKey) {
 	std::string fromStateKey = PDATransition::getFromStateFromKey(transitionKey);
 
 	PDAState *fromState = getStateInternal(fromStateKey);
-	fromState->removeTransition(transitionKey);
+	removeTransitionInternal(*fromState, fromState->getTransition(transitionKey));
 	statesCacheInvalidated = true;
+	definitionVersion++;
 }
 
 void PushdownAutomaton::clearTransitionsBetween(const std::string &fromStateKey, const std::string &toStateKey) {
 	PDAState *fromState = getStateInternal(fromStateKey);
+	for (const auto &transition : fromState->getTransitionsView()) {
+		if (transition.getToStateKey() == toStateKey) {
+			unindexTransition(transition);
+		}
+	}
 	fromState->clearTransitionsTo(toStateKey);
 	statesCacheInvalidated = true;
+	definitionVersion++;
 }
 
 void PushdownAutomaton::clearStateTransitions(const std::string &key) {
 	PDAState *state = getStateInternal(key);
+	for (const auto &transition : state->getTransitionsView()) {
+		unindexTransition(transition);
+	}
 	state->clearTransitions();
 	statesCacheInvalidated = true;
+	definitionVersion++;
 }
 
 void PushdownAutomaton::clearTransitions() {
 	for (auto &pair : states) {
 		pair.second.clearTransitions();
 	}
+	incomingTransitions.clear();
 	statesCacheInvalidated = true;
+	definitionVersion++;
 }
 
 void PushdownAutomaton::addAcceptState(const std::string &stateKey) {
@@ -927,6 +1036,7 @@ void PushdownAutomaton::addAcceptState(const std::string &stateKey) {
 
 	state->setIsAccept(true);
 	statesCacheInvalidated = true;
+	definitionVersion++;
 }
 
 void PushdownAutomaton::addAcceptStates(const std::vector<std::string> &keys) {
@@ -954,6 +1064,7 @@ void PushdownAutomaton::addAcceptStates(const std::vector<std::string> &keys) {
 	}
 
 	statesCacheInvalidated = true;
+	definitionVersion++;
 }
 
 void PushdownAutomaton::removeAcceptState(const std::string &stateKey) {
@@ -961,6 +1072,7 @@ void PushdownAutomaton::removeAcceptState(const std::string &stateKey) {
 
 	state->setIsAccept(false);
 	statesCacheInvalidated = true;
+	definitionVersion++;
 }
 
 void PushdownAutomaton::removeAcceptStates(const std::vector<std::string> &keys) {
@@ -988,6 +1100,7 @@ void PushdownAutomaton::removeAcceptStates(const std::vector<std::string> &keys)
 	}
 
 	statesCacheInvalidated = true;
+	definitionVersion++;
 }
 
 void PushdownAutomaton::clearAcceptStates() {
@@ -995,6 +1108,7 @@ void PushdownAutomaton::clearAcceptStates() {
 		pair.second.setIsAccept(false);
 	}
 	statesCacheInvalidated = true;
+	definitionVersion++;
 }
 
 std::vector<PDAState> PushdownAutomaton::getAcceptStates() const {
@@ -1009,8 +1123,8 @@ std::vector<PDAState> PushdownAutomaton::getAcceptStates() const {
 
 void PushdownAutomaton::reset() {
 	currentState = startState;
-	stack = std::stack<std::string>();
-	stack.push(INITIAL_STACK_SYMBOL);
+	stack = std::stack<SymbolId>();
+	stack.push(SymbolTable::intern(INITIAL_STACK_SYMBOL));
 	inputHead = 0;
 }
 
@@ -1024,21 +1138,16 @@ bool PushdownAutomaton::checkNextState(const std::string &key) const {
 		throw StateNotFoundException(key);
 	}
 
-	const std::string &currentInput = getInput()[inputHead];
+	const SymbolId &currentInput = input[inputHead];
 
 	PDAState state = getState(currentState);
-	const std::vector<PDATransition> &transitions = state.getTransitions();
 
-	const std::string &stackTop = stack.empty() ? "" : stack.top();
-	for (const auto &transition : transitions) {
-		if (transition.getToStateKey() != key) {
-			continue;
-		}
-		if (transition.getStackSymbol() != stackTop && !transition.getStackSymbol().empty()) {
-			continue;
-		}
-		if (transition.getInput().empty() || transition.getInput() == currentInput) {
-			return true;
+	const SymbolId stackTop = stack.empty() ? SymbolTable::EPSILON_SYMBOL_ID : stack.top();
+	for (const auto *transitions : state.getCandidateTransitions(currentInput, stackTop)) {
+		for (const auto &transition : *transitions) {
+			if (transition.getToStateKey() == key) {
+				return true;
+			}
 		}
 	}
 	return false;
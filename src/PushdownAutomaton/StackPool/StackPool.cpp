@@ -0,0 +1,58 @@
+#include "AutomataSimulator/StackPool.h"
+#include <algorithm>
+
+StackPool::StackPool() {
+	nodes.push_back({SymbolTable::EPSILON_SYMBOL_ID, EMPTY_STACK, 0});
+}
+
+StackPool::StackId StackPool::push(const StackId &stack, const SymbolId &symbol) {
+	const uint64_t key = (static_cast<uint64_t>(stack) << 32) | symbol;
+	auto [it, inserted] = nodeIds.emplace(key, static_cast<StackId>(nodes.size()));
+	if (inserted) {
+		nodes.push_back({symbol, stack, nodes[stack].size + 1});
+	}
+	return it->second;
+}
+
+StackPool::StackId StackPool::push(const StackId &stack, const std::vector<SymbolId> &symbols) {
+	StackId result = stack;
+	for (const auto &symbol : symbols) {
+		result = push(result, symbol);
+	}
+	return result;
+}
+
+StackPool::StackId StackPool::pop(const StackId &stack) const {
+	return nodes[stack].below;
+}
+
+SymbolId StackPool::top(const StackId &stack) const {
+	return nodes[stack].symbol;
+}
+
+bool StackPool::empty(const StackId &stack) const {
+	return stack == EMPTY_STACK;
+}
+
+std::size_t StackPool::size(const StackId &stack) const {
+	return nodes[stack].size;
+}
+
+std::vector<SymbolId> StackPool::toVector(const StackId &stack) const {
+	std::vector<SymbolId> symbols;
+	symbols.reserve(nodes[stack].size);
+	for (StackId current = stack; current != EMPTY_STACK; current = nodes[current].below) {
+		symbols.push_back(nodes[current].symbol);
+	}
+	std::reverse(symbols.begin(), symbols.end());
+	return symbols;
+}
+
+std::size_t StackPool::getNodeCount() const {
+	return nodes.size();
+}
+
+void StackPool::clear() {
+	nodes.resize(1);
+	nodeIds.clear();
+}
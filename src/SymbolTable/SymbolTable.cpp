@@ -0,0 +1,165 @@
+#include "AutomataSimulator/SymbolTable.h"
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string_view>
+#include <unordered_map>
+
+namespace {
+struct SymbolStorage {
+	std::shared_mutex mutex;
+
+	// Deque keeps references to the stored strings stable as it grows, so the index can key on views into it
+	std::deque<std::string> symbols;
+	std::unordered_map<std::string_view, SymbolId> ids;
+
+	SymbolStorage() {
+		symbols.emplace_back("");
+		ids.emplace(symbols.back(), SymbolTable::EPSILON_SYMBOL_ID);
+	}
+};
+
+SymbolStorage &getStorage() {
+	static SymbolStorage storage;
+	return storage;
+}
+} // namespace
+
+SymbolId SymbolTable::intern(const std::string &symbol) {
+	SymbolStorage &storage = getStorage();
+	{
+		std::shared_lock<std::shared_mutex> lock(storage.mutex);
+		auto it = storage.ids.find(symbol);
+		if (it != storage.ids.end()) {
+			return it->second;
+		}
+	}
+
+	std::unique_lock<std::shared_mutex> lock(storage.mutex);
+	// Another thread may have interned the symbol between the two locks
+	auto it = storage.ids.find(symbol);
+	if (it != storage.ids.end()) {
+		return it->second;
+	}
+
+	SymbolId id = static_cast<SymbolId>(storage.symbols.size());
+	storage.symbols.push_back(symbol);
+	storage.ids.emplace(storage.symbols.back(), id);
+	return id;
+}
+
+std::vector<SymbolId> SymbolTable::intern(const std::vector<std::string> &symbols) {
+	std::vector<SymbolId> result;
+	result.reserve(symbols.size());
+	for (const auto &symbol : symbols) {
+		result.push_back(intern(symbol));
+	}
+	return result;
+}
+
+std::vector<std::vector<SymbolId>> SymbolTable::intern(const std::vector<std::vector<std::string>> &sequences) {
+	SymbolStorage &storage = getStorage();
+	std::vector<std::vector<SymbolId>> result(sequences.size());
+
+	// Most batches only hold known symbols, so try to resolve all of them under the shared lock first
+	{
+		std::shared_lock<std::shared_mutex> lock(storage.mutex);
+		bool allFound = true;
+		for (std::size_t i = 0; i < sequences.size() && allFound; i++) {
+			result[i].reserve(sequences[i].size());
+			for (const auto &symbol : sequences[i]) {
+				auto it = storage.ids.find(symbol);
+				if (it == storage.ids.end()) {
+					allFound = false;
+					break;
+				}
+				result[i].push_back(it->second);
+			}
+		}
+		if (allFound) {
+			return result;
+		}
+	}
+
+	std::unique_lock<std::shared_mutex> lock(storage.mutex);
+	for (std::size_t i = 0; i < sequences.size(); i++) {
+		result[i].clear();
+		result[i].reserve(sequences[i].size());
+		for (const auto &symbol : sequences[i]) {
+			auto it = storage.ids.find(symbol);
+			if (it == storage.ids.end()) {
+				SymbolId id = static_cast<SymbolId>(storage.symbols.size());
+				storage.symbols.push_back(symbol);
+				it = storage.ids.emplace(storage.symbols.back(), id).first;
+			}
+			result[i].push_back(it->second);
+		}
+	}
+	return result;
+}
+
+SymbolId SymbolTable::find(const std::string &symbol) {
+	SymbolStorage &storage = getStorage();
+	std::shared_lock<std::shared_mutex> lock(storage.mutex);
+	auto it = storage.ids.find(symbol);
+	return it == storage.ids.end() ? UNKNOWN_SYMBOL_ID : it->second;
+}
+
+std::vector<SymbolId> SymbolTable::find(const std::vector<std::string> &symbols) {
+	SymbolStorage &storage = getStorage();
+	std::shared_lock<std::shared_mutex> lock(storage.mutex);
+
+	std::vector<SymbolId> result;
+	result.reserve(symbols.size());
+	for (const auto &symbol : symbols) {
+		auto it = storage.ids.find(symbol);
+		result.push_back(it == storage.ids.end() ? UNKNOWN_SYMBOL_ID : it->second);
+	}
+	return result;
+}
+
+std::vector<std::vector<SymbolId>> SymbolTable::find(const std::vector<std::vector<std::string>> &sequences) {
+	SymbolStorage &storage = getStorage();
+	std::shared_lock<std::shared_mutex> lock(storage.mutex);
+
+	std::vector<std::vector<SymbolId>> result(sequences.size());
+	for (std::size_t i = 0; i < sequences.size(); i++) {
+		result[i].reserve(sequences[i].size());
+		for (const auto &symbol : sequences[i]) {
+			auto it = storage.ids.find(symbol);
+			result[i].push_back(it == storage.ids.end() ? UNKNOWN_SYMBOL_ID : it->second);
+		}
+	}
+	return result;
+}
+
+const std::string &SymbolTable::getSymbol(const SymbolId &id) {
+	SymbolStorage &storage = getStorage();
+	std::shared_lock<std::shared_mutex> lock(storage.mutex);
+	if (id >= storage.symbols.size()) {
+		throw std::out_of_range("Symbol id not interned: " + std::to_string(id));
+	}
+	return storage.symbols[id];
+}
+
+std::vector<std::string> SymbolTable::getSymbols(const std::vector<SymbolId> &ids) {
+	SymbolStorage &storage = getStorage();
+	std::shared_lock<std::shared_mutex> lock(storage.mutex);
+
+	std::vector<std::string> result;
+	result.reserve(ids.size());
+	for (const auto &id : ids) {
+		if (id >= storage.symbols.size()) {
+			throw std::out_of_range("Symbol id not interned: " + std::to_string(id));
+		}
+		result.push_back(storage.symbols[id]);
+	}
+	return result;
+}
+
+std::size_t SymbolTable::size() {
+	SymbolStorage &storage = getStorage();
+	std::shared_lock<std::shared_mutex> lock(storage.mutex);
+	return storage.symbols.size();
+}
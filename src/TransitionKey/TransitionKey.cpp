@@ -0,0 +1,62 @@
+#include "AutomataSimulator/TransitionKey.h"
+
+namespace {
+// Folds one id into the hash with the splitmix64 finalizer, so keys differing in any field spread over all bits
+uint64_t mix(uint64_t hash, const SymbolId &id) {
+	hash += 0x9e3779b97f4a7c15ULL + id;
+	hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebULL;
+	return hash ^ (hash >> 31);
+}
+} // namespace
+
+TransitionKey::TransitionKey()
+    : TransitionKey(SymbolTable::EPSILON_SYMBOL_ID, SymbolTable::EPSILON_SYMBOL_ID, SymbolTable::EPSILON_SYMBOL_ID) {}
+
+TransitionKey::TransitionKey(const SymbolId &fromState, const SymbolId &toState, const SymbolId &first,
+                             const SymbolId &second, const SymbolId &third)
+    : fromState(fromState), toState(toState), symbols{first, second, third}, hash(0) {
+	hash = mix(hash, fromState);
+	hash = mix(hash, toState);
+	for (const auto &symbol : symbols) {
+		hash = mix(hash, symbol);
+	}
+}
+
+std::string TransitionKey::joinParts(const std::vector<std::string> &parts) {
+	std::string key;
+	for (size_t i = 0; i < parts.size(); i++) {
+		if (i > 0) {
+			key += '-';
+		}
+		for (const char &c : parts[i]) {
+			if (c == '-' || c == '\\') {
+				key += '\\';
+			}
+			key += c;
+		}
+	}
+	return key;
+}
+
+std::vector<std::string> TransitionKey::splitParts(const std::string &key) {
+	std::vector<std::string> parts(1);
+	for (size_t i = 0; i < key.size(); i++) {
+		if (key[i] == '\\' && i + 1 < key.size()) {
+			parts.back() += key[++i];
+		} else if (key[i] == '-') {
+			parts.emplace_back();
+		} else {
+			parts.back() += key[i];
+		}
+	}
+	return parts;
+}
+
+bool TransitionKey::operator==(const TransitionKey &other) const {
+	return hash == other.hash && fromState == other.fromState && toState == other.toState && symbols == other.symbols;
+}
+
+bool TransitionKey::operator!=(const TransitionKey &other) const {
+	return !(*this == other);
+}
@@ -1,22 +1,27 @@
 #include "AutomataSimulator/DeterministicTuringMachine.h"
+#include "AutomataSimulator/BatchExecutor.h"
+#include <algorithm>
+#include <limits>
 
 DeterministicTuringMachine::~DeterministicTuringMachine() = default;
 
 bool DeterministicTuringMachine::checkTransitionDeterminisim(const std::string &fromStateKey,
                                                              const std::string &readSymbol) {
 	TMState *fromState = getStateInternal(fromStateKey);
+	SymbolId readSymbolId = SymbolTable::find(readSymbol);
+	const SymbolId epsilon = SymbolTable::EPSILON_SYMBOL_ID;
 
 	// Check if there's already a transition with the same input/read symbol
-	for (auto &transition : fromState->getTransitions()) {
+	for (auto &transition : fromState->getTransitionsView()) {
 		// For a DTM, we can't have multiple transitions with:
 		// 1. Same read symbol (or both epsilon)
-		if (transition.getReadSymbol() == readSymbol) {
+		if (transition.getReadSymbolId() == readSymbolId) {
 			return false;
 		}
 
 		// 2. Both a non-empty input and an epsilon transition
-		if ((transition.getReadSymbol().empty() && !readSymbol.empty()) ||
-		    (!transition.getReadSymbol().empty() && readSymbol.empty())) {
+		if ((transition.getReadSymbolId() == epsilon && readSymbolId != epsilon) ||
+		    (transition.getReadSymbolId() != epsilon && readSymbolId == epsilon)) {
 			return false;
 		}
 	}
@@ -81,18 +86,16 @@ bool DeterministicTuringMachine::processInput() {
 		throw InvalidAutomatonDefinitionException("Current state or start state must be set to run process input");
 	}
 
-	const std::string &inputSymbol = tape.read();
-
-	const std::vector<TMTransition> &transitions = getStateInternal(currentState)->getTransitions();
-	std::string tapeValue = tape.read();
+	const std::vector<TMTransition> &transitions = getStateInternal(currentState)->getTransitionsView();
+	SymbolId tapeValue = tape.readId();
 
 	for (const auto &transition : transitions) {
-		if (transition.getReadSymbol() != tapeValue && !transition.getReadSymbol().empty()) {
+		if (transition.getReadSymbolId() != tapeValue && transition.getReadSymbolId() != SymbolTable::EPSILON_SYMBOL_ID) {
 			continue;
 		}
 		// If the write symbol is not epsilon then write to the tape
-		if (!transition.getWriteSymbol().empty()) {
-			tape.write(transition.getWriteSymbol());
+		if (transition.getWriteSymbolId() != SymbolTable::EPSILON_SYMBOL_ID) {
+			tape.writeId(transition.getWriteSymbolId());
 		}
 		tape.move(transition.getDirection());
 		currentState = transition.getToStateKey();
@@ -108,26 +111,61 @@ bool DeterministicTuringMachine::simulate(const std::vector<std::string> &input,
 		throw InvalidStartStateException("Start state must be set to run simulate");
 	}
 
+	return simulateInput(SymbolTable::find(input), simulationDepth);
+}
+
+std::vector<bool> DeterministicTuringMachine::simulateBatch(const std::vector<std::vector<std::string>> &inputs,
+                                                            const int &simulationDepth) {
+	if (startState.empty()) {
+		throw InvalidStartStateException("Start state must be set to run simulate");
+	}
+
+	std::vector<std::vector<SymbolId>> inputIds = SymbolTable::find(inputs);
+	std::vector<bool> results(inputs.size());
+	for (std::size_t i = 0; i < inputs.size(); i++) {
+		results[i] = simulateInput(inputIds[i], simulationDepth);
+	}
+	return results;
+}
+
+std::vector<bool> DeterministicTuringMachine::simulateBatchParallel(const std::vector<std::vector<std::string>> &inputs,
+                                                                    const std::size_t &threadCount,
+                                                                    const int &simulationDepth) {
+	if (startState.empty()) {
+		throw InvalidStartStateException("Start state must be set to run simulate");
+	}
+
+	prepareConcurrentSimulation();
+	std::vector<std::vector<SymbolId>> inputIds = SymbolTable::find(inputs);
+
+	return BatchExecutor::runPredicate(inputs.size(), threadCount, [&](const std::size_t &i, const std::size_t &) {
+		return simulateInput(inputIds[i], simulationDepth);
+	});
+}
+
+bool DeterministicTuringMachine::simulateInput(const std::vector<SymbolId> &inputIds, const int &simulationDepth) {
 	int currentDepth = 0;
-	std::string simulationCurrentState = getStartState();
+	std::string simulationCurrentState = startState;
 	TMTape simulationTape;
-	simulationTape.loadInput(input);
+	simulationTape.setMode(tape.getMode());
+	simulationTape.loadInput(inputIds);
 
 	while (currentDepth <= simulationDepth) {
 		if (getStateInternal(simulationCurrentState)->getIsAccept()) {
 			return true;
 		}
 
-		const std::vector<TMTransition> &transitions = getStateInternal(simulationCurrentState)->getTransitions();
-		const std::string &tapeValue = simulationTape.read();
+		const std::vector<TMTransition> &transitions = getStateInternal(simulationCurrentState)->getTransitionsView();
+		SymbolId tapeValue = simulationTape.readId();
 
 		bool transitionFound = false;
 		for (const auto &transition : transitions) {
-			if (transition.getReadSymbol() != tapeValue && !transition.getReadSymbol().empty()) {
+			if (transition.getReadSymbolId() != tapeValue &&
+			    transition.getReadSymbolId() != SymbolTable::EPSILON_SYMBOL_ID) {
 				continue;
 			}
-			if (!transition.getWriteSymbol().empty()) {
-				simulationTape.write(transition.getWriteSymbol());
+			if (transition.getWriteSymbolId() != SymbolTable::EPSILON_SYMBOL_ID) {
+				simulationTape.writeId(transition.getWriteSymbolId());
 			}
 			simulationTape.move(transition.getDirection());
 			simulationCurrentState = transition.getToStateKey();
@@ -142,4 +180,163 @@ bool DeterministicTuringMachine::simulate(const std::vector<std::string> &input,
 	}
 
 	return getStateInternal(simulationCurrentState)->getIsAccept();
-}
\ No newline at end of file
+}
+const TMTransition *DeterministicTuringMachine::findTransition(TMState *state, const SymbolId &tapeValue) {
+	for (const auto &transition : state->getTransitionsView()) {
+		if (transition.getReadSymbolId() == tapeValue ||
+		    transition.getReadSymbolId() == SymbolTable::EPSILON_SYMBOL_ID) {
+			return &transition;
+		}
+	}
+	return nullptr;
+}
+
+SimulationResult DeterministicTuringMachine::simulateWithCycleDetection(const std::vector<std::string> &input,
+                                                                        const int &simulationDepth) {
+	if (startState.empty()) {
+		throw InvalidStartStateException("Start state must be set to run simulate");
+	}
+
+	std::string simulationCurrentState = startState;
+	TMTape simulationTape;
+	simulationTape.setMode(tape.getMode());
+	simulationTape.loadInput(SymbolTable::find(input));
+
+	// Brent's algorithm: each configuration is compared with a saved one, which moves to the current configuration
+	// whenever the distance between them reaches the next power of two
+	std::string savedState = simulationCurrentState;
+	TMTape savedTape = simulationTape;
+	uint64_t savedFingerprint = simulationTape.getFingerprint();
+	uint64_t power = 1;
+	uint64_t distance = 0;
+
+	for (int currentDepth = 0;; currentDepth++) {
+		TMState *state = getStateInternal(simulationCurrentState);
+		if (state->getIsAccept()) {
+			return SimulationResult::ACCEPTED;
+		}
+
+		const TMTransition *transition = findTransition(state, simulationTape.readId());
+		if (transition == nullptr) {
+			return SimulationResult::REJECTED;
+		}
+
+		// The configuration reached with the last transition of the budget is still checked, but not left
+		if (currentDepth > simulationDepth) {
+			return SimulationResult::OUT_OF_BUDGET;
+		}
+
+		if (transition->getWriteSymbolId() != SymbolTable::EPSILON_SYMBOL_ID) {
+			simulationTape.writeId(transition->getWriteSymbolId());
+		}
+		simulationTape.move(transition->getDirection());
+		simulationCurrentState = transition->getToStateKey();
+
+		// The fingerprint covers the cells and head position, so the cells are only compared when it matches
+		const uint64_t fingerprint = simulationTape.getFingerprint();
+		if (fingerprint == savedFingerprint && simulationCurrentState == savedState &&
+		    simulationTape.getHeadPosition() == savedTape.getHeadPosition() && simulationTape == savedTape) {
+			return SimulationResult::DIVERGES;
+		}
+		if (++distance == power) {
+			savedState = simulationCurrentState;
+			savedTape = simulationTape;
+			savedFingerprint = fingerprint;
+			power *= 2;
+			distance = 0;
+		}
+	}
+}
+
+bool DeterministicTuringMachine::simulateAccelerated(const std::vector<std::string> &input, const int &simulationDepth,
+                                                     uint64_t &stepCount) {
+	if (startState.empty()) {
+		throw InvalidStartStateException("Start state must be set to run simulate");
+	}
+
+	stepCount = 0;
+	std::string simulationCurrentState = startState;
+	TMTape simulationTape;
+	simulationTape.setMode(TMTapeMode::RUN_LENGTH);
+	simulationTape.loadInput(SymbolTable::find(input));
+
+	// Like simulate, up to simulationDepth + 1 transitions are taken before the last accept check
+	const uint64_t maxSteps = simulationDepth < 0 ? 0 : static_cast<uint64_t>(simulationDepth) + 1;
+	while (stepCount < maxSteps) {
+		TMState *state = getStateInternal(simulationCurrentState);
+		if (state->getIsAccept()) {
+			return true;
+		}
+
+		const SymbolId tapeValue = simulationTape.readId();
+		const TMTransition *match = findTransition(state, tapeValue);
+		if (match == nullptr) {
+			return false;
+		}
+
+		const SymbolId writeSymbol =
+		    match->getWriteSymbolId() == SymbolTable::EPSILON_SYMBOL_ID ? tapeValue : match->getWriteSymbolId();
+		const TMDirection direction = match->getDirection();
+		uint64_t count = 1;
+
+		if (match->getToStateKey() == simulationCurrentState) {
+			const int headPosition = simulationTape.getHeadPosition();
+			const uint64_t budget = maxSteps - stepCount;
+
+			// The head stays on a cell it leaves unchanged, so the machine repeats this step until the budget runs out
+			if (writeSymbol == tapeValue && (direction == TMDirection::STAY ||
+			                                 (direction == TMDirection::LEFT && simulationTape.isAtLeftEnd()))) {
+				stepCount = maxSteps;
+				break;
+			}
+
+			// The transition repeats on every cell of the run under the head. Past the last run of blanks the tape is
+			// blank forever, and at the left end the head stops on cell 0, which is left to a single step.
+			if (direction == TMDirection::RIGHT) {
+				count = tapeValue == simulationTape.getBlankSymbolId() && simulationTape.isHeadInLastRun()
+				            ? budget
+				            : simulationTape.getHeadRunExtent(TMDirection::RIGHT);
+				count = std::min<uint64_t>(count, std::numeric_limits<int>::max() - headPosition - 1);
+			} else if (direction == TMDirection::LEFT) {
+				const int extent = simulationTape.getHeadRunExtent(TMDirection::LEFT);
+				count = extent == headPosition + 1 ? std::max(1, extent - 1) : extent;
+			}
+			count = std::min(count, budget);
+		}
+
+		simulationTape.sweep(writeSymbol, direction, static_cast<int>(count));
+		simulationCurrentState = match->getToStateKey();
+		stepCount += count;
+	}
+
+	return getStateInternal(simulationCurrentState)->getIsAccept();
+}
+
+FrozenDTM DeterministicTuringMachine::freeze() {
+	if (startState.empty()) {
+		throw InvalidStartStateException("Start state must be set to freeze");
+	}
+
+	FrozenDTM frozen;
+
+	std::unordered_map<std::string, uint32_t> stateIndices;
+	for (const auto &[key, state] : states) {
+		stateIndices.emplace(key, static_cast<uint32_t>(frozen.stateLabels.size()));
+		frozen.stateLabels.push_back(key);
+		frozen.acceptStates.push_back(state.getIsAccept());
+	}
+	frozen.startState = stateIndices.at(startState);
+	frozen.tapeMode = tape.getMode();
+
+	// Transitions keep the order the machine tries them in, so the first match is the same
+	frozen.transitionOffsets.push_back(0);
+	for (const auto &key : frozen.stateLabels) {
+		for (const auto &transition : getStateInternal(key)->getTransitionsView()) {
+			frozen.transitions.push_back({transition.getReadSymbolId(), transition.getWriteSymbolId(),
+			                              transition.getDirection(), stateIndices.at(transition.getToStateKey())});
+		}
+		frozen.transitionOffsets.push_back(static_cast<uint32_t>(frozen.transitions.size()));
+	}
+
+	return frozen;
+}
@@ -0,0 +1,83 @@
+#include "AutomataSimulator/FrozenDTM.h"
+#include "AutomataSimulator/BatchExecutor.h"
+
+FrozenDTM::FrozenDTM() : startState(0), tapeMode(TMTapeMode::CONTIGUOUS) {}
+
+FrozenDTM::Context FrozenDTM::createContext(const std::vector<std::string> &input) const {
+	Context context{startState, TMTape("_", tapeMode)};
+	context.tape.loadInput(SymbolTable::find(input));
+	return context;
+}
+
+bool FrozenDTM::step(Context &context) const {
+	const SymbolId tapeValue = context.tape.readId();
+
+	for (uint32_t t = transitionOffsets[context.currentState]; t < transitionOffsets[context.currentState + 1]; t++) {
+		const Transition &transition = transitions[t];
+		if (transition.readSymbol != tapeValue && transition.readSymbol != SymbolTable::EPSILON_SYMBOL_ID) {
+			continue;
+		}
+		if (transition.writeSymbol != SymbolTable::EPSILON_SYMBOL_ID) {
+			context.tape.writeId(transition.writeSymbol);
+		}
+		context.tape.move(transition.direction);
+		context.currentState = transition.toState;
+		return true;
+	}
+	return false;
+}
+
+bool FrozenDTM::isAccepting(const Context &context) const {
+	return acceptStates[context.currentState];
+}
+
+std::string FrozenDTM::getCurrentState(const Context &context) const {
+	return stateLabels[context.currentState];
+}
+
+std::string FrozenDTM::getStartState() const {
+	return stateLabels[startState];
+}
+
+std::size_t FrozenDTM::getStateCount() const {
+	return stateLabels.size();
+}
+
+bool FrozenDTM::simulate(const std::vector<std::string> &input, const int &simulationDepth) const {
+	return simulateInput(SymbolTable::find(input), simulationDepth);
+}
+
+std::vector<bool> FrozenDTM::simulateBatch(const std::vector<std::vector<std::string>> &inputs,
+                                           const int &simulationDepth) const {
+	std::vector<std::vector<SymbolId>> inputIds = SymbolTable::find(inputs);
+	std::vector<bool> results(inputs.size());
+	for (std::size_t i = 0; i < inputs.size(); i++) {
+		results[i] = simulateInput(inputIds[i], simulationDepth);
+	}
+	return results;
+}
+
+std::vector<bool> FrozenDTM::simulateBatchParallel(const std::vector<std::vector<std::string>> &inputs,
+                                                   const std::size_t &threadCount, const int &simulationDepth) const {
+	std::vector<std::vector<SymbolId>> inputIds = SymbolTable::find(inputs);
+
+	return BatchExecutor::runPredicate(inputs.size(), threadCount, [&](const std::size_t &i, const std::size_t &) {
+		return simulateInput(inputIds[i], simulationDepth);
+	});
+}
+
+bool FrozenDTM::simulateInput(const std::vector<SymbolId> &inputIds, const int &simulationDepth) const {
+	Context context{startState, TMTape("_", tapeMode)};
+	context.tape.loadInput(inputIds);
+
+	for (int currentDepth = 0; currentDepth <= simulationDepth; currentDepth++) {
+		if (acceptStates[context.currentState]) {
+			return true;
+		}
+		if (!step(context)) {
+			return false;
+		}
+	}
+
+	return acceptStates[context.currentState];
+}
@@ -1,4 +1,6 @@
 #include "AutomataSimulator/NonDeterministicTuringMachine.h"
+#include "AutomataSimulator/BatchExecutor.h"
+#include "AutomataSimulator/TMConfigurationSet.h"
 
 NonDeterministicTuringMachine::~NonDeterministicTuringMachine() = default;
 
@@ -38,11 +40,12 @@ bool NonDeterministicTuringMachine::processInput() {
 	std::unordered_set<TMTransition> possibleTransitions;
 	std::unordered_set<std::string> newPossibleCurrentStates;
 
-	const std::vector<TMTransition> &transitions = getStateInternal(currentState)->getTransitions();
-	std::string inputSymbol = tape.read();
+	const std::vector<TMTransition> &transitions = getStateInternal(currentState)->getTransitionsView();
+	SymbolId inputSymbol = tape.readId();
 
 	for (const auto &transition : transitions) {
-		if (transition.getReadSymbol() != inputSymbol && !transition.getReadSymbol().empty()) {
+		if (transition.getReadSymbolId() != inputSymbol &&
+		    transition.getReadSymbolId() != SymbolTable::EPSILON_SYMBOL_ID) {
 			continue;
 		}
 		possibleTransitions.insert(transition);
@@ -59,8 +62,8 @@ bool NonDeterministicTuringMachine::processInput() {
 	currentState = transitionChosen.getToStateKey();
 
 	// If the write symbol is not epsilon then write to the tape
-	if (!transitionChosen.getWriteSymbol().empty()) {
-		tape.write(transitionChosen.getWriteSymbol());
+	if (transitionChosen.getWriteSymbolId() != SymbolTable::EPSILON_SYMBOL_ID) {
+		tape.writeId(transitionChosen.getWriteSymbolId());
 	}
 	tape.move(transitionChosen.getDirection());
 	currentState = transitionChosen.getToStateKey();
@@ -72,28 +75,44 @@ bool NonDeterministicTuringMachine::processInput() {
 	return getStateInternal(currentState)->getIsAccept();
 }
 
-struct Visited {
-	std::string state;
-	std::string tape;
+bool NonDeterministicTuringMachine::simulate(const std::vector<std::string> &input, const int &simulationDepth) {
+	if (startState.empty()) {
+		throw InvalidStartStateException("Start state must be set to run simulate");
+	}
 
-	bool operator==(const Visited &other) const {
-		return state == other.state && tape == other.tape;
+	return simulateInput(SymbolTable::find(input), simulationDepth);
+}
+
+std::vector<bool> NonDeterministicTuringMachine::simulateBatch(const std::vector<std::vector<std::string>> &inputs,
+                                                               const int &simulationDepth) {
+	if (startState.empty()) {
+		throw InvalidStartStateException("Start state must be set to run simulate");
 	}
-};
 
-namespace std {
-template <> struct hash<Visited> {
-	size_t operator()(const Visited &v) const {
-		return hash<std::string>()(v.state) ^ (hash<std::string>()(v.tape) << 1);
+	std::vector<std::vector<SymbolId>> inputIds = SymbolTable::find(inputs);
+	std::vector<bool> results(inputs.size());
+	for (std::size_t i = 0; i < inputs.size(); i++) {
+		results[i] = simulateInput(inputIds[i], simulationDepth);
 	}
-};
-} // namespace std
+	return results;
+}
 
-bool NonDeterministicTuringMachine::simulate(const std::vector<std::string> &input, const int &simulationDepth) {
+std::vector<bool>
+NonDeterministicTuringMachine::simulateBatchParallel(const std::vector<std::vector<std::string>> &inputs,
+                                                     const std::size_t &threadCount, const int &simulationDepth) {
 	if (startState.empty()) {
 		throw InvalidStartStateException("Start state must be set to run simulate");
 	}
 
+	prepareConcurrentSimulation();
+	std::vector<std::vector<SymbolId>> inputIds = SymbolTable::find(inputs);
+
+	return BatchExecutor::runPredicate(inputs.size(), threadCount, [&](const std::size_t &i, const std::size_t &) {
+		return simulateInput(inputIds[i], simulationDepth);
+	});
+}
+
+bool NonDeterministicTuringMachine::simulateInput(const std::vector<SymbolId> &inputIds, const int &simulationDepth) {
 	struct Branch {
 		std::string state;
 		TMTape tape;
@@ -101,47 +120,51 @@ bool NonDeterministicTuringMachine::simulate(const std::vector<std::string> &inp
 	};
 
 	std::queue<Branch> branches;
-	std::unordered_set<Visited> visited;
+	// Configurations are marked when queued, so each is expanded at most once and at its smallest depth
+	TMConfigurationSet visited;
 
+	// Branches copy the tape of their parent and the visited set keeps a copy of each, so contiguous tapes are
+	// simulated as chunked ones whose copies share every chunk but the ones written to
 	TMTape initialTape;
-	initialTape.loadInput(input);
+	initialTape.setMode(tape.getMode() == TMTapeMode::CONTIGUOUS ? TMTapeMode::CHUNKED : tape.getMode());
+	initialTape.loadInput(inputIds);
 
-	branches.push({getStartState(), initialTape, 0});
+	visited.insert(SymbolTable::find(startState), initialTape);
+	branches.push({startState, initialTape, 0});
 
 	while (!branches.empty()) {
-		Branch branch = branches.front();
+		Branch branch = std::move(branches.front());
 		branches.pop();
 
 		if (getStateInternal(branch.state)->getIsAccept()) {
 			return true;
 		}
 
-		visited.insert({branch.state, branch.tape.toString()});
-
 		if (branch.depth >= simulationDepth) {
 			continue;
 		}
 
-		const std::string &tapeValue = branch.tape.read();
+		SymbolId tapeValue = branch.tape.readId();
 
-		const std::vector<TMTransition> &transitions = getStateInternal(branch.state)->getTransitions();
+		const std::vector<TMTransition> &transitions = getStateInternal(branch.state)->getTransitionsView();
 
 		for (const auto &transition : transitions) {
-			if (transition.getReadSymbol() != tapeValue && !transition.getReadSymbol().empty()) {
+			if (transition.getReadSymbolId() != tapeValue &&
+			    transition.getReadSymbolId() != SymbolTable::EPSILON_SYMBOL_ID) {
 				continue;
 			}
 
 			TMTape branchTape = branch.tape;
-			if (!transition.getWriteSymbol().empty()) {
-				branchTape.write(transition.getWriteSymbol());
+			if (transition.getWriteSymbolId() != SymbolTable::EPSILON_SYMBOL_ID) {
+				branchTape.writeId(transition.getWriteSymbolId());
 			}
 			branchTape.move(transition.getDirection());
 
-			if (visited.find({transition.getToStateKey(), branchTape.toString()}) != visited.end()) {
+			if (!visited.insert(transition.getTransitionKey().toState, branchTape)) {
 				continue;
 			}
 
-			branches.push({transition.getToStateKey(), branchTape, branch.depth + 1});
+			branches.push({transition.getToStateKey(), std::move(branchTape), branch.depth + 1});
 		}
 	}
 
@@ -0,0 +1,77 @@
+#include "AutomataSimulator/TMConfigurationSet.h"
+
+namespace {
+// Number of slots of a new set
+constexpr std::size_t INITIAL_SLOT_COUNT = 64;
+} // namespace
+
+TMConfigurationSet::TMConfigurationSet() : slots(INITIAL_SLOT_COUNT, {0, 0}) {}
+
+uint64_t TMConfigurationSet::fingerprint(const SymbolId &state, const TMTape &tape) {
+	uint64_t value = tape.getFingerprint() ^ (static_cast<uint64_t>(state) * 0x9e3779b97f4a7c15ULL);
+	value = (value ^ (value >> 32)) * 0xd6e8feb86659fd93ULL;
+	return value ^ (value >> 32);
+}
+
+std::size_t TMConfigurationSet::findSlot(const uint64_t &fingerprint, const SymbolId &state,
+                                         const TMTape &tape) const {
+	const std::size_t mask = slots.size() - 1;
+	for (std::size_t i = fingerprint & mask;; i = (i + 1) & mask) {
+		const Slot &slot = slots[i];
+		if (slot.entry == 0) {
+			return i;
+		}
+		// Only a matching fingerprint needs the configurations compared
+		if (slot.fingerprint == fingerprint) {
+			const Entry &entry = entries[slot.entry - 1];
+			if (entry.state == state && entry.tape == tape) {
+				return i;
+			}
+		}
+	}
+}
+
+void TMConfigurationSet::grow() {
+	std::vector<Slot> oldSlots(slots.size() * 2, {0, 0});
+	oldSlots.swap(slots);
+
+	const std::size_t mask = slots.size() - 1;
+	for (const auto &slot : oldSlots) {
+		if (slot.entry == 0) {
+			continue;
+		}
+		std::size_t i = slot.fingerprint & mask;
+		while (slots[i].entry != 0) {
+			i = (i + 1) & mask;
+		}
+		slots[i] = slot;
+	}
+}
+
+bool TMConfigurationSet::insert(const SymbolId &state, const TMTape &tape) {
+	const uint64_t value = fingerprint(state, tape);
+	std::size_t i = findSlot(value, state, tape);
+	if (slots[i].entry != 0) {
+		return false;
+	}
+
+	entries.push_back({state, tape});
+	slots[i] = {value, static_cast<uint32_t>(entries.size())};
+	if (entries.size() * 2 > slots.size()) {
+		grow();
+	}
+	return true;
+}
+
+bool TMConfigurationSet::contains(const SymbolId &state, const TMTape &tape) const {
+	return slots[findSlot(fingerprint(state, tape), state, tape)].entry != 0;
+}
+
+std::size_t TMConfigurationSet::size() const {
+	return entries.size();
+}
+
+void TMConfigurationSet::clear() {
+	slots.assign(slots.size(), {0, 0});
+	entries.clear();
+}
@@ -7,7 +7,7 @@ TMState::TMState(const std::string &label, const bool &isAccept)
 
 TMState::TMState(const TMState &other)
     : key(other.key), label(other.label), isAccept(other.isAccept), transitions(other.transitions),
-      transitionsCacheInvalidated(other.transitionsCacheInvalidated) {}
+      transitionsCacheInvalidated(true) {}
 
 TMState &TMState::operator=(const TMState &other) {
 	if (this != &other) {
@@ -15,14 +15,14 @@ TMState &TMState::operator=(const TMState &other) {
 		label = other.label;
 		isAccept = other.isAccept;
 		transitions = other.transitions;
-		transitionsCacheInvalidated = other.transitionsCacheInvalidated;
+		transitionsCacheInvalidated = true;
 	}
 	return *this;
 }
 
 TMState::TMState(TMState &&other) noexcept
     : key(std::move(other.key)), label(std::move(other.label)), isAccept(other.isAccept),
-      transitions(std::move(other.transitions)), transitionsCacheInvalidated(other.transitionsCacheInvalidated) {}
+      transitions(std::move(other.transitions)), transitionsCacheInvalidated(true) {}
 
 TMState &TMState::operator=(TMState &&other) noexcept {
 	if (this != &other) {
@@ -30,7 +30,7 @@ TMState &TMState::operator=(TMState &&other) noexcept {
 		label = std::move(other.label);
 		isAccept = other.isAccept;
 		transitions = std::move(other.transitions);
-		transitionsCacheInvalidated = other.transitionsCacheInvalidated;
+		transitionsCacheInvalidated = true;
 	}
 	return *this;
 }
@@ -42,7 +42,7 @@ bool TMState::operator==(const TMState &other) const {
 TMState::~TMState() {}
 
 TMTransition *TMState::getTransitionInternal(const std::string &key) {
-	auto it = transitions.find(key);
+	auto it = transitions.find(TMTransition::parseTransitionKey(key));
 	if (it == transitions.end()) {
 		throw TransitionNotFoundException(key);
 	}
@@ -50,6 +50,10 @@ TMTransition *TMState::getTransitionInternal(const std::string &key) {
 }
 
 bool TMState::transitionExists(const std::string &key) const {
+	return transitionExists(TMTransition::parseTransitionKey(key));
+}
+
+bool TMState::transitionExists(const TransitionKey &key) const {
 	return transitions.find(key) != transitions.end();
 }
 
@@ -61,13 +65,13 @@ void TMState::setLabel(const std::string &label) {
 	this->label = label;
 	this->key = label;
 
-	std::unordered_map<std::string, TMTransition> newTransitions;
+	std::unordered_map<TransitionKey, TMTransition> newTransitions;
 
 	// Loop over all transitions to update their from state key.
 	for (const auto &pair : transitions) {
 		TMTransition transition = pair.second;
 		transition.setFromStateKey(key);
-		newTransitions[transition.getKey()] = transition;
+		newTransitions[transition.getTransitionKey()] = transition;
 	}
 	transitions = newTransitions;
 	transitionsCacheInvalidated = true;
@@ -87,57 +91,58 @@ bool TMState::getIsAccept() const {
 
 void TMState::addTransition(const std::string &toStateKey, const std::string &readSymbol,
                             const std::string &writeSymbol, const TMDirection &direction) {
-	std::string transitionKey =
-	    TMTransition::generateTransitionKey(key, toStateKey, readSymbol, writeSymbol, direction);
+	TMTransition transition = TMTransition(key, toStateKey, readSymbol, writeSymbol, direction);
 
 	// Check if transition already exists
-	if (transitionExists(transitionKey)) {
+	if (transitionExists(transition.getTransitionKey())) {
 		throw InvalidTransitionException("Transition already exists: " + key + " -> " + toStateKey +
 		                                 " | read symbol: " + readSymbol + " | write symbol: " + writeSymbol +
 		                                 " | direction: " + TMDirectionHelper::toString(direction));
 	}
 
-	TMTransition transition = TMTransition(key, toStateKey, readSymbol, writeSymbol, direction);
-	transitions[transition.getKey()] = transition;
+	transitions[transition.getTransitionKey()] = transition;
 	transitionsCacheInvalidated = true;
 }
 
 TMTransition TMState::getTransition(const std::string &key) {
+	return *getTransitionInternal(key);
+}
+
+TMTransition TMState::getTransition(const TransitionKey &key) {
 	auto it = transitions.find(key);
 	// Check if state exists
 	if (it == transitions.end()) {
-		throw TransitionNotFoundException(key);
+		throw TransitionNotFoundException(TMTransition::generateTransitionKey(key));
 	}
 	return it->second;
 }
 
+void TMState::replaceTransition(const TransitionKey &transitionKey, const TMTransition &transition) {
+	transitions.erase(transitionKey);
+	transitions[transition.getTransitionKey()] = transition;
+	transitionsCacheInvalidated = true;
+}
+
 void TMState::setTransitionToState(const std::string &transitionKey, const std::string &toStateKey) {
 	if (!transitionExists(transitionKey)) {
 		throw TransitionNotFoundException(transitionKey);
 	}
+	setTransitionToState(TMTransition::parseTransitionKey(transitionKey), toStateKey);
+}
 
-	std::string newTransitionKey = TMTransition::generateTransitionKey(
-	    key, toStateKey, getTransitionReadSymbol(transitionKey), getTransitionWriteSymbol(transitionKey),
-	    getTransitionDirection(transitionKey));
+void TMState::setTransitionToState(const TransitionKey &transitionKey, const std::string &toStateKey) {
+	TMTransition transition = getTransition(transitionKey);
+	transition.setToStateKey(toStateKey);
 
 	// Check if transition already exists
-	if (transitionExists(newTransitionKey)) {
-		std::string readSymbol = TMTransition::getReadSymbolFromKey(transitionKey);
-		std::string writeSymbol = TMTransition::getWriteSymbolFromKey(transitionKey);
-		TMDirection direction = TMTransition::getDirectionFromKey(transitionKey);
-
-		throw InvalidTransitionException("Transition already exists: " + key + " -> " + toStateKey +
-		                                 " | read symbol: " + readSymbol + " | write symbol: " + writeSymbol +
-		                                 " | direction: " + TMDirectionHelper::toString(direction));
+	if (transitionExists(transition.getTransitionKey())) {
+		throw InvalidTransitionException("Transition already exists: " + key + " -> " + transition.getToStateKey() +
+		                                 " | read symbol: " + transition.getReadSymbol() +
+		                                 " | write symbol: " + transition.getWriteSymbol() +
+		                                 " | direction: " + TMDirectionHelper::toString(transition.getDirection()));
 	}
 
-	TMTransition *transition = getTransitionInternal(transitionKey);
-	transition->setToStateKey(toStateKey);
-
-	transitions[newTransitionKey] = *transition;
-	transitions.erase(transitionKey);
-
-	transitionsCacheInvalidated = true;
+	replaceTransition(transitionKey, transition);
 }
 
 std::string TMState::getTransitionToState(const std::string &transitionKey) {
@@ -151,28 +156,18 @@ std::string TMState::getTransitionReadSymbol(const std::string &transitionKey) {
 }
 
 void TMState::setTransitionReadSymbol(const std::string &transitionKey, const std::string &stackSymbol) {
-	if (!transitionExists(transitionKey)) {
-		throw TransitionNotFoundException(transitionKey);
-	}
-
-	std::string newTransitionKey = TMTransition::generateTransitionKey(
-	    key, getTransitionToState(transitionKey), stackSymbol, getTransitionWriteSymbol(transitionKey),
-	    getTransitionDirection(transitionKey));
+	TMTransition transition = *getTransitionInternal(transitionKey);
+	transition.setReadSymbol(stackSymbol);
 
 	// Check if transition already exists
-	if (transitionExists(newTransitionKey)) {
-		throw InvalidTransitionException("Transition already exists: " + key + " -> " +
-		                                 getTransitionToState(transitionKey) + ", " +
-		                                 TMDirectionHelper::toString(getTransitionDirection(transitionKey)));
-		;
+	if (transitionExists(transition.getTransitionKey())) {
+		throw InvalidTransitionException("Transition already exists: " + key + " -> " + transition.getToStateKey() +
+		                                 " | read symbol: " + transition.getReadSymbol() +
+		                                 " | write symbol: " + transition.getWriteSymbol() +
+		                                 " | direction: " + TMDirectionHelper::toString(transition.getDirection()));
 	}
-	TMTransition *transition = getTransitionInternal(transitionKey);
-	transition->setReadSymbol(stackSymbol);
 
-	transitions[newTransitionKey] = *transition;
-	transitions.erase(transitionKey);
-
-	transitionsCacheInvalidated = true;
+	replaceTransition(TMTransition::parseTransitionKey(transitionKey), transition);
 }
 
 std::string TMState::getTransitionWriteSymbol(const std::string &transitionKey) {
@@ -181,32 +176,18 @@ std::string TMState::getTransitionWriteSymbol(const std::string &transitionKey)
 }
 
 void TMState::setTransitionWriteSymbol(const std::string &transitionKey, const std::string &pushSymbol) {
-	if (!transitionExists(transitionKey)) {
-		throw TransitionNotFoundException(transitionKey);
-	}
-
-	std::string newTransitionKey = TMTransition::generateTransitionKey(
-	    key, getTransitionToState(transitionKey), getTransitionReadSymbol(transitionKey), pushSymbol,
-	    getTransitionDirection(transitionKey));
+	TMTransition transition = *getTransitionInternal(transitionKey);
+	transition.setWriteSymbol(pushSymbol);
 
 	// Check if transition already exists
-	if (transitionExists(newTransitionKey)) {
-		std::string toStateKey = TMTransition::getToStateFromKey(transitionKey);
-		std::string readSymbol = TMTransition::getReadSymbolFromKey(transitionKey);
-		std::string writeSymbol = TMTransition::getWriteSymbolFromKey(transitionKey);
-		TMDirection direction = TMTransition::getDirectionFromKey(transitionKey);
-
-		throw InvalidTransitionException("Transition already exists: " + key + " -> " + toStateKey +
-		                                 " | read symbol: " + readSymbol + " | write symbol: " + writeSymbol +
-		                                 " | direction: " + TMDirectionHelper::toString(direction));
+	if (transitionExists(transition.getTransitionKey())) {
+		throw InvalidTransitionException("Transition already exists: " + key + " -> " + transition.getToStateKey() +
+		                                 " | read symbol: " + transition.getReadSymbol() +
+		                                 " | write symbol: " + transition.getWriteSymbol() +
+		                                 " | direction: " + TMDirectionHelper::toString(transition.getDirection()));
 	}
-	TMTransition *transition = getTransitionInternal(transitionKey);
-	transition->setWriteSymbol(pushSymbol);
-
-	transitions[newTransitionKey] = *transition;
-	transitions.erase(transitionKey);
 
-	transitionsCacheInvalidated = true;
+	replaceTransition(TMTransition::parseTransitionKey(transitionKey), transition);
 }
 
 TMDirection TMState::getTransitionDirection(const std::string &transitionKey) {
@@ -215,33 +196,25 @@ TMDirection TMState::getTransitionDirection(const std::string &transitionKey) {
 }
 
 void TMState::setTransitionDirection(const std::string &transitionKey, const TMDirection &direction) {
-	if (!transitionExists(transitionKey)) {
-		throw TransitionNotFoundException(transitionKey);
-	}
-	std::string newTransitionKey = TMTransition::generateTransitionKey(
-	    key, getTransitionToState(transitionKey), getTransitionReadSymbol(transitionKey),
-	    getTransitionWriteSymbol(transitionKey), direction);
+	TMTransition transition = *getTransitionInternal(transitionKey);
+	transition.setDirection(direction);
 
 	// Check if transition already exists
-	if (transitionExists(newTransitionKey)) {
-		std::string toStateKey = TMTransition::getToStateFromKey(transitionKey);
-		std::string readSymbol = TMTransition::getReadSymbolFromKey(transitionKey);
-		std::string writeSymbol = TMTransition::getWriteSymbolFromKey(transitionKey);
-
-		throw InvalidTransitionException("Transition already exists: " + key + " -> " + toStateKey +
-		                                 " | read symbol: " + readSymbol + " | write symbol: " + writeSymbol +
-		                                 " | direction: " + TMDirectionHelper::toString(direction));
+	if (transitionExists(transition.getTransitionKey())) {
+		throw InvalidTransitionException("Transition already exists: " + key + " -> " + transition.getToStateKey() +
+		                                 " | read symbol: " + transition.getReadSymbol() +
+		                                 " | write symbol: " + transition.getWriteSymbol() +
+		                                 " | direction: " + TMDirectionHelper::toString(transition.getDirection()));
 	}
-	TMTransition *transition = getTransitionInternal(transitionKey);
-	transition->setDirection(direction);
-
-	transitions[newTransitionKey] = *transition;
-	transitions.erase(transitionKey);
 
-	transitionsCacheInvalidated = true;
+	replaceTransition(TMTransition::parseTransitionKey(transitionKey), transition);
 }
 
 std::vector<TMTransition> TMState::getTransitions() {
+	return getTransitionsView();
+}
+
+const std::vector<TMTransition> &TMState::getTransitionsView() {
 	if (transitionsCacheInvalidated) {
 		cachedTransitions.clear();
 		for (const auto &pair : transitions) {
@@ -256,7 +229,13 @@ void TMState::removeTransition(const std::string &transitionKey) {
 	if (!transitionExists(transitionKey)) {
 		throw TransitionNotFoundException(transitionKey);
 	}
-	transitions.erase(transitionKey);
+	removeTransition(TMTransition::parseTransitionKey(transitionKey));
+}
+
+void TMState::removeTransition(const TransitionKey &transitionKey) {
+	if (transitions.erase(transitionKey) == 0) {
+		throw TransitionNotFoundException(TMTransition::generateTransitionKey(transitionKey));
+	}
 	transitionsCacheInvalidated = true;
 }
 
@@ -1,94 +1,421 @@
 #include "AutomataSimulator/TMTape.h"
+#include <algorithm>
+#include <functional>
 #include <sstream>
 
-TMTape::TMTape() : blankSymbol("_"), headIndex(0) {
-	tape.push_back(blankSymbol);
-	head = tape.begin();
+namespace {
+// Folds a value into a running hash
+void combineHash(std::size_t &hashValue, const std::size_t &value) {
+	hashValue ^= value + 0x9e3779b9 + (hashValue << 6) + (hashValue >> 2);
+}
+
+// Arithmetic modulo the Mersenne prime 2^61 - 1 for the content hash, without 128-bit integers
+constexpr uint64_t MODULUS = (1ULL << 61) - 1;
+constexpr uint64_t BASE = 0x1d8e4e27c47d124fULL % MODULUS;
+
+uint64_t reduce(const uint64_t &value) {
+	uint64_t result = (value & MODULUS) + (value >> 61);
+	return result >= MODULUS ? result - MODULUS : result;
+}
+
+uint64_t addMod(const uint64_t &a, const uint64_t &b) {
+	return reduce(a + b);
+}
+
+uint64_t subMod(const uint64_t &a, const uint64_t &b) {
+	return reduce(a + MODULUS - b);
+}
+
+uint64_t mulMod(const uint64_t &a, const uint64_t &b) {
+	const uint64_t aHigh = a >> 31, aLow = a & ((1ULL << 31) - 1);
+	const uint64_t bHigh = b >> 31, bLow = b & ((1ULL << 31) - 1);
+	const uint64_t middle = aLow * bHigh + aHigh * bLow;
+	return reduce(aHigh * bHigh * 2 + (middle >> 30) + ((middle & ((1ULL << 30) - 1)) << 31) + reduce(aLow * bLow));
+}
+
+uint64_t powMod(uint64_t base, uint64_t exponent) {
+	uint64_t result = 1;
+	while (exponent > 0) {
+		if (exponent & 1) {
+			result = mulMod(result, base);
+		}
+		base = mulMod(base, base);
+		exponent >>= 1;
+	}
+	return result;
+}
+
+// The inverse of BASE, to move the head power one cell left
+const uint64_t &inverseBase() {
+	static const uint64_t inverse = powMod(BASE, MODULUS - 2);
+	return inverse;
+}
+
+// The inverse of BASE - 1, to sum the powers of BASE over a run
+const uint64_t &inverseBaseMinusOne() {
+	static const uint64_t inverse = powMod(BASE - 1, MODULUS - 2);
+	return inverse;
 }
 
-TMTape::TMTape(std::string blankSymbol) : blankSymbol(blankSymbol), headIndex(0) {
+// The sum of BASE^i over the cells [start, start + length) of a run, BASE^start * (BASE^length - 1) / (BASE - 1)
+uint64_t runPowers(const uint64_t &start, const uint64_t &length) {
+	return mulMod(mulMod(powMod(BASE, start), subMod(powMod(BASE, length), 1)), inverseBaseMinusOne());
+}
+
+// Spreads the bits of a value, splitmix64 finalizer
+uint64_t mix(uint64_t value) {
+	value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+	return value ^ (value >> 31);
+}
+} // namespace
+
+TMTape::TMTape()
+    : mode(TMTapeMode::CONTIGUOUS), chunkedSize(0), runsSize(0), headIndex(0), headRun(0), headOffset(0),
+      blankSymbol(SymbolTable::intern("_")), contentHash(0), headPower(1) {
 	tape.push_back(blankSymbol);
-	head = tape.begin();
 }
 
-TMTape::TMTape(const TMTape &other) : tape(other.tape), blankSymbol(other.blankSymbol), headIndex(other.headIndex) {
-	head = tape.begin();
-	std::advance(head, headIndex);
+TMTape::TMTape(std::string blankSymbol)
+    : mode(TMTapeMode::CONTIGUOUS), chunkedSize(0), runsSize(0), headIndex(0), headRun(0), headOffset(0),
+      blankSymbol(SymbolTable::intern(blankSymbol)), contentHash(0), headPower(1) {
+	tape.push_back(this->blankSymbol);
+}
+
+TMTape::TMTape(std::string blankSymbol, const TMTapeMode &mode) : TMTape(blankSymbol) {
+	setMode(mode);
 }
 
+TMTape::TMTape(const TMTape &other)
+    : mode(other.mode), tape(other.tape), runs(other.runs), chunks(other.chunks), chunkedSize(other.chunkedSize),
+      runsSize(other.runsSize), headIndex(other.headIndex), headRun(other.headRun), headOffset(other.headOffset),
+      blankSymbol(other.blankSymbol), contentHash(other.contentHash), headPower(other.headPower) {}
+
 TMTape &TMTape::operator=(const TMTape &other) {
 	if (this != &other) {
+		mode = other.mode;
 		tape = other.tape;
+		runs = other.runs;
+		chunks = other.chunks;
+		chunkedSize = other.chunkedSize;
+		runsSize = other.runsSize;
 		blankSymbol = other.blankSymbol;
 		headIndex = other.headIndex;
-		head = tape.begin();
-		std::advance(head, headIndex);
+		headRun = other.headRun;
+		headOffset = other.headOffset;
+		contentHash = other.contentHash;
+		headPower = other.headPower;
 	}
 	return *this;
 }
 
 TMTape::TMTape(TMTape &&other) noexcept
-    : tape(std::move(other.tape)), blankSymbol(std::move(other.blankSymbol)), headIndex(other.headIndex) {
-	head = tape.begin();
-	std::advance(head, headIndex);
-}
+    : mode(other.mode), tape(std::move(other.tape)), runs(std::move(other.runs)), chunks(std::move(other.chunks)),
+      chunkedSize(other.chunkedSize), runsSize(other.runsSize), headIndex(other.headIndex), headRun(other.headRun),
+      headOffset(other.headOffset), blankSymbol(other.blankSymbol), contentHash(other.contentHash),
+      headPower(other.headPower) {}
 
 TMTape &TMTape::operator=(TMTape &&other) noexcept {
 	if (this != &other) {
+		mode = other.mode;
 		tape = std::move(other.tape);
-		blankSymbol = std::move(other.blankSymbol);
+		runs = std::move(other.runs);
+		chunks = std::move(other.chunks);
+		chunkedSize = other.chunkedSize;
+		runsSize = other.runsSize;
+		blankSymbol = other.blankSymbol;
 		headIndex = other.headIndex;
-		head = tape.begin();
-		std::advance(head, headIndex);
+		headRun = other.headRun;
+		headOffset = other.headOffset;
+		contentHash = other.contentHash;
+		headPower = other.headPower;
 	}
 	return *this;
 }
 
 TMTape::~TMTape() {}
 
-void TMTape::loadInput(const std::vector<std::string> &input) {
-	tape.clear();
-	for (const auto &s : input) {
-		tape.push_back(s);
+bool TMTape::operator==(const TMTape &other) const {
+	if (headIndex != other.headIndex || blankSymbol != other.blankSymbol) {
+		return false;
 	}
-	if (tape.empty()) {
-		tape.push_back(blankSymbol);
+	if (mode != other.mode) {
+		TMTape converted = other;
+		converted.setMode(mode);
+		return *this == converted;
+	}
+	switch (mode) {
+	case TMTapeMode::RUN_LENGTH:
+		// Runs are kept maximal, so equal run-length tapes have equal runs
+		return std::equal(runs.begin(), runs.end(), other.runs.begin(), other.runs.end(),
+		                  [](const Run &a, const Run &b) { return a.symbol == b.symbol && a.length == b.length; });
+	case TMTapeMode::CHUNKED:
+		// Cells past the end are blank in both tapes, and chunks still shared need no comparing
+		return chunkedSize == other.chunkedSize &&
+		       std::equal(chunks.begin(), chunks.end(), other.chunks.begin(), other.chunks.end(),
+		                  [](const std::shared_ptr<Chunk> &a, const std::shared_ptr<Chunk> &b) {
+			                  return a == b || *a == *b;
+		                  });
+	case TMTapeMode::CONTIGUOUS:
+	default:
+		return tape == other.tape;
 	}
-	head = tape.begin();
+}
+
+bool TMTape::operator!=(const TMTape &other) const {
+	return !(*this == other);
+}
+
+uint64_t TMTape::symbolValue(const SymbolId &symbol) const {
+	return symbol == blankSymbol ? 0 : mix(symbol) % MODULUS;
+}
+
+void TMTape::rehash() {
+	contentHash = 0;
+	if (mode == TMTapeMode::RUN_LENGTH) {
+		// A run adds its value times the powers of BASE over its cells
+		uint64_t start = 0;
+		for (const auto &run : runs) {
+			if (run.symbol != blankSymbol) {
+				contentHash = addMod(contentHash, mulMod(symbolValue(run.symbol), runPowers(start, run.length)));
+			}
+			start += run.length;
+		}
+	} else {
+		uint64_t power = 1;
+		for (std::size_t i = 0; i < getSize(); i++) {
+			contentHash = addMod(contentHash, mulMod(symbolValue(cellAt(i)), power));
+			power = mulMod(power, BASE);
+		}
+	}
+	headPower = powMod(BASE, headIndex);
+}
+
+SymbolId TMTape::cellAt(const std::size_t &index) const {
+	if (mode == TMTapeMode::CHUNKED) {
+		return (*chunks[index / CHUNK_SIZE])[index % CHUNK_SIZE];
+	}
+	return tape[index];
+}
+
+std::vector<SymbolId> TMTape::getCells() const {
+	if (mode == TMTapeMode::CONTIGUOUS) {
+		return tape;
+	}
+
+	std::vector<SymbolId> cells;
+	cells.reserve(getSize());
+	if (mode == TMTapeMode::RUN_LENGTH) {
+		for (const auto &run : runs) {
+			cells.insert(cells.end(), run.length, run.symbol);
+		}
+	} else {
+		for (std::size_t i = 0; i < chunkedSize; i++) {
+			cells.push_back(cellAt(i));
+		}
+	}
+	return cells;
+}
+
+void TMTape::setCells(std::vector<SymbolId> cells) {
+	switch (mode) {
+	case TMTapeMode::RUN_LENGTH:
+		runs.clear();
+		for (const auto &symbol : cells) {
+			appendRun(runs, symbol, 1);
+		}
+		runsSize = cells.size();
+		locateHead();
+		break;
+	case TMTapeMode::CHUNKED:
+		chunks.clear();
+		chunkedSize = 0;
+		growChunks(cells.size());
+		for (std::size_t i = 0; i < cells.size(); i++) {
+			(*chunks[i / CHUNK_SIZE])[i % CHUNK_SIZE] = cells[i];
+		}
+		break;
+	case TMTapeMode::CONTIGUOUS:
+	default:
+		tape = std::move(cells);
+		break;
+	}
+}
+
+void TMTape::growChunks(const std::size_t &size) {
+	while (chunks.size() * CHUNK_SIZE < size) {
+		auto chunk = std::make_shared<Chunk>();
+		chunk->fill(blankSymbol);
+		chunks.push_back(std::move(chunk));
+	}
+	chunkedSize = size;
+}
+
+void TMTape::appendRun(std::vector<Run> &runs, const SymbolId &symbol, const int &length) {
+	if (!runs.empty() && runs.back().symbol == symbol) {
+		runs.back().length += length;
+	} else {
+		runs.push_back({symbol, length});
+	}
+}
+
+void TMTape::locateHead() {
+	int remaining = headIndex;
+	headRun = 0;
+	while (headRun < runs.size() && remaining >= runs[headRun].length) {
+		remaining -= runs[headRun].length;
+		headRun++;
+	}
+	headOffset = remaining;
+}
+
+void TMTape::setMode(const TMTapeMode &mode) {
+	if (this->mode == mode) {
+		return;
+	}
+
+	std::vector<SymbolId> cells = getCells();
+	std::vector<SymbolId>().swap(tape);
+	std::vector<Run>().swap(runs);
+	std::vector<std::shared_ptr<Chunk>>().swap(chunks);
+	chunkedSize = 0;
+	runsSize = 0;
+
+	this->mode = mode;
+	setCells(std::move(cells));
+}
+
+TMTapeMode TMTape::getMode() const {
+	return mode;
+}
+
+std::size_t TMTape::getSize() const {
+	if (mode == TMTapeMode::CONTIGUOUS) {
+		return tape.size();
+	}
+	if (mode == TMTapeMode::CHUNKED) {
+		return chunkedSize;
+	}
+	return runsSize;
+}
+
+std::size_t TMTape::getRunCount() const {
+	if (mode == TMTapeMode::RUN_LENGTH) {
+		return runs.size();
+	}
+
+	std::size_t count = 0;
+	for (std::size_t i = 0; i < getSize(); i++) {
+		if (i == 0 || cellAt(i) != cellAt(i - 1)) {
+			count++;
+		}
+	}
+	return count;
+}
+
+void TMTape::loadInput(const std::vector<std::string> &input) {
+	loadInput(SymbolTable::intern(input));
+}
+
+void TMTape::loadInput(const std::vector<SymbolId> &input) {
 	headIndex = 0;
+	if (mode == TMTapeMode::CONTIGUOUS) {
+		tape.assign(input.begin(), input.end());
+		if (tape.empty()) {
+			tape.push_back(blankSymbol);
+		}
+	} else {
+		setCells(input.empty() ? std::vector<SymbolId>{blankSymbol} : input);
+	}
+	rehash();
 }
 
 std::list<std::string> TMTape::getTape() const {
-	return tape;
+	std::list<std::string> result;
+	if (mode == TMTapeMode::RUN_LENGTH) {
+		for (const auto &run : runs) {
+			result.insert(result.end(), run.length, SymbolTable::getSymbol(run.symbol));
+		}
+		return result;
+	}
+
+	for (std::size_t i = 0; i < getSize(); i++) {
+		result.push_back(SymbolTable::getSymbol(cellAt(i)));
+	}
+	return result;
 }
 
 void TMTape::setTape(const std::list<std::string> &newTape) {
-	tape = newTape;
-	head = tape.begin();
 	headIndex = 0;
+	std::vector<SymbolId> cells;
+	cells.reserve(newTape.size());
+	for (const auto &symbol : newTape) {
+		cells.push_back(SymbolTable::intern(symbol));
+	}
+	setCells(std::move(cells));
+	rehash();
 }
 
 void TMTape::setBlankSymbol(const std::string &blankSymbol) {
-	for (auto &s : tape) {
-		if (s == this->blankSymbol) {
-			s = blankSymbol;
+	SymbolId blankSymbolId = SymbolTable::intern(blankSymbol);
+	if (mode == TMTapeMode::RUN_LENGTH) {
+		// Renaming the blank can make it equal to a neighbouring run, so the runs are merged again
+		std::vector<Run> newRuns;
+		newRuns.reserve(runs.size());
+		for (const auto &run : runs) {
+			appendRun(newRuns, run.symbol == this->blankSymbol ? blankSymbolId : run.symbol, run.length);
+		}
+		runs = std::move(newRuns);
+		locateHead();
+		this->blankSymbol = blankSymbolId;
+	} else {
+		std::vector<SymbolId> cells = getCells();
+		for (auto &s : cells) {
+			if (s == this->blankSymbol) {
+				s = blankSymbolId;
+			}
 		}
+		// The blank is set first, so the chunks are padded with the new one
+		this->blankSymbol = blankSymbolId;
+		setCells(std::move(cells));
 	}
-	this->blankSymbol = blankSymbol;
+	rehash();
 }
 
 std::string TMTape::getBlankSymbol() const {
+	return SymbolTable::getSymbol(blankSymbol);
+}
+
+SymbolId TMTape::getBlankSymbolId() const {
 	return blankSymbol;
 }
 
 void TMTape::setHeadPosition(const int &position) {
 	if (position < 0)
 		return;
-	while (position >= static_cast<int>(tape.size())) {
-		tape.push_back(blankSymbol);
+	// The cells added are blank, which leaves the content hash unchanged
+	headPower = powMod(BASE, position);
+	if (mode == TMTapeMode::RUN_LENGTH) {
+		const int size = static_cast<int>(getSize());
+		if (position >= size) {
+			appendRun(runs, blankSymbol, position + 1 - size);
+			runsSize = position + 1;
+		}
+		headIndex = position;
+		locateHead();
+		return;
+	}
+	if (mode == TMTapeMode::CHUNKED) {
+		if (position >= static_cast<int>(chunkedSize)) {
+			growChunks(position + 1);
+		}
+		headIndex = position;
+		return;
+	}
+
+	if (position >= static_cast<int>(tape.size())) {
+		tape.resize(position + 1, blankSymbol);
 	}
-	head = tape.begin();
-	std::advance(head, position);
 	headIndex = position;
 }
 
@@ -97,30 +424,243 @@ int TMTape::getHeadPosition() const {
 }
 
 std::string TMTape::read() const {
-	return *head;
+	return SymbolTable::getSymbol(readId());
+}
+
+SymbolId TMTape::readId() const {
+	if (mode == TMTapeMode::RUN_LENGTH) {
+		return runs[headRun].symbol;
+	}
+	return cellAt(headIndex);
 }
 
 void TMTape::write(const std::string &symbol) {
-	*head = symbol;
+	writeId(SymbolTable::intern(symbol));
+}
+
+void TMTape::writeId(const SymbolId &symbol) {
+	contentHash = addMod(contentHash, mulMod(subMod(symbolValue(symbol), symbolValue(readId())), headPower));
+	if (mode == TMTapeMode::RUN_LENGTH) {
+		writeRun(symbol);
+		return;
+	}
+	if (mode == TMTapeMode::CHUNKED) {
+		// Copy the chunk first if another tape still shares it
+		std::shared_ptr<Chunk> &chunk = chunks[headIndex / CHUNK_SIZE];
+		if (chunk.use_count() > 1) {
+			chunk = std::make_shared<Chunk>(*chunk);
+		}
+		(*chunk)[headIndex % CHUNK_SIZE] = symbol;
+		return;
+	}
+	tape[headIndex] = symbol;
+}
+
+void TMTape::writeRun(const SymbolId &symbol) {
+	const SymbolId oldSymbol = runs[headRun].symbol;
+	const int length = runs[headRun].length;
+	if (oldSymbol == symbol) {
+		return;
+	}
+
+	const bool joinsPrevious = headOffset == 0 && headRun > 0 && runs[headRun - 1].symbol == symbol;
+	const bool joinsNext = headOffset == length - 1 && headRun + 1 < runs.size() && runs[headRun + 1].symbol == symbol;
+
+	if (joinsPrevious) {
+		// The head cell becomes the last cell of the previous run
+		const int previousLength = runs[headRun - 1].length;
+		runs[headRun - 1].length++;
+		if (length == 1) {
+			if (joinsNext) {
+				runs[headRun - 1].length += runs[headRun + 1].length;
+				runs.erase(runs.begin() + headRun, runs.begin() + headRun + 2);
+			} else {
+				runs.erase(runs.begin() + headRun);
+			}
+		} else {
+			runs[headRun].length--;
+		}
+		headRun--;
+		headOffset = previousLength;
+	} else if (joinsNext) {
+		// The head cell becomes the first cell of the next run
+		runs[headRun + 1].length++;
+		if (length == 1) {
+			runs.erase(runs.begin() + headRun);
+		} else {
+			runs[headRun].length--;
+			headRun++;
+		}
+		headOffset = 0;
+	} else if (length == 1) {
+		runs[headRun].symbol = symbol;
+	} else if (headOffset == 0) {
+		runs[headRun].length--;
+		runs.insert(runs.begin() + headRun, {symbol, 1});
+	} else if (headOffset == length - 1) {
+		runs[headRun].length--;
+		runs.insert(runs.begin() + headRun + 1, {symbol, 1});
+		headRun++;
+		headOffset = 0;
+	} else {
+		// Split the run around the head cell
+		runs[headRun].length = headOffset;
+		runs.insert(runs.begin() + headRun + 1, {{symbol, 1}, {oldSymbol, length - headOffset - 1}});
+		headRun++;
+		headOffset = 0;
+	}
+}
+
+std::size_t TMTape::splitRunsAt(const int &position) {
+	int runStart = 0;
+	for (std::size_t i = 0; i < runs.size(); i++) {
+		if (runStart == position) {
+			return i;
+		}
+		if (position < runStart + runs[i].length) {
+			const int leftLength = position - runStart;
+			runs.insert(runs.begin() + i + 1, {runs[i].symbol, runs[i].length - leftLength});
+			runs[i].length = leftLength;
+			return i + 1;
+		}
+		runStart += runs[i].length;
+	}
+	return runs.size();
+}
+
+void TMTape::sweep(const SymbolId &symbol, const TMDirection &direction, const int &count) {
+	if (mode != TMTapeMode::RUN_LENGTH || direction == TMDirection::STAY || count <= 1) {
+		for (int i = 0; i < count; i++) {
+			writeId(symbol);
+			move(direction);
+		}
+		return;
+	}
+
+	// Cells [first, first + length) are written, past the left end the head keeps writing cell 0
+	int first = headIndex;
+	int length = count;
+	int newHead = headIndex + count;
+	if (direction == TMDirection::LEFT) {
+		first = std::max(0, headIndex - count + 1);
+		length = headIndex - first + 1;
+		newHead = std::max(0, headIndex - count);
+	}
+
+	// The cells added are blank, which leaves the content hash unchanged
+	const int size = static_cast<int>(runsSize);
+	if (std::max(first + length, newHead + 1) > size) {
+		appendRun(runs, blankSymbol, std::max(first + length, newHead + 1) - size);
+		runsSize = std::max(first + length, newHead + 1);
+	}
+
+	// Replace the runs covering the written cells with one run, merged with equal runs next to it
+	const std::size_t begin = splitRunsAt(first);
+	const std::size_t end = splitRunsAt(first + length);
+	uint64_t start = first;
+	for (std::size_t i = begin; i < end; i++) {
+		contentHash = subMod(contentHash, mulMod(symbolValue(runs[i].symbol), runPowers(start, runs[i].length)));
+		start += runs[i].length;
+	}
+	contentHash = addMod(contentHash, mulMod(symbolValue(symbol), runPowers(first, length)));
+	runs.erase(runs.begin() + begin, runs.begin() + end);
+	runs.insert(runs.begin() + begin, {symbol, length});
+	if (begin + 1 < runs.size() && runs[begin + 1].symbol == symbol) {
+		runs[begin].length += runs[begin + 1].length;
+		runs.erase(runs.begin() + begin + 1);
+	}
+	if (begin > 0 && runs[begin - 1].symbol == symbol) {
+		runs[begin - 1].length += runs[begin].length;
+		runs.erase(runs.begin() + begin);
+	}
+
+	headIndex = newHead;
+	headPower = powMod(BASE, newHead);
+	locateHead();
+}
+
+int TMTape::getHeadRunExtent(const TMDirection &direction) const {
+	if (mode == TMTapeMode::RUN_LENGTH) {
+		switch (direction) {
+		case TMDirection::LEFT:
+			return headOffset + 1;
+		case TMDirection::RIGHT:
+			return runs[headRun].length - headOffset;
+		case TMDirection::STAY:
+		default:
+			return 1;
+		}
+	}
+
+	const int step = direction == TMDirection::LEFT ? -1 : direction == TMDirection::RIGHT ? 1 : 0;
+	int extent = 1;
+	if (step == 0) {
+		return extent;
+	}
+	for (int i = headIndex + step; i >= 0 && i < static_cast<int>(getSize()) && cellAt(i) == cellAt(headIndex);
+	     i += step) {
+		extent++;
+	}
+	return extent;
+}
+
+bool TMTape::isHeadInLastRun() const {
+	if (mode == TMTapeMode::RUN_LENGTH) {
+		return headRun + 1 == runs.size();
+	}
+	return headIndex + getHeadRunExtent(TMDirection::RIGHT) == static_cast<int>(getSize());
 }
 
 void TMTape::moveLeft() {
-	if (head == tape.begin()) {
+	if (headIndex == 0) {
 		return;
 	}
 
-	--head;
 	--headIndex;
+	headPower = mulMod(headPower, inverseBase());
+	if (mode == TMTapeMode::RUN_LENGTH) {
+		if (headOffset > 0) {
+			--headOffset;
+		} else {
+			--headRun;
+			headOffset = runs[headRun].length - 1;
+		}
+	}
 }
 
 void TMTape::moveRight() {
-	++head;
 	++headIndex;
+	headPower = mulMod(headPower, BASE);
 
-	if (head == tape.end()) {
-		// Append blank and reposition head
+	if (mode == TMTapeMode::RUN_LENGTH) {
+		if (++headOffset < runs[headRun].length) {
+			return;
+		}
+		if (headRun + 1 < runs.size()) {
+			++headRun;
+			headOffset = 0;
+		} else if (runs[headRun].symbol == blankSymbol) {
+			// Append blank under the head by extending the blank run the head is leaving
+			runs[headRun].length++;
+			++runsSize;
+		} else {
+			runs.push_back({blankSymbol, 1});
+			++runsSize;
+			++headRun;
+			headOffset = 0;
+		}
+		return;
+	}
+	if (mode == TMTapeMode::CHUNKED) {
+		if (headIndex == static_cast<int>(chunkedSize)) {
+			growChunks(chunkedSize + 1);
+		}
+		return;
+	}
+
+	if (headIndex == static_cast<int>(tape.size())) {
+		// Append blank under the head
 		tape.push_back(blankSymbol);
-		head = std::prev(tape.end());
 	}
 }
 
@@ -139,34 +679,101 @@ void TMTape::move(const TMDirection &direction) {
 }
 
 bool TMTape::isEmpty() const {
-	return tape.empty();
+	return getSize() == 0;
 }
 
 void TMTape::reset() {
-	tape.clear();
-	tape.push_back(blankSymbol);
-	head = tape.begin();
 	headIndex = 0;
+	if (mode == TMTapeMode::RUN_LENGTH) {
+		runs.assign(1, {blankSymbol, 1});
+		runsSize = 1;
+		headRun = 0;
+		headOffset = 0;
+	} else {
+		setCells({blankSymbol});
+	}
+	contentHash = 0;
+	headPower = 1;
 }
 
 bool TMTape::isAtLeftEnd() const {
-	return head == tape.begin();
+	return headIndex == 0;
 }
 
 std::string TMTape::toString() const {
 	std::ostringstream oss;
 	oss << "[";
-	int i = 0;
-	for (auto it = tape.begin(); it != tape.end(); ++it, ++i) {
-		if (i == headIndex) {
-			oss << "(" << *it << ")";
+	if (mode == TMTapeMode::RUN_LENGTH) {
+		bool first = true;
+		auto printRun = [&](const SymbolId &symbol, const int &length, const bool &isHead) {
+			if (length == 0) {
+				return;
+			}
+			if (!first) {
+				oss << ", ";
+			}
+			first = false;
+			if (isHead) {
+				oss << "(" << SymbolTable::getSymbol(symbol) << ")";
+			} else {
+				oss << SymbolTable::getSymbol(symbol);
+			}
+			if (length > 1) {
+				oss << "*" << length;
+			}
+		};
+		for (std::size_t i = 0; i < runs.size(); i++) {
+			if (i != headRun) {
+				printRun(runs[i].symbol, runs[i].length, false);
+				continue;
+			}
+			printRun(runs[i].symbol, headOffset, false);
+			printRun(runs[i].symbol, 1, true);
+			printRun(runs[i].symbol, runs[i].length - headOffset - 1, false);
+		}
+		oss << "]";
+		return oss.str();
+	}
+
+	const std::size_t size = getSize();
+	for (std::size_t i = 0; i < size; i++) {
+		if (static_cast<int>(i) == headIndex) {
+			oss << "(" << SymbolTable::getSymbol(cellAt(i)) << ")";
 		} else {
-			oss << *it;
+			oss << SymbolTable::getSymbol(cellAt(i));
 		}
-		if (std::next(it) != tape.end()) {
+		if (i + 1 != size) {
 			oss << ", ";
 		}
 	}
 	oss << "]";
 	return oss.str();
 }
+
+std::size_t TMTape::hash() const {
+	std::size_t hashValue = std::hash<int>()(headIndex);
+	if (mode == TMTapeMode::RUN_LENGTH) {
+		for (const auto &run : runs) {
+			combineHash(hashValue, std::hash<SymbolId>()(run.symbol));
+			combineHash(hashValue, std::hash<int>()(run.length));
+		}
+		return hashValue;
+	}
+
+	// Fold the cells run by run, so the hash matches the one of the same tape stored as runs
+	const std::size_t size = getSize();
+	for (std::size_t start = 0; start < size;) {
+		std::size_t end = start + 1;
+		while (end < size && cellAt(end) == cellAt(start)) {
+			end++;
+		}
+		combineHash(hashValue, std::hash<SymbolId>()(cellAt(start)));
+		combineHash(hashValue, std::hash<int>()(static_cast<int>(end - start)));
+		start = end;
+	}
+	return hashValue;
+}
+
+uint64_t TMTape::getFingerprint() const {
+	return contentHash ^ mix(static_cast<uint64_t>(headIndex));
+}
@@ -1,13 +1,15 @@
 #include "AutomataSimulator/TMTransition.h"
+#include <algorithm>
 
 TMTransition::TMTransition()
-    : fromStateKey(""), toStateKey(""), readSymbol(""), writeSymbol(""), direction(TMDirection::STAY), key("") {}
+    : fromStateKey(""), toStateKey(""), readSymbol(SymbolTable::EPSILON_SYMBOL_ID),
+      writeSymbol(SymbolTable::EPSILON_SYMBOL_ID), direction(TMDirection::STAY) {}
 
 TMTransition::TMTransition(const std::string &fromStateKey, const std::string &toStateKey,
                            const std::string &readSymbol, const std::string &writeSymbol, TMDirection direction)
-    : fromStateKey(fromStateKey), toStateKey(toStateKey), readSymbol(readSymbol), writeSymbol(writeSymbol),
-      direction(direction) {
-	key = generateTransitionKey(fromStateKey, toStateKey, readSymbol, writeSymbol, direction);
+    : fromStateKey(fromStateKey), toStateKey(toStateKey), readSymbol(SymbolTable::intern(readSymbol)),
+      writeSymbol(SymbolTable::intern(writeSymbol)), direction(direction) {
+	updateKey();
 }
 
 TMTransition::TMTransition(const TMTransition &other)
@@ -52,62 +54,76 @@ TMTransition::~TMTransition() {}
 std::string TMTransition::generateTransitionKey(const std::string &fromStateKey, const std::string &toStateKey,
                                                 const std::string &readSymbol, const std::string &writeSymbol,
                                                 TMDirection direction) {
-	return fromStateKey + "-" + toStateKey + "-" + readSymbol + "-" + writeSymbol + "-" +
-	       TMDirectionHelper::toString(direction);
+	return TransitionKey::joinParts(
+	    {fromStateKey, toStateKey, readSymbol, writeSymbol, TMDirectionHelper::toString(direction)});
 }
 
-void TMTransition::validateTransitionKeyFormat(const std::string &key) {
-	int delimiterCount = std::count(key.begin(), key.end(), '-');
-	if (delimiterCount != 4) {
+std::string TMTransition::generateTransitionKey(const TransitionKey &key) {
+	return generateTransitionKey(SymbolTable::getSymbol(key.fromState), SymbolTable::getSymbol(key.toState),
+	                             SymbolTable::getSymbol(key.symbols[0]), SymbolTable::getSymbol(key.symbols[1]),
+	                             static_cast<TMDirection>(key.symbols[2]));
+}
+
+TransitionKey TMTransition::parseTransitionKey(const std::string &key) {
+	std::vector<std::string> parts = splitTransitionKey(key);
+
+	// Only an exact direction name matches, fromString falls back to STAY for anything else
+	TMDirection direction = TMDirectionHelper::fromString(parts[4]);
+	SymbolId directionId = TMDirectionHelper::toString(direction) == parts[4] ? static_cast<SymbolId>(direction)
+	                                                                          : SymbolTable::UNKNOWN_SYMBOL_ID;
+
+	return TransitionKey(SymbolTable::find(parts[0]), SymbolTable::find(parts[1]), SymbolTable::find(parts[2]),
+	                     SymbolTable::find(parts[3]), directionId);
+}
+
+std::vector<std::string> TMTransition::splitTransitionKey(const std::string &key) {
+	std::vector<std::string> parts = TransitionKey::splitParts(key);
+	if (parts.size() != 5) {
 		throw TransitionNotFoundException("Invalid TM transition key format: " + key);
 	}
+	return parts;
 }
 
 std::string TMTransition::getFromStateFromKey(const std::string &key) {
-	validateTransitionKeyFormat(key);
-	size_t first = key.find('-');
-	return key.substr(0, first);
+	return splitTransitionKey(key)[0];
 }
 
 std::string TMTransition::getToStateFromKey(const std::string &key) {
-	validateTransitionKeyFormat(key);
-	size_t first = key.find('-');
-	size_t second = key.find('-', first + 1);
-	return key.substr(first + 1, second - (first + 1));
+	return splitTransitionKey(key)[1];
 }
 
 std::string TMTransition::getReadSymbolFromKey(const std::string &key) {
-	validateTransitionKeyFormat(key);
-	size_t second = key.find('-', key.find('-') + 1);
-	size_t third = key.find('-', second + 1);
-	return key.substr(second + 1, third - (second + 1));
+	return splitTransitionKey(key)[2];
 }
 
 std::string TMTransition::getWriteSymbolFromKey(const std::string &key) {
-	validateTransitionKeyFormat(key);
-	size_t third = key.find('-', key.find('-', key.find('-') + 1) + 1);
-	size_t fourth = key.find('-', third + 1);
-	return key.substr(third + 1, fourth - (third + 1));
+	return splitTransitionKey(key)[3];
 }
 
 TMDirection TMTransition::getDirectionFromKey(const std::string &key) {
-	validateTransitionKeyFormat(key);
-	size_t fourth = key.find_last_of('-');
-	std::string directionStr = key.substr(fourth + 1);
-	return TMDirectionHelper::fromString(directionStr);
+	return TMDirectionHelper::fromString(splitTransitionKey(key)[4]);
 }
 
 std::string TMTransition::getKey() const {
+	return generateTransitionKey(fromStateKey, toStateKey, getReadSymbol(), getWriteSymbol(), direction);
+}
+
+const TransitionKey &TMTransition::getTransitionKey() const {
 	return key;
 }
 
+void TMTransition::updateKey() {
+	key = TransitionKey(SymbolTable::intern(fromStateKey), SymbolTable::intern(toStateKey), readSymbol, writeSymbol,
+	                    static_cast<SymbolId>(direction));
+}
+
 std::string TMTransition::getFromStateKey() const {
 	return fromStateKey;
 }
 
 void TMTransition::setFromStateKey(const std::string &fromStateKey) {
 	this->fromStateKey = fromStateKey;
-	key = generateTransitionKey(fromStateKey, toStateKey, readSymbol, writeSymbol, direction);
+	updateKey();
 }
 
 std::string TMTransition::getToStateKey() const {
@@ -116,25 +132,33 @@ std::string TMTransition::getToStateKey() const {
 
 void TMTransition::setToStateKey(const std::string &toStateKey) {
 	this->toStateKey = toStateKey;
-	key = generateTransitionKey(fromStateKey, toStateKey, readSymbol, writeSymbol, direction);
+	updateKey();
 }
 
 std::string TMTransition::getReadSymbol() const {
+	return SymbolTable::getSymbol(readSymbol);
+}
+
+SymbolId TMTransition::getReadSymbolId() const {
 	return readSymbol;
 }
 
 void TMTransition::setReadSymbol(const std::string &readSymbol) {
-	this->readSymbol = readSymbol;
-	key = generateTransitionKey(fromStateKey, toStateKey, readSymbol, writeSymbol, direction);
+	this->readSymbol = SymbolTable::intern(readSymbol);
+	updateKey();
 }
 
 std::string TMTransition::getWriteSymbol() const {
+	return SymbolTable::getSymbol(writeSymbol);
+}
+
+SymbolId TMTransition::getWriteSymbolId() const {
 	return writeSymbol;
 }
 
 void TMTransition::setWriteSymbol(const std::string &writeSymbol) {
-	this->writeSymbol = writeSymbol;
-	key = generateTransitionKey(fromStateKey, toStateKey, readSymbol, writeSymbol, direction);
+	this->writeSymbol = SymbolTable::intern(writeSymbol);
+	updateKey();
 }
 
 TMDirection TMTransition::getDirection() const {
@@ -143,10 +167,10 @@ TMDirection TMTransition::getDirection() const {
 
 void TMTransition::setDirection(TMDirection direction) {
 	this->direction = direction;
-	key = generateTransitionKey(fromStateKey, toStateKey, readSymbol, writeSymbol, direction);
+	updateKey();
 }
 
 std::string TMTransition::toString() const {
-	return "TM Transition: [" + fromStateKey + " -> " + toStateKey + " | Read: " + readSymbol +
-	       " | Write: " + writeSymbol + " | Move: " + TMDirectionHelper::toString(direction) + "]";
+	return "TM Transition: [" + fromStateKey + " -> " + toStateKey + " | Read: " + getReadSymbol() +
+	       " | Write: " + getWriteSymbol() + " | Move: " + TMDirectionHelper::toString(direction) + "]";
 }
@@ -33,8 +33,9 @@ void TuringMachine::validateTransition(const std::string &fromStateKey, const st
 	}
 
 	TMState *fromState = getStateInternal(fromStateKey);
-	const std::string &transitionKey =
-	    TMTransition::generateTransitionKey(fromStateKey, toStateKey, readSymbol, writeSymbol, direction);
+	TransitionKey transitionKey(SymbolTable::find(fromStateKey), SymbolTable::find(toStateKey),
+	                            SymbolTable::find(readSymbol), SymbolTable::find(writeSymbol),
+	                            static_cast<SymbolId>(direction));
 
 	// Check if the new transition would be a duplicate
 	if (fromState->transitionExists(transitionKey)) {
@@ -44,6 +45,38 @@ void TuringMachine::validateTransition(const std::string &fromStateKey, const st
 	}
 }
 
+void TuringMachine::prepareConcurrentSimulation() {
+	std::lock_guard<CacheMutex> lock(simulationCachesMutex);
+	buildSimulationCaches();
+}
+
+void TuringMachine::buildSimulationCaches() {
+	// Rebuilds the transition vector of every state whose cache was invalidated
+	for (auto &pair : states) {
+		pair.second.getTransitionsView();
+	}
+}
+
+void TuringMachine::indexTransition(const TMTransition &transition) {
+	incomingTransitions[transition.getToStateKey()].insert(transition.getTransitionKey());
+}
+
+void TuringMachine::unindexTransition(const TMTransition &transition) {
+	incomingTransitions[transition.getToStateKey()].erase(transition.getTransitionKey());
+}
+
+void TuringMachine::removeTransitionInternal(TMState &state, const TMTransition &transition) {
+	unindexTransition(transition);
+	state.removeTransition(transition.getTransitionKey());
+}
+
+void TuringMachine::unindexState(const std::string &key) {
+	for (const auto &transition : getStateInternal(key)->getTransitionsView()) {
+		unindexTransition(transition);
+	}
+	incomingTransitions.erase(key);
+}
+
 TMState *TuringMachine::getStateInternal(const std::string &key) {
 	auto it = states.find(key);
 	// Check if state exists
@@ -54,7 +87,7 @@ TMState *TuringMachine::getStateInternal(const std::string &key) {
 }
 
 std::vector<std::string> TuringMachine::getInput() const {
-	return input;
+	return SymbolTable::getSymbols(input);
 }
 
 void TuringMachine::setInput(const std::vector<std::string> &input) {
@@ -75,7 +108,7 @@ void TuringMachine::setInput(const std::vector<std::string> &input) {
 		throw InputAlphabetSymbolNotFoundException(missingSymbolsString);
 	}
 
-	this->input = input;
+	this->input = SymbolTable::intern(input);
 	this->tape.loadInput(this->input);
 }
 
@@ -97,7 +130,8 @@ void TuringMachine::addInput(const std::vector<std::string> &input) {
 		throw InputAlphabetSymbolNotFoundException(missingSymbolsString);
 	}
 
-	this->input.insert(this->input.end(), input.begin(), input.end());
+	std::vector<SymbolId> inputIds = SymbolTable::intern(input);
+	this->input.insert(this->input.end(), inputIds.begin(), inputIds.end());
 	this->tape.loadInput(this->input);
 }
 
@@ -137,16 +171,26 @@ std::string TuringMachine::readTape() const {
 	return tape.read();
 }
 
+void TuringMachine::setTapeMode(const TMTapeMode &mode) {
+	tape.setMode(mode);
+}
+
+TMTapeMode TuringMachine::getTapeMode() const {
+	return tape.getMode();
+}
+
 bool TuringMachine::stateExists(const std::string &key) const {
 	return states.find(key) != states.end();
 }
 
 bool TuringMachine::inputAlphabetSymbolExists(const std::string &symbol) const {
-	return inputAlphabet.find(symbol) != inputAlphabet.end();
+	SymbolId symbolId = SymbolTable::find(symbol);
+	return inputAlphabet.find(symbolId) != inputAlphabet.end();
 }
 
 bool TuringMachine::tapeAlphabetSymbolExists(const std::string &symbol) const {
-	return tapeAlphabet.find(symbol) != tapeAlphabet.end();
+	SymbolId symbolId = SymbolTable::find(symbol);
+	return tapeAlphabet.find(symbolId) != tapeAlphabet.end();
 }
 
 void TuringMachine::addState(const std::string &label, const bool &isAccept) {
@@ -178,16 +222,39 @@ void TuringMachine::updateStateLabel(const std::string &key, const std::string &
 		throw InvalidAutomatonDefinitionException("State with label " + label + " already exists");
 	}
 
-	TMState *state = getStateInternal(key);
+	// Move the state's node to the new key instead of copying it, so its transitions come along untouched
+	auto node = states.extract(key);
+	if (node.empty()) {
+		throw StateNotFoundException(key);
+	}
+	TMState &state = node.mapped();
 
 	if (key == startState) {
 		startState = label;
 	}
 
-	state->setLabel(label);
+	// Relabelling changes the keys of the outgoing transitions, so reindex them under their new keys
+	for (const auto &transition : state.getTransitionsView()) {
+		unindexTransition(transition);
+	}
+	state.setLabel(label);
+	for (const auto &transition : state.getTransitionsView()) {
+		indexTransition(transition);
+	}
+
+	node.key() = label;
+	states.insert(std::move(node));
 
-	states[state->getKey()] = *state;
-	states.erase(key);
+	// Repoint the transitions leading into the state to the new label
+	std::unordered_set<TransitionKey> transitionKeys = std::move(incomingTransitions[key]);
+	incomingTransitions.erase(key);
+	for (const auto &transitionKey : transitionKeys) {
+		TMState *fromState = getStateInternal(SymbolTable::getSymbol(transitionKey.fromState));
+		fromState->setTransitionToState(transitionKey, label);
+		indexTransition(fromState->getTransition(TransitionKey(transitionKey.fromState, SymbolTable::intern(label),
+		                                                       transitionKey.symbols[0], transitionKey.symbols[1],
+		                                                       transitionKey.symbols[2])));
+	}
 
 	statesCacheInvalidated = true;
 }
@@ -225,6 +292,10 @@ TMState TuringMachine::getState(const std::string &key) const {
 }
 
 std::vector<TMState> TuringMachine::getStates() {
+	return getStatesView();
+}
+
+const std::vector<TMState> &TuringMachine::getStatesView() {
 	// if the conversion cache from unordered_map to vector is not valid then recompute
 	if (statesCacheInvalidated) {
 		cachedStates.clear();
@@ -245,18 +316,16 @@ void TuringMachine::removeState(const std::string &key, const bool &strict) {
 	std::vector<std::string> conflictingTransitions;
 
 	// Check for conflicting transitions
-	for (auto &pair : states) {
-		std::vector<TMTransition> transitions = pair.second.getTransitions();
-		for (const auto &transition : transitions) {
-			if (transition.getToStateKey() == key) {
-				if (strict) {
-					conflictingTransitions.push_back(transition.getKey());
-				} else {
-					pair.second.removeTransition(transition.getKey());
-				}
-			}
+	for (const auto &transitionKey : incomingTransitions[key]) {
+		if (strict) {
+			conflictingTransitions.push_back(TMTransition::generateTransitionKey(transitionKey));
+		} else {
+			getStateInternal(SymbolTable::getSymbol(transitionKey.fromState))->removeTransition(transitionKey);
 		}
 	}
+	if (!strict) {
+		incomingTransitions[key].clear();
+	}
 
 	// If strict mode is enabled and conflicts exist, throw an error
 	if (strict && !conflictingTransitions.empty()) {
@@ -270,6 +339,7 @@ void TuringMachine::removeState(const std::string &key, const bool &strict) {
 		throw InvalidAutomatonDefinitionException(conflictMessage);
 	}
 
+	unindexState(key);
 	states.erase(key);
 	if (key == startState) {
 		startState = "";
@@ -303,18 +373,16 @@ void TuringMachine::removeStates(const std::vector<std::string> &keys, const boo
 
 	// Check for conflicting transitions
 	for (const auto &key : keys) {
-		for (auto &pair : states) {
-			std::vector<TMTransition> transitions = pair.second.getTransitions();
-			for (const auto &transition : transitions) {
-				if (transition.getToStateKey() == key) {
-					if (strict) {
-						conflictingTransitions[key].push_back(transition.getKey());
-					} else {
-						pair.second.removeTransition(transition.getKey());
-					}
-				}
+		for (const auto &transitionKey : incomingTransitions[key]) {
+			if (strict) {
+				conflictingTransitions[key].push_back(TMTransition::generateTransitionKey(transitionKey));
+			} else {
+				getStateInternal(SymbolTable::getSymbol(transitionKey.fromState))->removeTransition(transitionKey);
 			}
 		}
+		if (!strict) {
+			incomingTransitions[key].clear();
+		}
 	}
 
 	// If strict mode is enabled and conflicts exist, throw an error
@@ -334,6 +402,7 @@ void TuringMachine::removeStates(const std::vector<std::string> &keys, const boo
 
 	// Remove states
 	for (const auto &key : keys) {
+		unindexState(key);
 		states.erase(key);
 		if (key == startState) {
 			startState = "";
@@ -348,6 +417,7 @@ void TuringMachine::removeStates(const std::vector<std::string> &keys, const boo
 
 void TuringMachine::clearStates() {
 	states.clear();
+	incomingTransitions.clear();
 	currentState = "";
 	startState = "";
 	statesCacheInvalidated = true;
@@ -355,19 +425,19 @@ void TuringMachine::clearStates() {
 
 void TuringMachine::setInputAlphabet(const std::vector<std::string> &inputAlphabet, const bool &strict) {
 	std::unordered_map<std::string, std::vector<std::string>> conflictingTransitions;
-	std::unordered_set<std::string> newAlphabet =
-	    std::unordered_set<std::string>(inputAlphabet.begin(), inputAlphabet.end());
+	std::vector<SymbolId> inputAlphabetIds = SymbolTable::intern(inputAlphabet);
+	std::unordered_set<SymbolId> newAlphabet =
+	    std::unordered_set<SymbolId>(inputAlphabetIds.begin(), inputAlphabetIds.end());
 
 	for (auto &pair : states) {
 		std::vector<TMTransition> transitions = pair.second.getTransitions();
 		for (const auto &transition : transitions) {
-			std::string symbol = transition.getReadSymbol();
-			bool found = newAlphabet.find(symbol) != newAlphabet.end();
+			bool found = newAlphabet.find(transition.getReadSymbolId()) != newAlphabet.end();
 			if (!found) {
 				if (strict) {
-					conflictingTransitions[symbol].push_back(transition.getKey());
+					conflictingTransitions[transition.getReadSymbol()].push_back(transition.getKey());
 				} else {
-					pair.second.removeTransition(transition.getKey());
+					removeTransitionInternal(pair.second, transition);
 				}
 			}
 		}
@@ -396,7 +466,7 @@ void TuringMachine::setInputAlphabet(const std::vector<std::string> &inputAlphab
 
 void TuringMachine::addInputAlphabet(const std::vector<std::string> &inputAlphabet) {
 	for (const auto &symbol : inputAlphabet) {
-		this->inputAlphabet.insert(symbol);
+		this->inputAlphabet.insert(SymbolTable::intern(symbol));
 	}
 	addTapeAlphabet(inputAlphabet);
 	inputAlphabetCacheInvalidated = true;
@@ -407,7 +477,7 @@ std::vector<std::string> TuringMachine::getInputAlphabet() {
 	if (inputAlphabetCacheInvalidated) {
 		cachedInputAlphabet.clear();
 		for (const auto &symbol : inputAlphabet) {
-			cachedInputAlphabet.push_back(symbol);
+			cachedInputAlphabet.push_back(SymbolTable::getSymbol(symbol));
 		}
 		inputAlphabetCacheInvalidated = false;
 	}
@@ -419,17 +489,18 @@ void TuringMachine::removeInputAlphabetSymbol(const std::string &symbol, const b
 	if (!inputAlphabetSymbolExists(symbol)) {
 		throw InputAlphabetSymbolNotFoundException(symbol);
 	}
+	SymbolId symbolId = SymbolTable::find(symbol);
 	std::vector<std::string> conflictingTransitions;
 
 	// Check for conflicting transitions
 	for (auto &pair : states) {
 		std::vector<TMTransition> transitions = pair.second.getTransitions();
 		for (const auto &transition : transitions) {
-			if (transition.getReadSymbol() == symbol) {
+			if (transition.getReadSymbolId() == symbolId) {
 				if (strict) {
 					conflictingTransitions.push_back(transition.getKey());
 				} else {
-					pair.second.removeTransition(transition.getKey());
+					removeTransitionInternal(pair.second, transition);
 				}
 			}
 		}
@@ -447,7 +518,7 @@ void TuringMachine::removeInputAlphabetSymbol(const std::string &symbol, const b
 		throw InvalidAutomatonDefinitionException(conflictMessage);
 	}
 
-	inputAlphabet.erase(symbol);
+	inputAlphabet.erase(symbolId);
 	inputAlphabetCacheInvalidated = true;
 }
 
@@ -475,14 +546,15 @@ void TuringMachine::removeInputAlphabetSymbols(const std::vector<std::string> &s
 
 	// Check for conflicting transitions
 	for (const auto &symbol : symbols) {
+		SymbolId symbolId = SymbolTable::find(symbol);
 		for (auto &pair : states) {
 			std::vector<TMTransition> transitions = pair.second.getTransitions();
 			for (const auto &transition : transitions) {
-				if (transition.getReadSymbol() == symbol) {
+				if (transition.getReadSymbolId() == symbolId) {
 					if (strict) {
 						conflictingTransitions[symbol].push_back(transition.getKey());
 					} else {
-						pair.second.removeTransition(transition.getKey());
+						removeTransitionInternal(pair.second, transition);
 					}
 				}
 			}
@@ -506,7 +578,7 @@ void TuringMachine::removeInputAlphabetSymbols(const std::vector<std::string> &s
 
 	// If no missing symbols found then we remove
 	for (const auto &symbol : symbols) {
-		inputAlphabet.erase(symbol);
+		inputAlphabet.erase(SymbolTable::find(symbol));
 	}
 
 	inputAlphabetCacheInvalidated = true;
@@ -516,12 +588,12 @@ void TuringMachine::clearInputAlphabet(const bool &strict) {
 	for (auto &pair : states) {
 		std::vector<TMTransition> transitions = pair.second.getTransitions();
 		for (const auto &transition : transitions) {
-			if (!transition.getReadSymbol().empty()) {
+			if (transition.getReadSymbolId() != SymbolTable::EPSILON_SYMBOL_ID) {
 				if (strict) {
 					throw InvalidAutomatonDefinitionException(
 					    "Cannot clear input alphabet because non-epsilon transitions exist");
 				} else {
-					pair.second.removeTransition(transition.getKey());
+					removeTransitionInternal(pair.second, transition);
 				}
 			}
 		}
@@ -532,13 +604,14 @@ void TuringMachine::clearInputAlphabet(const bool &strict) {
 }
 
 void TuringMachine::setTapeAlphabet(const std::vector<std::string> &tapeAlphabet, const bool &strict) {
-	this->tapeAlphabet = std::unordered_set<std::string>(tapeAlphabet.begin(), tapeAlphabet.end());
+	std::vector<SymbolId> tapeAlphabetIds = SymbolTable::intern(tapeAlphabet);
+	this->tapeAlphabet = std::unordered_set<SymbolId>(tapeAlphabetIds.begin(), tapeAlphabetIds.end());
 
 	// remove elements in new tape alphabet but not input alphabet
 	std::unordered_set<std::string> missingSymbols;
 	for (auto &inputSymbol : inputAlphabet) {
-		if (!tapeAlphabetSymbolExists(inputSymbol)) {
-			missingSymbols.insert(inputSymbol);
+		if (this->tapeAlphabet.find(inputSymbol) == this->tapeAlphabet.end()) {
+			missingSymbols.insert(SymbolTable::getSymbol(inputSymbol));
 		}
 	}
 	for (auto &symbol : missingSymbols) {
@@ -550,7 +623,7 @@ void TuringMachine::setTapeAlphabet(const std::vector<std::string> &tapeAlphabet
 
 void TuringMachine::addTapeAlphabet(const std::vector<std::string> &tapeAlphabet) {
 	for (const auto &symbol : tapeAlphabet) {
-		this->tapeAlphabet.insert(symbol);
+		this->tapeAlphabet.insert(SymbolTable::intern(symbol));
 	}
 	tapeAlphabetCacheInvalidated = true;
 }
@@ -560,7 +633,7 @@ std::vector<std::string> TuringMachine::getTapeAlphabet() {
 	if (tapeAlphabetCacheInvalidated) {
 		cachedTapeAlphabet.clear();
 		for (const auto &symbol : tapeAlphabet) {
-			cachedTapeAlphabet.push_back(symbol);
+			cachedTapeAlphabet.push_back(SymbolTable::getSymbol(symbol));
 		}
 		tapeAlphabetCacheInvalidated = true;
 	}
@@ -572,6 +645,7 @@ void TuringMachine::removeTapeAlphabetSymbol(const std::string &symbol, const bo
 	if (!tapeAlphabetSymbolExists(symbol)) {
 		throw TapeAlphabetSymbolNotFoundException(symbol);
 	}
+	SymbolId symbolId = SymbolTable::find(symbol);
 
 	std::vector<std::string> conflictingTransitions;
 
@@ -579,11 +653,11 @@ void TuringMachine::removeTapeAlphabetSymbol(const std::string &symbol, const bo
 	for (auto &pair : states) {
 		std::vector<TMTransition> transitions = pair.second.getTransitions();
 		for (const auto &transition : transitions) {
-			if (transition.getReadSymbol() == symbol || transition.getWriteSymbol() == symbol) {
+			if (transition.getReadSymbolId() == symbolId || transition.getWriteSymbolId() == symbolId) {
 				if (strict) {
 					conflictingTransitions.push_back(transition.getKey());
 				} else {
-					pair.second.removeTransition(transition.getKey());
+					removeTransitionInternal(pair.second, transition);
 				}
 			}
 		}
@@ -605,7 +679,7 @@ void TuringMachine::removeTapeAlphabetSymbol(const std::string &symbol, const bo
 		removeInputAlphabetSymbol(symbol);
 	}
 
-	tapeAlphabet.erase(symbol);
+	tapeAlphabet.erase(symbolId);
 	tapeAlphabetCacheInvalidated = true;
 }
 
@@ -632,7 +706,7 @@ void TuringMachine::removeTapeAlphabetSymbols(const std::vector<std::string> &sy
 
 	// If no missing symbols found then we remove
 	for (const auto &symbol : symbols) {
-		tapeAlphabet.erase(symbol);
+		tapeAlphabet.erase(SymbolTable::find(symbol));
 	}
 
 	// Remove symbols from input alphabet (subset)
@@ -649,12 +723,13 @@ void TuringMachine::clearTapeAlphabet(const bool &strict) {
 	for (auto &pair : states) {
 		std::vector<TMTransition> transitions = pair.second.getTransitions();
 		for (const auto &transition : transitions) {
-			if (!transition.getReadSymbol().empty() || !transition.getWriteSymbol().empty()) {
+			if (transition.getReadSymbolId() != SymbolTable::EPSILON_SYMBOL_ID ||
+			    transition.getWriteSymbolId() != SymbolTable::EPSILON_SYMBOL_ID) {
 				if (strict) {
 					throw InvalidAutomatonDefinitionException(
 					    "Cannot clear input alphabet because non-epsilon transitions exist");
 				} else {
-					pair.second.removeTransition(transition.getKey());
+					removeTransitionInternal(pair.second, transition);
 				}
 			}
 		}
@@ -689,6 +764,7 @@ void TuringMachine::addTransition(const std::string &fromStateKey, const std::st
 	validateTransition(fromStateKey, toStateKey, readSymbol, writeSymbol, direction);
 	TMState *state = getStateInternal(fromStateKey);
 	state->addTransition(toStateKey, readSymbol, writeSymbol, direction);
+	indexTransition(TMTransition(fromStateKey, toStateKey, readSymbol, writeSymbol, direction));
 	statesCacheInvalidated = true;
 }
 
@@ -720,9 +796,10 @@ void TuringMachine::updateTransitionFromState(const std::string &transitionKey,
 	TMState *newFromState = getStateInternal(fromStateKey);
 
 	// Remove the transition from the old from state
-	oldFromState->removeTransition(transitionKey);
+	removeTransitionInternal(*oldFromState, oldFromState->getTransition(transitionKey));
 	// Add the transition to the new from state
 	newFromState->addTransition(toStateKey, readSymbol, writeSymbol, direction);
+	indexTransition(newFromState->getTransition(newTransitionKey));
 	statesCacheInvalidated = true;
 }
 
@@ -750,7 +827,9 @@ void TuringMachine::updateTransitionToState(const std::string &transitionKey, co
 		throw TransitionNotFoundException(transitionKey);
 	}
 
+	unindexTransition(fromState->getTransition(transitionKey));
 	fromState->setTransitionToState(transitionKey, toStateKey);
+	indexTransition(fromState->getTransition(newTransitionKey));
 	statesCacheInvalidated = true;
 }
 
@@ -778,7 +857,9 @@ void TuringMachine::updateTransitionReadSymbol(const std::string &transitionKey,
 		throw TransitionNotFoundException(transitionKey);
 	}
 
+	unindexTransition(fromState->getTransition(transitionKey));
 	fromState->setTransitionReadSymbol(transitionKey, readSymbol);
+	indexTransition(fromState->getTransition(newTransitionKey));
 	statesCacheInvalidated = true;
 }
 
@@ -806,7 +887,9 @@ void TuringMachine::updateTransitionWriteSymbol(const std::string &transitionKey
 		throw TransitionNotFoundException(transitionKey);
 	}
 
+	unindexTransition(fromState->getTransition(transitionKey));
 	fromState->setTransitionWriteSymbol(transitionKey, writeSymbol);
+	indexTransition(fromState->getTransition(newTransitionKey));
 	statesCacheInvalidated = true;
 }
 
@@ -834,7 +917,9 @@ void TuringMachine::updateTransitionDirection(const std::string &transitionKey,
 		throw TransitionNotFoundException(transitionKey);
 	}
 
+	unindexTransition(fromState->getTransition(transitionKey));
 	fromState->setTransitionDirection(transitionKey, direction);
+	indexTransition(fromState->getTransition(newTransitionKey));
 	statesCacheInvalidated = true;
 }
 
@@ -842,18 +927,26 @@ void TuringMachine::removeTransition(const std::string &transitionKey) {
 	std::string fromStateKey = TMTransition::getFromStateFromKey(transitionKey);
 
 	TMState *fromState = getStateInternal(fromStateKey);
-	fromState->removeTransition(transitionKey);
+	removeTransitionInternal(*fromState, fromState->getTransition(transitionKey));
 	statesCacheInvalidated = true;
 }
 
 void TuringMachine::clearTransitionsBetween(const std::string &fromStateKey, const std::string &toStateKey) {
 	TMState *fromState = getStateInternal(fromStateKey);
+	for (const auto &transition : fromState->getTransitionsView()) {
+		if (transition.getToStateKey() == toStateKey) {
+			unindexTransition(transition);
+		}
+	}
 	fromState->clearTransitionsTo(toStateKey);
 	statesCacheInvalidated = true;
 }
 
 void TuringMachine::clearStateTransitions(const std::string &key) {
 	TMState *state = getStateInternal(key);
+	for (const auto &transition : state->getTransitionsView()) {
+		unindexTransition(transition);
+	}
 	state->clearTransitions();
 	statesCacheInvalidated = true;
 }
@@ -862,6 +955,7 @@ void TuringMachine::clearTransitions() {
 	for (auto &pair : states) {
 		pair.second.clearTransitions();
 	}
+	incomingTransitions.clear();
 	statesCacheInvalidated = true;
 }
 
@@ -972,7 +1066,7 @@ bool TuringMachine::checkNextState(const std::string &key) const {
 		throw StateNotFoundException(key);
 	}
 
-	const std::string &tapeValue = tape.read();
+	SymbolId tapeValue = tape.readId();
 
 	TMState state = getState(currentState);
 	const std::vector<TMTransition> &transitions = state.getTransitions();
@@ -981,7 +1075,7 @@ bool TuringMachine::checkNextState(const std::string &key) const {
 		if (transition.getToStateKey() != key) {
 			continue;
 		}
-		if (transition.getReadSymbol().empty() || transition.getReadSymbol() == tapeValue) {
+		if (transition.getReadSymbolId() == SymbolTable::EPSILON_SYMBOL_ID || transition.getReadSymbolId() == tapeValue) {
 			return true;
 		}
 	}
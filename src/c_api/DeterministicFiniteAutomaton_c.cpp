@@ -87,7 +87,7 @@ const FAStateHandle DFA_getState(DFAHandle dfa, const char *key, AutomatonError
 const FAStateArray DFA_getStates(DFAHandle dfa, AutomatonError *error) {
 	return wrap_result<const FAStateArray>(
 	    [&]() {
-		    auto states = reinterpret_cast<DeterministicFiniteAutomaton *>(dfa)->getStates();
+		    const auto &states = reinterpret_cast<DeterministicFiniteAutomaton *>(dfa)->getStatesView();
 
 		    FAStateArray array;
 		    array.length = states.size();
@@ -314,7 +314,68 @@ const bool DFA_simulate(DFAHandle dfa, const char **input, const size_t length,
 	    error);
 }
 
+void DFA_simulateBatch(DFAHandle dfa, const char ***inputs, const size_t *lengths, const size_t count, bool *results,
+                       const int simulationDepth, AutomatonError *error) {
+	wrap_result(
+	    [&]() {
+		    std::vector<std::vector<std::string>> input_vecs;
+		    input_vecs.reserve(count);
+		    for (size_t i = 0; i < count; i++) {
+			    input_vecs.emplace_back(inputs[i], inputs[i] + lengths[i]);
+		    }
+		    std::vector<bool> batch_results =
+		        reinterpret_cast<DeterministicFiniteAutomaton *>(dfa)->simulateBatch(input_vecs, simulationDepth);
+		    std::copy(batch_results.begin(), batch_results.end(), results);
+	    },
+	    error);
+}
+
+void DFA_simulateBatchParallel(DFAHandle dfa, const char ***inputs, const size_t *lengths, const size_t count,
+                               bool *results, const size_t threadCount, const int simulationDepth,
+                               AutomatonError *error) {
+	wrap_result(
+	    [&]() {
+		    std::vector<std::vector<std::string>> input_vecs;
+		    input_vecs.reserve(count);
+		    for (size_t i = 0; i < count; i++) {
+			    input_vecs.emplace_back(inputs[i], inputs[i] + lengths[i]);
+		    }
+		    auto *automaton = reinterpret_cast<DeterministicFiniteAutomaton *>(dfa);
+		    std::vector<bool> batch_results =
+		        automaton->simulateBatchParallel(input_vecs, threadCount, simulationDepth);
+		    std::copy(batch_results.begin(), batch_results.end(), results);
+	    },
+	    error);
+}
+
 const bool DFA_checkNextState(DFAHandle dfa, const char *key, AutomatonError *error) {
 	return wrap_result<const bool>(
 	    [&]() { return reinterpret_cast<DeterministicFiniteAutomaton *>(dfa)->checkNextState(key); }, error);
-}
\ No newline at end of file
+}
+
+void DFA_compile(DFAHandle dfa, AutomatonError *error) {
+	wrap_result([&]() { reinterpret_cast<DeterministicFiniteAutomaton *>(dfa)->compile(); }, error);
+}
+
+const bool DFA_isCompiled(DFAHandle dfa, AutomatonError *error) {
+	return wrap_result<const bool>(
+	    [&]() { return reinterpret_cast<DeterministicFiniteAutomaton *>(dfa)->isCompiled(); }, error);
+}
+
+DFAHandle DFA_minimize(DFAHandle dfa, AutomatonError *error) {
+	return wrap_result<DFAHandle>(
+	    [&]() {
+		    return reinterpret_cast<DFAHandle>(
+		        new DeterministicFiniteAutomaton(reinterpret_cast<DeterministicFiniteAutomaton *>(dfa)->minimize()));
+	    },
+	    error, {});
+}
+
+FrozenDFAHandle DFA_freeze(DFAHandle dfa, AutomatonError *error) {
+	return wrap_result<FrozenDFAHandle>(
+	    [&]() {
+		    auto *automaton = reinterpret_cast<DeterministicFiniteAutomaton *>(dfa);
+		    return reinterpret_cast<FrozenDFAHandle>(new FrozenDFA(automaton->freeze()));
+	    },
+	    error, {});
+}
@@ -88,7 +88,7 @@ const PDAStateHandle DPDA_getState(DPDAHandle dpda, const char *key, AutomatonEr
 const PDAStateArray DPDA_getStates(DPDAHandle dpda, AutomatonError *error) {
 	return wrap_result<PDAStateArray>(
 	    [&]() {
-		    auto states = reinterpret_cast<DeterministicPushdownAutomaton *>(dpda)->getStates();
+		    const auto &states = reinterpret_cast<DeterministicPushdownAutomaton *>(dpda)->getStatesView();
 
 		    PDAStateArray array;
 		    array.length = states.size();
@@ -388,6 +388,40 @@ const bool DPDA_simulate(DPDAHandle dpda, const char **input, const size_t lengt
 	    error);
 }
 
+void DPDA_simulateBatch(DPDAHandle dpda, const char ***inputs, const size_t *lengths, const size_t count, bool *results,
+                        const int simulationDepth, AutomatonError *error) {
+	wrap_result(
+	    [&]() {
+		    std::vector<std::vector<std::string>> input_vecs;
+		    input_vecs.reserve(count);
+		    for (size_t i = 0; i < count; i++) {
+			    input_vecs.emplace_back(inputs[i], inputs[i] + lengths[i]);
+		    }
+		    std::vector<bool> batch_results =
+		        reinterpret_cast<DeterministicPushdownAutomaton *>(dpda)->simulateBatch(input_vecs, simulationDepth);
+		    std::copy(batch_results.begin(), batch_results.end(), results);
+	    },
+	    error);
+}
+
+void DPDA_simulateBatchParallel(DPDAHandle dpda, const char ***inputs, const size_t *lengths, const size_t count,
+                                bool *results, const size_t threadCount, const int simulationDepth,
+                                AutomatonError *error) {
+	wrap_result(
+	    [&]() {
+		    std::vector<std::vector<std::string>> input_vecs;
+		    input_vecs.reserve(count);
+		    for (size_t i = 0; i < count; i++) {
+			    input_vecs.emplace_back(inputs[i], inputs[i] + lengths[i]);
+		    }
+		    auto *automaton = reinterpret_cast<DeterministicPushdownAutomaton *>(dpda);
+		    std::vector<bool> batch_results =
+		        automaton->simulateBatchParallel(input_vecs, threadCount, simulationDepth);
+		    std::copy(batch_results.begin(), batch_results.end(), results);
+	    },
+	    error);
+}
+
 StringArray DPDA_getStack(DPDAHandle dpda, AutomatonError *error) {
 	return wrap_result<StringArray>(
 	    [&]() {
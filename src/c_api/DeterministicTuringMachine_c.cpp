@@ -78,7 +78,7 @@ const TMStateHandle DTM_getState(DTMHandle dpda, const char *key, AutomatonError
 const TMStateArray DTM_getStates(DTMHandle dpda, AutomatonError *error) {
 	return wrap_result<TMStateArray>(
 	    [&]() {
-		    auto states = reinterpret_cast<DeterministicTuringMachine *>(dpda)->getStates();
+		    const auto &states = reinterpret_cast<DeterministicTuringMachine *>(dpda)->getStatesView();
 
 		    TMStateArray array;
 		    array.length = states.size();
@@ -376,6 +376,57 @@ const bool DTM_simulate(DTMHandle dpda, const char **readSymbol, const size_t le
 	    error);
 }
 
+const bool DTM_simulateAccelerated(DTMHandle dtm, const char **input, const size_t length, const int simulationDepth,
+                                   uint64_t *stepCount, AutomatonError *error) {
+	return wrap_result<bool>(
+	    [&]() {
+		    std::vector<std::string> input_vec(input, input + length);
+		    // A null stepCount means the caller does not want the count reported
+		    uint64_t steps = 0;
+		    bool accepted = reinterpret_cast<DeterministicTuringMachine *>(dtm)->simulateAccelerated(
+		        input_vec, simulationDepth, steps);
+		    if (stepCount != nullptr) {
+			    *stepCount = steps;
+		    }
+		    return accepted;
+	    },
+	    error);
+}
+
+void DTM_simulateBatch(DTMHandle dtm, const char ***inputs, const size_t *lengths, const size_t count, bool *results,
+                       const int simulationDepth, AutomatonError *error) {
+	wrap_result(
+	    [&]() {
+		    std::vector<std::vector<std::string>> input_vecs;
+		    input_vecs.reserve(count);
+		    for (size_t i = 0; i < count; i++) {
+			    input_vecs.emplace_back(inputs[i], inputs[i] + lengths[i]);
+		    }
+		    std::vector<bool> batch_results =
+		        reinterpret_cast<DeterministicTuringMachine *>(dtm)->simulateBatch(input_vecs, simulationDepth);
+		    std::copy(batch_results.begin(), batch_results.end(), results);
+	    },
+	    error);
+}
+
+void DTM_simulateBatchParallel(DTMHandle dtm, const char ***inputs, const size_t *lengths, const size_t count,
+                               bool *results, const size_t threadCount, const int simulationDepth,
+                               AutomatonError *error) {
+	wrap_result(
+	    [&]() {
+		    std::vector<std::vector<std::string>> input_vecs;
+		    input_vecs.reserve(count);
+		    for (size_t i = 0; i < count; i++) {
+			    input_vecs.emplace_back(inputs[i], inputs[i] + lengths[i]);
+		    }
+		    auto *automaton = reinterpret_cast<DeterministicTuringMachine *>(dtm);
+		    std::vector<bool> batch_results =
+		        automaton->simulateBatchParallel(input_vecs, threadCount, simulationDepth);
+		    std::copy(batch_results.begin(), batch_results.end(), results);
+	    },
+	    error);
+}
+
 void DTM_setTape(DTMHandle dtm, const char **&tape, const size_t &length, AutomatonError *error) {
 	wrap_result(
 	    [&]() {
@@ -430,4 +481,13 @@ const char *DTM_readTape(DTMHandle dtm, AutomatonError *error) {
 const bool DTM_checkNextState(DTMHandle dtm, const char *key, AutomatonError *error) {
 	return wrap_result<const bool>(
 	    [&]() { return reinterpret_cast<DeterministicTuringMachine *>(dtm)->checkNextState(key); }, error);
-}
\ No newline at end of file
+}
+
+FrozenDTMHandle DTM_freeze(DTMHandle dtm, AutomatonError *error) {
+	return wrap_result<FrozenDTMHandle>(
+	    [&]() {
+		    auto *automaton = reinterpret_cast<DeterministicTuringMachine *>(dtm);
+		    return reinterpret_cast<FrozenDTMHandle>(new FrozenDTM(automaton->freeze()));
+	    },
+	    error, {});
+}
@@ -69,7 +69,7 @@ void FAState_clearTransitionsTo(FAStateHandle state, char *toStateKey) {
 }
 
 const FATransitionArray FAState_getTransitions(FAStateHandle state) {
-	auto transitions = state->instance.getTransitions();
+	const auto &transitions = state->instance.getTransitionsView();
 
 	FATransitionArray array;
 	array.length = transitions.size();
@@ -0,0 +1,62 @@
+#include "AutomataSimulator/c_api/FrozenDFA_c.h"
+
+struct FrozenDFA_t {
+	FrozenDFA instance;
+};
+
+void FrozenDFA_destroy(FrozenDFAHandle frozen, AutomatonError *error) {
+	wrap_result([&]() { delete reinterpret_cast<FrozenDFA *>(frozen); }, error);
+}
+
+const char *FrozenDFA_getStartState(FrozenDFAHandle frozen, AutomatonError *error) {
+	return wrap_result<const char *>(
+	    [&]() { return convertToCString(reinterpret_cast<const FrozenDFA *>(frozen)->getStartState()); }, error);
+}
+
+const size_t FrozenDFA_getStateCount(FrozenDFAHandle frozen, AutomatonError *error) {
+	return wrap_result<const size_t>(
+	    [&]() { return reinterpret_cast<const FrozenDFA *>(frozen)->getStateCount(); }, error);
+}
+
+const bool FrozenDFA_simulate(FrozenDFAHandle frozen, const char **input, const size_t length,
+                              const int simulationDepth, AutomatonError *error) {
+	return wrap_result<const bool>(
+	    [&]() {
+		    std::vector<std::string> input_vec(input, input + length);
+		    return reinterpret_cast<const FrozenDFA *>(frozen)->simulate(input_vec, simulationDepth);
+	    },
+	    error);
+}
+
+void FrozenDFA_simulateBatch(FrozenDFAHandle frozen, const char ***inputs, const size_t *lengths, const size_t count,
+                             bool *results, const int simulationDepth, AutomatonError *error) {
+	wrap_result(
+	    [&]() {
+		    std::vector<std::vector<std::string>> input_vecs;
+		    input_vecs.reserve(count);
+		    for (size_t i = 0; i < count; i++) {
+			    input_vecs.emplace_back(inputs[i], inputs[i] + lengths[i]);
+		    }
+		    const auto *snapshot = reinterpret_cast<const FrozenDFA *>(frozen);
+		    std::vector<bool> batch_results = snapshot->simulateBatch(input_vecs, simulationDepth);
+		    std::copy(batch_results.begin(), batch_results.end(), results);
+	    },
+	    error);
+}
+
+void FrozenDFA_simulateBatchParallel(FrozenDFAHandle frozen, const char ***inputs, const size_t *lengths,
+                                     const size_t count, bool *results, const size_t threadCount,
+                                     const int simulationDepth, AutomatonError *error) {
+	wrap_result(
+	    [&]() {
+		    std::vector<std::vector<std::string>> input_vecs;
+		    input_vecs.reserve(count);
+		    for (size_t i = 0; i < count; i++) {
+			    input_vecs.emplace_back(inputs[i], inputs[i] + lengths[i]);
+		    }
+		    const auto *snapshot = reinterpret_cast<const FrozenDFA *>(frozen);
+		    std::vector<bool> batch_results = snapshot->simulateBatchParallel(input_vecs, threadCount, simulationDepth);
+		    std::copy(batch_results.begin(), batch_results.end(), results);
+	    },
+	    error);
+}
@@ -0,0 +1,62 @@
+#include "AutomataSimulator/c_api/FrozenDTM_c.h"
+
+struct FrozenDTM_t {
+	FrozenDTM instance;
+};
+
+void FrozenDTM_destroy(FrozenDTMHandle frozen, AutomatonError *error) {
+	wrap_result([&]() { delete reinterpret_cast<FrozenDTM *>(frozen); }, error);
+}
+
+const char *FrozenDTM_getStartState(FrozenDTMHandle frozen, AutomatonError *error) {
+	return wrap_result<const char *>(
+	    [&]() { return convertToCString(reinterpret_cast<const FrozenDTM *>(frozen)->getStartState()); }, error);
+}
+
+const size_t FrozenDTM_getStateCount(FrozenDTMHandle frozen, AutomatonError *error) {
+	return wrap_result<const size_t>(
+	    [&]() { return reinterpret_cast<const FrozenDTM *>(frozen)->getStateCount(); }, error);
+}
+
+const bool FrozenDTM_simulate(FrozenDTMHandle frozen, const char **input, const size_t length,
+                              const int simulationDepth, AutomatonError *error) {
+	return wrap_result<const bool>(
+	    [&]() {
+		    std::vector<std::string> input_vec(input, input + length);
+		    return reinterpret_cast<const FrozenDTM *>(frozen)->simulate(input_vec, simulationDepth);
+	    },
+	    error);
+}
+
+void FrozenDTM_simulateBatch(FrozenDTMHandle frozen, const char ***inputs, const size_t *lengths, const size_t count,
+                             bool *results, const int simulationDepth, AutomatonError *error) {
+	wrap_result(
+	    [&]() {
+		    std::vector<std::vector<std::string>> input_vecs;
+		    input_vecs.reserve(count);
+		    for (size_t i = 0; i < count; i++) {
+			    input_vecs.emplace_back(inputs[i], inputs[i] + lengths[i]);
+		    }
+		    const auto *snapshot = reinterpret_cast<const FrozenDTM *>(frozen);
+		    std::vector<bool> batch_results = snapshot->simulateBatch(input_vecs, simulationDepth);
+		    std::copy(batch_results.begin(), batch_results.end(), results);
+	    },
+	    error);
+}
+
+void FrozenDTM_simulateBatchParallel(FrozenDTMHandle frozen, const char ***inputs, const size_t *lengths,
+                                     const size_t count, bool *results, const size_t threadCount,
+                                     const int simulationDepth, AutomatonError *error) {
+	wrap_result(
+	    [&]() {
+		    std::vector<std::vector<std::string>> input_vecs;
+		    input_vecs.reserve(count);
+		    for (size_t i = 0; i < count; i++) {
+			    input_vecs.emplace_back(inputs[i], inputs[i] + lengths[i]);
+		    }
+		    const auto *snapshot = reinterpret_cast<const FrozenDTM *>(frozen);
+		    std::vector<bool> batch_results = snapshot->simulateBatchParallel(input_vecs, threadCount, simulationDepth);
+		    std::copy(batch_results.begin(), batch_results.end(), results);
+	    },
+	    error);
+}
@@ -0,0 +1,72 @@
+#include "AutomataSimulator/c_api/FrozenNPDA_c.h"
+
+struct FrozenNPDA_t {
+	FrozenNPDA instance;
+};
+
+void FrozenNPDA_destroy(FrozenNPDAHandle frozen, AutomatonError *error) {
+	wrap_result([&]() { delete reinterpret_cast<FrozenNPDA *>(frozen); }, error);
+}
+
+const char *FrozenNPDA_getStartState(FrozenNPDAHandle frozen, AutomatonError *error) {
+	return wrap_result<const char *>(
+	    [&]() { return convertToCString(reinterpret_cast<const FrozenNPDA *>(frozen)->getStartState()); }, error);
+}
+
+const size_t FrozenNPDA_getStateCount(FrozenNPDAHandle frozen, AutomatonError *error) {
+	return wrap_result<const size_t>(
+	    [&]() { return reinterpret_cast<const FrozenNPDA *>(frozen)->getStateCount(); }, error);
+}
+
+const bool FrozenNPDA_simulate(FrozenNPDAHandle frozen, const char **input, const size_t length,
+                               const int simulationDepth, AutomatonError *error) {
+	return wrap_result<const bool>(
+	    [&]() {
+		    std::vector<std::string> input_vec(input, input + length);
+		    return reinterpret_cast<const FrozenNPDA *>(frozen)->simulate(input_vec, simulationDepth);
+	    },
+	    error);
+}
+
+void FrozenNPDA_simulateBatch(FrozenNPDAHandle frozen, const char ***inputs, const size_t *lengths, const size_t count,
+                              bool *results, const int simulationDepth, AutomatonError *error) {
+	wrap_result(
+	    [&]() {
+		    std::vector<std::vector<std::string>> input_vecs;
+		    input_vecs.reserve(count);
+		    for (size_t i = 0; i < count; i++) {
+			    input_vecs.emplace_back(inputs[i], inputs[i] + lengths[i]);
+		    }
+		    const auto *snapshot = reinterpret_cast<const FrozenNPDA *>(frozen);
+		    std::vector<bool> batch_results = snapshot->simulateBatch(input_vecs, simulationDepth);
+		    std::copy(batch_results.begin(), batch_results.end(), results);
+	    },
+	    error);
+}
+
+void FrozenNPDA_simulateBatchParallel(FrozenNPDAHandle frozen, const char ***inputs, const size_t *lengths,
+                                      const size_t count, bool *results, const size_t threadCount,
+                                      const int simulationDepth, AutomatonError *error) {
+	wrap_result(
+	    [&]() {
+		    std::vector<std::vector<std::string>> input_vecs;
+		    input_vecs.reserve(count);
+		    for (size_t i = 0; i < count; i++) {
+			    input_vecs.emplace_back(inputs[i], inputs[i] + lengths[i]);
+		    }
+		    const auto *snapshot = reinterpret_cast<const FrozenNPDA *>(frozen);
+		    std::vector<bool> batch_results = snapshot->simulateBatchParallel(input_vecs, threadCount, simulationDepth);
+		    std::copy(batch_results.begin(), batch_results.end(), results);
+	    },
+	    error);
+}
+
+const bool FrozenNPDA_simulateGSS(FrozenNPDAHandle frozen, const char **input, const size_t length,
+                                  AutomatonError *error) {
+	return wrap_result<const bool>(
+	    [&]() {
+		    std::vector<std::string> input_vec(input, input + length);
+		    return reinterpret_cast<const FrozenNPDA *>(frozen)->simulateGSS(input_vec);
+	    },
+	    error);
+}
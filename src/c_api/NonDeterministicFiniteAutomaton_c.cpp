@@ -89,7 +89,7 @@ const FAStateHandle NFA_getState(NFAHandle nfa, const char *key, AutomatonError
 const FAStateArray NFA_getStates(NFAHandle nfa, AutomatonError *error) {
 	return wrap_result<const FAStateArray>(
 	    [&]() {
-		    auto states = reinterpret_cast<NonDeterministicFiniteAutomaton *>(nfa)->getStates();
+		    const auto &states = reinterpret_cast<NonDeterministicFiniteAutomaton *>(nfa)->getStatesView();
 
 		    FAStateArray array;
 		    array.length = states.size();
@@ -322,6 +322,40 @@ const bool NFA_simulate(NFAHandle nfa, const char **input, const size_t length,
 	    error);
 }
 
+void NFA_simulateBatch(NFAHandle nfa, const char ***inputs, const size_t *lengths, const size_t count, bool *results,
+                       const int simulationDepth, AutomatonError *error) {
+	wrap_result(
+	    [&]() {
+		    std::vector<std::vector<std::string>> input_vecs;
+		    input_vecs.reserve(count);
+		    for (size_t i = 0; i < count; i++) {
+			    input_vecs.emplace_back(inputs[i], inputs[i] + lengths[i]);
+		    }
+		    std::vector<bool> batch_results =
+		        reinterpret_cast<NonDeterministicFiniteAutomaton *>(nfa)->simulateBatch(input_vecs, simulationDepth);
+		    std::copy(batch_results.begin(), batch_results.end(), results);
+	    },
+	    error);
+}
+
+void NFA_simulateBatchParallel(NFAHandle nfa, const char ***inputs, const size_t *lengths, const size_t count,
+                               bool *results, const size_t threadCount, const int simulationDepth,
+                               AutomatonError *error) {
+	wrap_result(
+	    [&]() {
+		    std::vector<std::vector<std::string>> input_vecs;
+		    input_vecs.reserve(count);
+		    for (size_t i = 0; i < count; i++) {
+			    input_vecs.emplace_back(inputs[i], inputs[i] + lengths[i]);
+		    }
+		    auto *automaton = reinterpret_cast<NonDeterministicFiniteAutomaton *>(nfa);
+		    std::vector<bool> batch_results =
+		        automaton->simulateBatchParallel(input_vecs, threadCount, simulationDepth);
+		    std::copy(batch_results.begin(), batch_results.end(), results);
+	    },
+	    error);
+}
+
 const FAStateArray NFA_getPossibleCurrentStates(NFAHandle nfa, AutomatonError *error) {
 	return wrap_result<const FAStateArray>(
 	    [&]() {
@@ -343,4 +377,36 @@ const FAStateArray NFA_getPossibleCurrentStates(NFAHandle nfa, AutomatonError *e
 const bool NFA_checkNextState(NFAHandle nfa, const char *key, AutomatonError *error) {
 	return wrap_result<const bool>(
 	    [&]() { return reinterpret_cast<NonDeterministicFiniteAutomaton *>(nfa)->checkNextState(key); }, error);
-}
\ No newline at end of file
+}
+
+void NFA_compile(NFAHandle nfa, AutomatonError *error) {
+	wrap_result([&]() { reinterpret_cast<NonDeterministicFiniteAutomaton *>(nfa)->compile(); }, error);
+}
+
+const bool NFA_isCompiled(NFAHandle nfa, AutomatonError *error) {
+	return wrap_result<const bool>(
+	    [&]() { return reinterpret_cast<NonDeterministicFiniteAutomaton *>(nfa)->isCompiled(); }, error);
+}
+
+void NFA_enableLazyDFA(NFAHandle nfa, const size_t memoryBudget, AutomatonError *error) {
+	wrap_result([&]() { reinterpret_cast<NonDeterministicFiniteAutomaton *>(nfa)->enableLazyDFA(memoryBudget); },
+	            error);
+}
+
+void NFA_disableLazyDFA(NFAHandle nfa, AutomatonError *error) {
+	wrap_result([&]() { reinterpret_cast<NonDeterministicFiniteAutomaton *>(nfa)->disableLazyDFA(); }, error);
+}
+
+const bool NFA_isLazyDFAEnabled(NFAHandle nfa, AutomatonError *error) {
+	return wrap_result<const bool>(
+	    [&]() { return reinterpret_cast<NonDeterministicFiniteAutomaton *>(nfa)->isLazyDFAEnabled(); }, error);
+}
+
+DFAHandle NFA_toDFA(NFAHandle nfa, const size_t maxStates, AutomatonError *error) {
+	return wrap_result<DFAHandle>(
+	    [&]() {
+		    return reinterpret_cast<DFAHandle>(new DeterministicFiniteAutomaton(
+		        reinterpret_cast<NonDeterministicFiniteAutomaton *>(nfa)->toDFA(maxStates)));
+	    },
+	    error, {});
+}
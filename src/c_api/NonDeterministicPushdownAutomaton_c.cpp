@@ -93,7 +93,7 @@ const PDAStateHandle NPDA_getState(NPDAHandle npda, const char *key, AutomatonEr
 const PDAStateArray NPDA_getStates(NPDAHandle npda, AutomatonError *error) {
 	return wrap_result<PDAStateArray>(
 	    [&]() {
-		    auto states = reinterpret_cast<NonDeterministicPushdownAutomaton *>(npda)->getStates();
+		    const auto &states = reinterpret_cast<NonDeterministicPushdownAutomaton *>(npda)->getStatesView();
 
 		    PDAStateArray array;
 		    array.length = states.size();
@@ -408,6 +408,40 @@ const bool NPDA_simulate(NPDAHandle npda, const char **input, const size_t lengt
 	    error);
 }
 
+void NPDA_simulateBatch(NPDAHandle npda, const char ***inputs, const size_t *lengths, const size_t count, bool *results,
+                        const int simulationDepth, AutomatonError *error) {
+	wrap_result(
+	    [&]() {
+		    std::vector<std::vector<std::string>> input_vecs;
+		    input_vecs.reserve(count);
+		    for (size_t i = 0; i < count; i++) {
+			    input_vecs.emplace_back(inputs[i], inputs[i] + lengths[i]);
+		    }
+		    std::vector<bool> batch_results =
+		        reinterpret_cast<NonDeterministicPushdownAutomaton *>(npda)->simulateBatch(input_vecs, simulationDepth);
+		    std::copy(batch_results.begin(), batch_results.end(), results);
+	    },
+	    error);
+}
+
+void NPDA_simulateBatchParallel(NPDAHandle npda, const char ***inputs, const size_t *lengths, const size_t count,
+                                bool *results, const size_t threadCount, const int simulationDepth,
+                                AutomatonError *error) {
+	wrap_result(
+	    [&]() {
+		    std::vector<std::vector<std::string>> input_vecs;
+		    input_vecs.reserve(count);
+		    for (size_t i = 0; i < count; i++) {
+			    input_vecs.emplace_back(inputs[i], inputs[i] + lengths[i]);
+		    }
+		    auto *automaton = reinterpret_cast<NonDeterministicPushdownAutomaton *>(npda);
+		    std::vector<bool> batch_results =
+		        automaton->simulateBatchParallel(input_vecs, threadCount, simulationDepth);
+		    std::copy(batch_results.begin(), batch_results.end(), results);
+	    },
+	    error);
+}
+
 const PDAStateArray NPDA_getPossibleCurrentStates(NPDAHandle npda, AutomatonError *error) {
 	return wrap_result<PDAStateArray>(
 	    [&]() {
@@ -487,4 +521,22 @@ void NPDA_resetStack(NPDAHandle dpda, AutomatonError *error) {
 const bool NPDA_checkNextState(NPDAHandle dpda, const char *key, AutomatonError *error) {
 	return wrap_result<const bool>(
 	    [&]() { return reinterpret_cast<NonDeterministicPushdownAutomaton *>(dpda)->checkNextState(key); }, error);
-}
\ No newline at end of file
+}
+
+FrozenNPDAHandle NPDA_freeze(NPDAHandle npda, AutomatonError *error) {
+	return wrap_result<FrozenNPDAHandle>(
+	    [&]() {
+		    auto *automaton = reinterpret_cast<NonDeterministicPushdownAutomaton *>(npda);
+		    return reinterpret_cast<FrozenNPDAHandle>(new FrozenNPDA(automaton->freeze()));
+	    },
+	    error, {});
+}
+
+const bool NPDA_simulateGSS(NPDAHandle npda, const char **input, const size_t length, AutomatonError *error) {
+	return wrap_result<bool>(
+	    [&]() {
+		    std::vector<std::string> input_vec(input, input + length);
+		    return reinterpret_cast<NonDeterministicPushdownAutomaton *>(npda)->simulateGSS(input_vec);
+	    },
+	    error);
+}
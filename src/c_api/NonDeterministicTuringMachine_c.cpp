@@ -79,7 +79,7 @@ const TMStateHandle NTM_getState(NTMHandle npda, const char *key, AutomatonError
 const TMStateArray NTM_getStates(NTMHandle npda, AutomatonError *error) {
 	return wrap_result<TMStateArray>(
 	    [&]() {
-		    auto states = reinterpret_cast<NonDeterministicTuringMachine *>(npda)->getStates();
+		    const auto &states = reinterpret_cast<NonDeterministicTuringMachine *>(npda)->getStatesView();
 
 		    TMStateArray array;
 		    array.length = states.size();
@@ -380,6 +380,40 @@ const bool NTM_simulate(NTMHandle npda, const char **readSymbol, const size_t le
 	    error);
 }
 
+void NTM_simulateBatch(NTMHandle ntm, const char ***inputs, const size_t *lengths, const size_t count, bool *results,
+                       const int simulationDepth, AutomatonError *error) {
+	wrap_result(
+	    [&]() {
+		    std::vector<std::vector<std::string>> input_vecs;
+		    input_vecs.reserve(count);
+		    for (size_t i = 0; i < count; i++) {
+			    input_vecs.emplace_back(inputs[i], inputs[i] + lengths[i]);
+		    }
+		    std::vector<bool> batch_results =
+		        reinterpret_cast<NonDeterministicTuringMachine *>(ntm)->simulateBatch(input_vecs, simulationDepth);
+		    std::copy(batch_results.begin(), batch_results.end(), results);
+	    },
+	    error);
+}
+
+void NTM_simulateBatchParallel(NTMHandle ntm, const char ***inputs, const size_t *lengths, const size_t count,
+                               bool *results, const size_t threadCount, const int simulationDepth,
+                               AutomatonError *error) {
+	wrap_result(
+	    [&]() {
+		    std::vector<std::vector<std::string>> input_vecs;
+		    input_vecs.reserve(count);
+		    for (size_t i = 0; i < count; i++) {
+			    input_vecs.emplace_back(inputs[i], inputs[i] + lengths[i]);
+		    }
+		    auto *automaton = reinterpret_cast<NonDeterministicTuringMachine *>(ntm);
+		    std::vector<bool> batch_results =
+		        automaton->simulateBatchParallel(input_vecs, threadCount, simulationDepth);
+		    std::copy(batch_results.begin(), batch_results.end(), results);
+	    },
+	    error);
+}
+
 const TMStateArray NTM_getPossibleCurrentStates(NTMHandle npda, AutomatonError *error) {
 	return wrap_result<TMStateArray>(
 	    [&]() {
@@ -85,7 +85,7 @@ void PDAState_clearTransitionsTo(PDAStateHandle state, char *toStateKey) {
 }
 
 const PDATransitionArray PDAState_getTransitions(PDAStateHandle state) {
-	auto transitions = state->instance.getTransitions();
+	const auto &transitions = state->instance.getTransitionsView();
 
 	PDATransitionArray array;
 	array.length = transitions.size();
@@ -88,7 +88,7 @@ void TMState_clearTransitionsTo(TMStateHandle state, char *toStateKey) {
 }
 
 const TMTransitionArray TMState_getTransitions(TMStateHandle state) {
-	auto transitions = state->instance.getTransitions();
+	const auto &transitions = state->instance.getTransitionsView();
 
 	TMTransitionArray array;
 	array.length = transitions.size();